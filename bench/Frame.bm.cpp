@@ -0,0 +1,167 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/net/FrameClnt.hpp>
+#include <toolbox/net/FrameServ.hpp>
+#include <toolbox/bm.hpp>
+
+#include <unistd.h>
+
+TOOLBOX_BENCHMARK_MAIN
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct EchoApp {
+    template <typename ConnT>
+    void on_frame_connect(CyclTime /*now*/, ConnT& conn)
+    {
+        last = &conn;
+    }
+    template <typename ConnT>
+    void on_frame_disconnect(CyclTime /*now*/, const ConnT& /*conn*/) noexcept
+    {
+        last = nullptr;
+    }
+    template <typename ConnT>
+    void on_frame_error(CyclTime /*now*/, const ConnT& /*conn*/, const exception& e) noexcept
+    {
+        error = e.what();
+    }
+    template <typename ConnT>
+    void on_frame_message(CyclTime /*now*/, ConnT& conn, ConstBuffer msg)
+    {
+        ++count;
+        if (echo) {
+            conn.send(msg);
+        }
+    }
+    template <typename ConnT>
+    void on_frame_timeout(CyclTime /*now*/, const ConnT& /*conn*/) noexcept
+    {
+    }
+    void on_frame_connect_error(CyclTime /*now*/, const exception& e) noexcept { error = e.what(); }
+
+    bool echo{false};
+    long count{0};
+    void* last{nullptr};
+    string error;
+};
+
+/// Server and client connected over loopback and driven by a single Reactor, so that each round
+/// trip includes both the end of cycle flush and the epoll wakeup on either side.
+template <typename LengthT>
+struct PingPong {
+    using Conn = BasicFrameConn<EchoApp, LengthT>;
+
+    explicit PingPong(const StreamEndpoint& ep, string path = {})
+    : path{std::move(path)}
+    , serv{CyclTime::now(), reactor, ep, serv_app}
+    , clnt{CyclTime::now(), reactor, clnt_app}
+    {
+        serv_app.echo = true;
+        clnt.connect(CyclTime::now(), serv.local_endpoint());
+        while (!clnt_app.last || !serv_app.last) {
+            poll();
+        }
+    }
+    ~PingPong()
+    {
+        if (!path.empty()) {
+            unlink(path.c_str());
+        }
+    }
+    void poll() { reactor.poll(CyclTime::now(), 0s); }
+    /// Sends n messages and waits for the echoes.
+    void send(ConstBuffer msg, int n)
+    {
+        auto& conn = *static_cast<Conn*>(clnt_app.last);
+        const auto target = clnt_app.count + n;
+        for (int i{0}; i < n; ++i) {
+            conn.send(msg);
+        }
+        while (clnt_app.count < target) {
+            poll();
+        }
+    }
+
+    const string path;
+    Reactor reactor{1024};
+    EchoApp serv_app, clnt_app;
+    BasicFrameServ<Conn, EchoApp> serv;
+    BasicFrameClnt<Conn, EchoApp> clnt;
+};
+
+StreamEndpoint tcp_endpoint()
+{
+    return parse_stream_endpoint("tcp4://127.0.0.1:0");
+}
+
+string unix_path()
+{
+    auto path = "/tmp/tb-frame-bench." + to_string(getpid()) + ".sock";
+    unlink(path.c_str());
+    return path;
+}
+
+TOOLBOX_BENCHMARK(frame_latency_tcp)
+{
+    PingPong<uint16_t> pp{tcp_endpoint()};
+    const string msg(64, 'x');
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            pp.send({msg.data(), msg.size()}, 1);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(frame_latency_unix)
+{
+    const auto path = unix_path();
+    PingPong<uint16_t> pp{parse_stream_endpoint("unix://" + path), path};
+    const string msg(64, 'x');
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            pp.send({msg.data(), msg.size()}, 1);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(frame_throughput_tcp)
+{
+    PingPong<uint32_t> pp{tcp_endpoint()};
+    const string msg(1024, 'x');
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            pp.send({msg.data(), msg.size()}, 64);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(frame_throughput_unix)
+{
+    const auto path = unix_path();
+    PingPong<uint32_t> pp{parse_stream_endpoint("unix://" + path), path};
+    const string msg(1024, 'x');
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            pp.send({msg.data(), msg.size()}, 64);
+        }
+    }
+}
+
+} // namespace
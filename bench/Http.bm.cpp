@@ -0,0 +1,703 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/http/App.hpp>
+#include <toolbox/http/Client.hpp>
+#include <toolbox/http/Parser.hpp>
+#include <toolbox/http/Request.hpp>
+#include <toolbox/http/RequestView.hpp>
+#include <toolbox/http/ResponseWriter.hpp>
+#include <toolbox/http/Router.hpp>
+#include <toolbox/http/Serv.hpp>
+#include <toolbox/http/SimdParser.hpp>
+#include <toolbox/http/StaticFiles.hpp>
+#include <toolbox/http/Stream.hpp>
+#include <toolbox/http/WebSocket.hpp>
+#include <toolbox/net/IoSock.hpp>
+#include <toolbox/bm.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+
+TOOLBOX_BENCHMARK_MAIN
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+/// Returns a typical browser request with 20 headers.
+string make_request()
+{
+    string req{"GET /api/v1/orders?symbol=EURUSD&limit=100 HTTP/1.1\r\n"};
+    const char* const fields[]{"Host",
+                               "User-Agent",
+                               "Accept",
+                               "Accept-Language",
+                               "Accept-Encoding",
+                               "Connection",
+                               "Cache-Control",
+                               "Pragma",
+                               "Referer",
+                               "Origin",
+                               "Sec-Fetch-Dest",
+                               "Sec-Fetch-Mode",
+                               "Sec-Fetch-Site",
+                               "X-Request-Id",
+                               "X-Forwarded-For",
+                               "X-Forwarded-Proto",
+                               "Authorization",
+                               "Cookie",
+                               "DNT",
+                               "Upgrade-Insecure-Requests"};
+    for (const auto* field : fields) {
+        req += field;
+        req += ": value-of-a-typical-length-for-";
+        req += field;
+        req += "\r\n";
+    }
+    req += "\r\n";
+    return req;
+}
+
+/// Returns a request with large cookie and tracing headers, as seen behind some proxies.
+string make_large_request()
+{
+    string req{make_request()};
+    req.resize(req.size() - 2);
+    req += "Cookie: session=" + string(4096, 'c') + "\r\n";
+    for (int i{0}; i < 20; ++i) {
+        req += "X-Trace-" + to_string(i) + ": " + string(128, 't') + "\r\n";
+    }
+    req += "\r\n";
+    return req;
+}
+
+/// Drives a request type with the same callbacks as BasicConn.
+template <typename RequestT, template <typename> class ParserT = BasicParser>
+class Parser : public ParserT<Parser<RequestT, ParserT>> {
+    friend class ParserT<Parser<RequestT, ParserT>>;
+    using Base = ParserT<Parser<RequestT, ParserT>>;
+
+  public:
+    Parser()
+    : Base{Type::Request}
+    {
+    }
+    std::size_t count() const noexcept { return count_; }
+    /// Parses each slice of the input as if it had been returned by a separate read. Unconsumed
+    /// input is presented again with the next slice, as it would be by BasicConn.
+    void parse(string_view in, std::size_t slice)
+    {
+        std::size_t done{0};
+        for (std::size_t pos{0}; pos < in.size(); pos += slice) {
+            const auto end = min(pos + slice, in.size());
+            done += Base::parse(CyclTime::current(), ConstBuffer{in.data() + done, end - done});
+            if (in_progress_) {
+                req_.retain();
+            }
+        }
+    }
+
+  private:
+    bool on_http_message_begin(CyclTime /*now*/) noexcept
+    {
+        in_progress_ = true;
+        req_.clear();
+        return true;
+    }
+    bool on_http_url(CyclTime /*now*/, string_view sv) noexcept
+    {
+        req_.append_url(sv);
+        return true;
+    }
+    bool on_http_status(CyclTime /*now*/, string_view /*sv*/) noexcept { return false; }
+    bool on_http_header_field(CyclTime /*now*/, string_view sv, First first) noexcept
+    {
+        req_.append_header_field(sv, first);
+        return true;
+    }
+    bool on_http_header_value(CyclTime /*now*/, string_view sv, First first) noexcept
+    {
+        req_.append_header_value(sv, first);
+        return true;
+    }
+    bool on_http_headers_end(CyclTime /*now*/) noexcept
+    {
+        req_.set_method(this->method());
+        return true;
+    }
+    bool on_http_body(CyclTime /*now*/, string_view sv) noexcept
+    {
+        req_.append_body(sv);
+        return true;
+    }
+    bool on_http_message_end(CyclTime /*now*/) noexcept
+    {
+        in_progress_ = false;
+        req_.flush();
+        count_ += req_.headers().size();
+        return true;
+    }
+    bool on_http_chunk_header(CyclTime /*now*/, std::size_t /*len*/) noexcept { return true; }
+    bool on_http_chunk_end(CyclTime /*now*/) noexcept { return true; }
+
+    RequestT req_;
+    bool in_progress_{false};
+    std::size_t count_{0};
+};
+
+template <typename RequestT, template <typename> class ParserT = BasicParser>
+void run_parser(bm::Context& ctx, std::size_t slice, const string& req = make_request())
+{
+    Parser<RequestT, ParserT> p;
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            p.parse(req, slice);
+        }
+    }
+    bm::do_not_optimise(p.count());
+}
+
+/// Counts the requests, and writes a minimal response.
+template <typename RequestT>
+class CountApp final : public BasicApp<RequestT> {
+    using typename BasicApp<RequestT>::Endpoint;
+
+  public:
+    std::size_t count{0};
+
+  protected:
+    void do_on_http_connect(CyclTime /*now*/, const Endpoint& /*ep*/) override {}
+    void do_on_http_disconnect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    void do_on_http_error(CyclTime /*now*/, const Endpoint& /*ep*/, const std::exception& /*e*/,
+                          http::OStream& /*os*/) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime /*now*/, const Endpoint& /*ep*/, const RequestT& req,
+                            http::OStream& os) override
+    {
+        count += req.headers().size() == 20 ? 1 : 0;
+        os.reset(Status::Ok, TextPlain);
+        os << "ok";
+        os.commit();
+    }
+    void do_on_http_timeout(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+};
+
+/// Sends each request to a connection over a socket pair, and reads the response, so that each
+/// iteration measures the full cost of reading, parsing and responding to a request.
+template <typename RequestT, template <typename> class ParserT = BasicParser>
+void run_conn(bm::Context& ctx)
+{
+    const auto req = make_request();
+    Reactor r{1024};
+    CountApp<RequestT> app;
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.second.set_non_block();
+    new BasicConn<RequestT, BasicApp<RequestT>, ParserT>{CyclTime::now(), r,
+                                                         std::move(socks.second), StreamEndpoint{},
+                                                         app};
+    char buf[256];
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(16)) {
+            const auto expected = app.count + 1;
+            os::write(socks.first.get(), req.data(), req.size());
+            while (app.count < expected) {
+                r.poll(CyclTime::now(), 0ms);
+            }
+            bm::do_not_optimise(os::read(socks.first.get(), buf, sizeof(buf)));
+        }
+    }
+    // The connection disposes of itself when the peer closes the socket.
+    socks.first.reset();
+    r.poll(CyclTime::now(), 0ms);
+}
+
+/// Counts the completed client requests.
+struct Completions {
+    void operator()(CyclTime /*now*/, error_code ec, const Response& resp)
+    {
+        count += !ec && resp.status_code() == 200 ? 1 : 0;
+    }
+    std::size_t count{0};
+};
+
+/// Sends batches of GET requests from a client to a server in the same reactor over loopback TCP,
+/// and waits for each batch to complete, so that each iteration measures the round trip cost of a
+/// request on both sides, amortised over the pipeline depth. The batch is spread evenly over the
+/// connections.
+void run_client(bm::Context& ctx, std::size_t max_conns, std::size_t depth)
+{
+    Reactor r{1024};
+    CountApp<Request> app;
+    StreamSockServ sock{StreamProtocol::tcp4()};
+    sock.bind(parse_stream_endpoint("tcp4://127.0.0.1:0"));
+    sock.listen(SOMAXCONN);
+    StreamEndpoint ep;
+    sock.get_sock_name(ep);
+    Serv serv{CyclTime::now(), r, std::move(sock), app};
+
+    Completions done;
+    Client clnt{r, ep, {.max_conns = max_conns, .max_pipeline = depth / max_conns}};
+    while (ctx) {
+        const auto expected = done.count + depth;
+        for ([[maybe_unused]] auto _ : ctx.range(depth)) {
+            clnt.get(CyclTime::now(), "/api/v1/orders", bind(&done));
+        }
+        while (done.count < expected) {
+            r.poll(CyclTime::now(), 0ms);
+        }
+    }
+    bm::do_not_optimise(clnt.stats().connects);
+}
+
+/// Replaces one of 100k live connection-sized blocks in random order on each iteration, as a server
+/// with 100k connections does under steady connection churn, either from a SlabPool or from the
+/// general purpose allocator.
+template <bool PooledN>
+void run_conn_alloc(bm::Context& ctx)
+{
+    constexpr std::size_t N{100'000};
+    constexpr auto Size = sizeof(Conn);
+    SlabPool pool{Size};
+    const auto alloc = [&pool]() { return PooledN ? pool.allocate(Size) : allocate(Size); };
+    const auto dealloc = [&pool](void* ptr) {
+        if constexpr (PooledN) {
+            pool.deallocate(ptr);
+        } else {
+            deallocate(ptr, Size);
+        }
+    };
+    vector<void*> blocks(N);
+    vector<std::size_t> order(N);
+    for (std::size_t i{0}; i < N; ++i) {
+        blocks[i] = alloc();
+        order[i] = i;
+    }
+    shuffle(order.begin(), order.end(), minstd_rand{});
+    std::size_t i{0};
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(1000)) {
+            auto*& block = blocks[order[i]];
+            i = (i + 1) % N;
+            dealloc(block);
+            block = alloc();
+            bm::do_not_optimise(block);
+        }
+    }
+    for (auto* const block : blocks) {
+        dealloc(block);
+    }
+}
+
+/// Opens a connection to a server in the same reactor over loopback TCP, and resets it once it has
+/// been accepted, while the server holds the given number of idle connections.
+void run_accept_close(bm::Context& ctx, std::size_t idle)
+{
+    Reactor r{1024};
+    CountApp<Request> app;
+    StreamSockServ sock{StreamProtocol::tcp4()};
+    sock.bind(parse_stream_endpoint("tcp4://127.0.0.1:0"));
+    sock.listen(SOMAXCONN);
+    StreamEndpoint ep;
+    sock.get_sock_name(ep);
+    Serv serv{CyclTime::now(), r, std::move(sock), app};
+
+    const auto open = [&]() {
+        StreamSockClnt clnt{StreamProtocol::tcp4()};
+        clnt.connect(ep);
+        const auto expected = serv.conn_pool().size() + 1;
+        while (serv.conn_pool().size() < expected) {
+            r.poll(CyclTime::now(), 0ms);
+        }
+        return clnt;
+    };
+    vector<StreamSockClnt> idle_clnts;
+    idle_clnts.reserve(idle);
+    for (std::size_t i{0}; i < idle; ++i) {
+        idle_clnts.push_back(open());
+    }
+    // Reset the connections rather than closing them, so that the loopback ports are not held in
+    // TIME_WAIT.
+    const linger lg{.l_onoff = 1, .l_linger = 0};
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(16)) {
+            auto clnt = open();
+            os::setsockopt(clnt.get(), SOL_SOCKET, SO_LINGER, &lg, sizeof(lg));
+            clnt.close();
+            while (serv.conn_pool().size() > idle) {
+                r.poll(CyclTime::now(), 0ms);
+            }
+        }
+    }
+}
+
+/// Records activity on one of 100k idle connections in random order on each iteration, either by
+/// rescheduling the connection's own timer, as connections without a server do, or by touching the
+/// connection's entry in the server's IdleReaper.
+template <bool ReaperN>
+void run_idle_touch(bm::Context& ctx)
+{
+    constexpr std::size_t N{100'000};
+    auto on_idle = [](CyclTime /*now*/) {};
+    auto on_timer = [](CyclTime /*now*/, Timer& /*tmr*/) {};
+    Reactor r{1024};
+    IdleReaper reaper{CyclTime::now(), r, Conn::IdleTimeout};
+    vector<Timer> timers(ReaperN ? 0 : N);
+    vector<IdleEntry> entries(ReaperN ? N : 0);
+    for (auto& entry : entries) {
+        entry.slot = bind(&on_idle);
+    }
+    const auto touch = [&](std::size_t i) {
+        const auto now = CyclTime::now();
+        if constexpr (ReaperN) {
+            reaper.touch(now.mono_time(), entries[i]);
+        } else {
+            const auto timeout = chrono::ceil<Seconds>(now.mono_time() + Conn::IdleTimeout);
+            timers[i] = r.timer(timeout, Priority::Low, bind(&on_timer));
+        }
+    };
+    vector<std::size_t> order(N);
+    for (std::size_t i{0}; i < N; ++i) {
+        touch(i);
+        order[i] = i;
+    }
+    shuffle(order.begin(), order.end(), minstd_rand{});
+    std::size_t i{0};
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(1000)) {
+            touch(order[i]);
+            i = (i + 1) % N;
+        }
+    }
+}
+
+/// Serves a file with the StaticFiles handler, or copies the same bytes through OStream, as an
+/// application without the handler would.
+class FileApp final : public App {
+  public:
+    FileApp(StaticFiles* files, string data)
+    : files_{files}
+    , data_{std::move(data)}
+    {
+    }
+
+  protected:
+    void do_on_http_connect(CyclTime /*now*/, const Endpoint& /*ep*/) override {}
+    void do_on_http_disconnect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    void do_on_http_error(CyclTime /*now*/, const Endpoint& /*ep*/, const std::exception& /*e*/,
+                          http::OStream& /*os*/) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime /*now*/, const Endpoint& /*ep*/, const Request& req,
+                            http::OStream& os) override
+    {
+        if (files_) {
+            files_->serve(req, os);
+        } else {
+            os.reset(Status::Ok, "application/octet-stream");
+            os << data_;
+            os.commit();
+        }
+    }
+    void do_on_http_timeout(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+
+  private:
+    StaticFiles* files_;
+    const string data_;
+};
+
+/// Fetches a file from a server in the same reactor over loopback TCP, with the client acting as
+/// the load generator, in batches of 16 pipelined requests.
+void run_static(bm::Context& ctx, std::size_t size, bool handler)
+{
+    auto tmpl = (filesystem::temp_directory_path() / "toolbox-bm-XXXXXX").native();
+    const filesystem::path root{mkdtemp(tmpl.data())};
+    string data(size, 'x');
+    ofstream{root / "file.bin", ios::binary} << data;
+
+    Reactor r{1024};
+    StaticFiles files{r, root};
+    FileApp app{handler ? &files : nullptr, std::move(data)};
+    StreamSockServ sock{StreamProtocol::tcp4()};
+    sock.bind(parse_stream_endpoint("tcp4://127.0.0.1:0"));
+    sock.listen(SOMAXCONN);
+    StreamEndpoint ep;
+    sock.get_sock_name(ep);
+    Serv serv{CyclTime::now(), r, std::move(sock), app};
+
+    constexpr std::size_t Depth{16};
+    Completions done;
+    Client clnt{r, ep, {.max_conns = 1, .max_pipeline = Depth}};
+    while (ctx) {
+        const auto expected = done.count + Depth;
+        for ([[maybe_unused]] auto _ : ctx.range(Depth)) {
+            clnt.get(CyclTime::now(), "/file.bin", bind(&done));
+        }
+        while (done.count < expected) {
+            r.poll(CyclTime::now(), 0ms);
+        }
+    }
+    bm::do_not_optimise(files.stats().hits);
+    filesystem::remove_all(root);
+}
+
+/// Writes a small JSON response, as a typical API endpoint would.
+template <typename StreamT>
+void run_response(bm::Context& ctx)
+{
+    Buffer buf;
+    StreamT os{buf};
+    while (ctx) {
+        for (auto i : ctx.range(100)) {
+            os.reset(Status::Ok, ApplicationJson);
+            os << "{\"id\":" << i << ",\"symbol\":\"EURUSD\",\"qty\":" << 1'000'000 + i
+               << ",\"price\":" << 108'765 << '}';
+            os.commit();
+            buf.clear();
+        }
+    }
+}
+
+/// Registers routes in groups of three, e.g. /api/v1/res7, /api/v1/res7/{id} and
+/// /api/v1/res7/{id}/items/{item}, and matches a path for each route in turn.
+void run_router(bm::Context& ctx, int n)
+{
+    BasicRouter<int> r;
+    vector<string> paths;
+    for (int i{0}; i < n; ++i) {
+        const auto res = "/api/v1/res" + to_string(i / 3);
+        switch (i % 3) {
+        case 0:
+            r.add(Method::Get, res, i);
+            paths.push_back(res);
+            break;
+        case 1:
+            r.add(Method::Get, res + "/{id}", i);
+            paths.push_back(res + "/12345");
+            break;
+        case 2:
+            r.add(Method::Get, res + "/{id}/items/{item}", i);
+            paths.push_back(res + "/12345/items/678");
+            break;
+        }
+    }
+    RouteParams params;
+    int sum{0};
+    while (ctx) {
+        for (auto i : ctx.range(100)) {
+            sum += *r.match(Method::Get, paths[i % paths.size()], params);
+        }
+    }
+    bm::do_not_optimise(sum);
+}
+
+/// Unmasks a typical market data payload, either with ws_mask(), or one byte at a time.
+template <bool WideV>
+void run_ws_mask(bm::Context& ctx)
+{
+    string payload(1024, 'x');
+    const uint32_t mask{0x12345678};
+    const auto* const key = reinterpret_cast<const unsigned char*>(&mask);
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            if constexpr (WideV) {
+                ws_mask(payload.data(), payload.size(), mask);
+            } else {
+                for (size_t i{0}; i < payload.size(); ++i) {
+                    payload[i] = static_cast<char>(payload[i] ^ key[i & 3]);
+                    // Prevent the loop from being vectorised.
+                    bm::do_not_optimise(payload[i]);
+                }
+            }
+        }
+    }
+    bm::do_not_optimise(payload);
+}
+
+TOOLBOX_BENCHMARK(http_request_parse)
+{
+    run_parser<Request>(ctx, numeric_limits<std::size_t>::max());
+}
+
+TOOLBOX_BENCHMARK(http_request_view_parse)
+{
+    run_parser<RequestView>(ctx, numeric_limits<std::size_t>::max());
+}
+
+TOOLBOX_BENCHMARK(http_request_parse_split)
+{
+    run_parser<Request>(ctx, 256);
+}
+
+TOOLBOX_BENCHMARK(http_request_view_parse_split)
+{
+    run_parser<RequestView>(ctx, 256);
+}
+
+TOOLBOX_BENCHMARK(http_request_simd_parse)
+{
+    run_parser<Request, BasicSimdParser>(ctx, numeric_limits<std::size_t>::max());
+}
+
+TOOLBOX_BENCHMARK(http_request_view_simd_parse)
+{
+    run_parser<RequestView, BasicSimdParser>(ctx, numeric_limits<std::size_t>::max());
+}
+
+TOOLBOX_BENCHMARK(http_request_view_simd_parse_split)
+{
+    run_parser<RequestView, BasicSimdParser>(ctx, 256);
+}
+
+TOOLBOX_BENCHMARK(http_large_request_view_parse)
+{
+    run_parser<RequestView>(ctx, numeric_limits<std::size_t>::max(), make_large_request());
+}
+
+TOOLBOX_BENCHMARK(http_large_request_view_simd_parse)
+{
+    run_parser<RequestView, BasicSimdParser>(ctx, numeric_limits<std::size_t>::max(),
+                                             make_large_request());
+}
+
+TOOLBOX_BENCHMARK(http_large_request_view_parse_split)
+{
+    run_parser<RequestView>(ctx, 2944, make_large_request());
+}
+
+TOOLBOX_BENCHMARK(http_large_request_view_simd_parse_split)
+{
+    run_parser<RequestView, BasicSimdParser>(ctx, 2944, make_large_request());
+}
+
+TOOLBOX_BENCHMARK(http_request_conn)
+{
+    run_conn<Request>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_request_view_conn)
+{
+    run_conn<RequestView>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_request_view_simd_conn)
+{
+    run_conn<RequestView, BasicSimdParser>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_client)
+{
+    run_client(ctx, 1, 1);
+}
+
+TOOLBOX_BENCHMARK(http_client_pipeline_16)
+{
+    run_client(ctx, 1, 16);
+}
+
+TOOLBOX_BENCHMARK(http_client_pool_4x16)
+{
+    run_client(ctx, 4, 64);
+}
+
+TOOLBOX_BENCHMARK(http_conn_alloc_heap_100k)
+{
+    run_conn_alloc<false>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_conn_alloc_slab_100k)
+{
+    run_conn_alloc<true>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_serv_accept_close)
+{
+    run_accept_close(ctx, 0);
+}
+
+TOOLBOX_BENCHMARK(http_serv_accept_close_4k_idle)
+{
+    run_accept_close(ctx, 4000);
+}
+
+TOOLBOX_BENCHMARK(http_idle_touch_timer_100k)
+{
+    run_idle_touch<false>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_idle_touch_reaper_100k)
+{
+    run_idle_touch<true>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_static_4k_ostream)
+{
+    run_static(ctx, 4 << 10, false);
+}
+
+TOOLBOX_BENCHMARK(http_static_4k_cached)
+{
+    run_static(ctx, 4 << 10, true);
+}
+
+TOOLBOX_BENCHMARK(http_static_1m_ostream)
+{
+    run_static(ctx, 1 << 20, false);
+}
+
+TOOLBOX_BENCHMARK(http_static_1m_sendfile)
+{
+    run_static(ctx, 1 << 20, true);
+}
+
+TOOLBOX_BENCHMARK(http_router_10)
+{
+    run_router(ctx, 10);
+}
+
+TOOLBOX_BENCHMARK(http_router_100)
+{
+    run_router(ctx, 100);
+}
+
+TOOLBOX_BENCHMARK(http_router_1000)
+{
+    run_router(ctx, 1000);
+}
+
+TOOLBOX_BENCHMARK(http_ws_mask)
+{
+    run_ws_mask<true>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_ws_mask_bytewise)
+{
+    run_ws_mask<false>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_ostream_response)
+{
+    run_response<http::OStream>(ctx);
+}
+
+TOOLBOX_BENCHMARK(http_response_writer)
+{
+    run_response<ResponseWriter>(ctx);
+}
+
+} // namespace
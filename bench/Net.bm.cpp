@@ -13,15 +13,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <toolbox/net/AtomicTokenBucket.hpp>
 #include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/RateLimiterTable.hpp>
 #include <toolbox/util/Random.hpp>
 #include <toolbox/util/Stream.hpp>
+#include <toolbox/util/String.hpp>
 #include <toolbox/bm.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <vector>
 #include <limits>
+#include <thread>
 
 #include <netinet/in.h>
 
@@ -94,4 +98,164 @@ TOOLBOX_BENCHMARK(format_ipv4_endpoint)
     }
 }
 
+std::vector<std::string> generate_ipv4_uris(const std::vector<sockaddr_in>& addrs) {
+    std::vector<std::string> ret;
+    ret.reserve(addrs.size());
+    for (const auto& sa : addrs) {
+        ret.push_back("tcp4://" + to_string(sa));
+    }
+    return ret;
+}
+
+std::vector<std::string> rand_ipv4_uris = generate_ipv4_uris(rand_ipv4_addresses);
+
+TOOLBOX_BENCHMARK(parse_ipv4_endpoint_getaddrinfo)
+{
+    while (ctx) {
+        for (auto i : ctx.range(rand_ipv4_uris.size())) {
+            auto ai = parse_endpoint(rand_ipv4_uris[i], SOCK_STREAM);
+            bm::do_not_optimise(ai);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(parse_ipv4_endpoint)
+{
+    while (ctx) {
+        for (auto i : ctx.range(rand_ipv4_uris.size())) {
+            auto ep = parse_stream_endpoint(rand_ipv4_uris[i]);
+            bm::do_not_optimise(ep);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(parse_ipv6_endpoint_getaddrinfo)
+{
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(1024)) {
+            auto ai = parse_endpoint("tcp6://[fe80::c8bf:7d86:cbdc:bda9]:443", SOCK_STREAM);
+            bm::do_not_optimise(ai);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(parse_ipv6_endpoint)
+{
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(1024)) {
+            auto ep = parse_stream_endpoint("tcp6://[fe80::c8bf:7d86:cbdc:bda9]:443");
+            bm::do_not_optimise(ep);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(parse_unix_endpoint)
+{
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(1024)) {
+            auto ep = parse_stream_endpoint("unix:///tmp/foo.sock");
+            bm::do_not_optimise(ep);
+        }
+    }
+}
+
+struct RateLimiterTableFixture {
+    explicit RateLimiterTableFixture(size_t n)
+    : rlt{1000, 1s}
+    {
+        const auto now = MonoClock::now();
+        rlt.reserve(n);
+        for (size_t i{0}; i < n; ++i) {
+            rlt.try_acquire(now, make_key(i));
+        }
+        keys.reserve(4096);
+        for (size_t i{0}; i < 4096; ++i) {
+            keys.push_back(make_key(randint<size_t>(0, n - 1)));
+        }
+    }
+    static uint64_t make_key(size_t i) noexcept { return i * 0x9e3779b97f4a7c15; }
+
+    RateLimiterTable rlt;
+    std::vector<uint64_t> keys;
+};
+
+void rate_limiter_table_bench(bm::Context& ctx, RateLimiterTableFixture& fix)
+{
+    while (ctx) {
+        const auto now = MonoClock::now();
+        for (auto i : ctx.range(fix.keys.size())) {
+            auto ok = fix.rlt.try_acquire(now, fix.keys[i]);
+            bm::do_not_optimise(ok);
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(rate_limiter_table_10k)
+{
+    static RateLimiterTableFixture fix{10'000};
+    rate_limiter_table_bench(ctx, fix);
+}
+
+TOOLBOX_BENCHMARK(rate_limiter_table_1m)
+{
+    static RateLimiterTableFixture fix{1'000'000};
+    rate_limiter_table_bench(ctx, fix);
+}
+
+/// Measures try_acquire() on a token bucket that is shared with N - 1 background threads, which
+/// contend for the bucket until the benchmark completes.
+template <int N, Fairness FairnessV>
+void atomic_token_bucket_bench(bm::Context& ctx)
+{
+    // The limit is high enough that almost every call updates the bucket.
+    AtomicTokenBucket tb{1'000'000'000, 1s, FairnessV};
+    atomic_bool stop{false};
+    vector<jthread> threads;
+    for (int i{1}; i < N; ++i) {
+        threads.emplace_back([&tb, &stop]() {
+            while (!stop.load(memory_order_relaxed)) {
+                auto ok = tb.try_acquire();
+                bm::do_not_optimise(ok);
+            }
+        });
+    }
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(1024)) {
+            auto ok = tb.try_acquire();
+            bm::do_not_optimise(ok);
+        }
+    }
+    stop = true;
+}
+
+TOOLBOX_BENCHMARK(atomic_token_bucket_1_thread)
+{
+    atomic_token_bucket_bench<1, Fairness::Greedy>(ctx);
+}
+
+TOOLBOX_BENCHMARK(atomic_token_bucket_2_threads)
+{
+    atomic_token_bucket_bench<2, Fairness::Greedy>(ctx);
+}
+
+TOOLBOX_BENCHMARK(atomic_token_bucket_4_threads)
+{
+    atomic_token_bucket_bench<4, Fairness::Greedy>(ctx);
+}
+
+TOOLBOX_BENCHMARK(atomic_token_bucket_8_threads)
+{
+    atomic_token_bucket_bench<8, Fairness::Greedy>(ctx);
+}
+
+TOOLBOX_BENCHMARK(atomic_token_bucket_4_threads_backoff)
+{
+    atomic_token_bucket_bench<4, Fairness::Backoff>(ctx);
+}
+
+TOOLBOX_BENCHMARK(atomic_token_bucket_8_threads_backoff)
+{
+    atomic_token_bucket_bench<8, Fairness::Backoff>(ctx);
+}
+
 } // namespace
@@ -0,0 +1,105 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/io/Runner.hpp>
+#include <toolbox/net/IoSock.hpp>
+#include <toolbox/net/Protocol.hpp>
+#include <toolbox/net/ShmRing.hpp>
+#include <toolbox/bm.hpp>
+
+TOOLBOX_BENCHMARK_MAIN
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+constexpr size_t MsgSize{64};
+
+/// Echoes each request from one ring to another on a Reactor thread.
+class ShmEcho {
+  public:
+    explicit ShmEcho(bool use_eventfd)
+    : reader_{reactor_, req_, bind<&ShmEcho::on_msg>(this), use_eventfd ? &efd_ : nullptr}
+    {
+    }
+    /// Sends a request and spins until the response has been received.
+    void ping(ConstBuffer msg)
+    {
+        while (!req_.write(msg, efd_)) {
+        }
+        while (res_.read([](ConstBuffer) {}) == 0) {
+        }
+    }
+
+  private:
+    void on_msg(CyclTime /*now*/, ConstBuffer msg)
+    {
+        while (!res_.write(msg)) {
+        }
+    }
+
+    ShmRing req_{1 << 16}, res_{1 << 16};
+    EventFd efd_{0, EFD_NONBLOCK};
+    Reactor reactor_{1024};
+    ShmRingReader reader_;
+    ReactorRunner runner_{reactor_, 0, "echo"s};
+};
+
+TOOLBOX_BENCHMARK(shm_ring_spin)
+{
+    ShmEcho echo{false};
+    const string msg(MsgSize, 'x');
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            echo.ping({msg.data(), msg.size()});
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(shm_ring_eventfd)
+{
+    ShmEcho echo{true};
+    const string msg(MsgSize, 'x');
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            echo.ping({msg.data(), msg.size()});
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(unix_sock)
+{
+    auto [clnt, serv] = socketpair(UnixStreamProtocol{});
+    thread echo{[&serv]() {
+        char buf[MsgSize];
+        // Exits when the client end of the socket is closed.
+        while (serv.recv(buf, sizeof(buf), MSG_WAITALL) == sizeof(buf)) {
+            serv.send(buf, sizeof(buf), 0);
+        }
+    }};
+    const string msg(MsgSize, 'x');
+    char buf[MsgSize];
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(100)) {
+            clnt.send(msg.data(), msg.size(), 0);
+            clnt.recv(buf, sizeof(buf), MSG_WAITALL);
+        }
+    }
+    clnt.shutdown(SHUT_RDWR);
+    echo.join();
+}
+
+} // namespace
@@ -0,0 +1,145 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/io/Runner.hpp>
+#include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/SpliceProxy.hpp>
+#include <toolbox/net/StreamSock.hpp>
+#include <toolbox/bm.hpp>
+
+TOOLBOX_BENCHMARK_MAIN
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+constexpr size_t ChunkSize{64 * 1024};
+
+/// Returns a connected pair of loopback TCP sockets.
+pair<IoSock, IoSock> tcp_pair()
+{
+    StreamSockServ serv{StreamProtocol::tcp4()};
+    serv.bind(parse_stream_endpoint("tcp4://127.0.0.1:0"));
+    serv.listen(1);
+    StreamEndpoint ep;
+    serv.get_sock_name(ep);
+    StreamSockClnt clnt{StreamProtocol::tcp4()};
+    clnt.connect(ep);
+    IoSock peer{os::accept(serv.get()), AF_INET};
+    return {std::move(clnt), std::move(peer)};
+}
+
+/// Relays data in one direction by reading into a Buffer and writing it out again, with the same
+/// back-pressure handling as BasicConn, as the baseline for SpliceProxy.
+class CopyRelay {
+  public:
+    CopyRelay(Reactor& r, IoSock&& src, IoSock&& dst)
+    : src_{std::move(src)}
+    , dst_{std::move(dst)}
+    {
+        src_.set_non_block();
+        dst_.set_non_block();
+        src_sub_ = r.subscribe(*src_, EpollIn, bind<&CopyRelay::on_src_event>(this));
+        dst_sub_ = r.subscribe(*dst_, 0, bind<&CopyRelay::on_dst_event>(this));
+    }
+
+  private:
+    void on_src_event(CyclTime /*now*/, int /*fd*/, unsigned /*events*/)
+    {
+        for (int i{0}; i < 4 && buf_.size() < ChunkSize; ++i) {
+            error_code ec;
+            const auto size = src_.read(buf_.prepare(ChunkSize - buf_.size()), ec);
+            if (ec || size == 0) {
+                break;
+            }
+            buf_.commit(size);
+        }
+        flush();
+    }
+    void on_dst_event(CyclTime /*now*/, int /*fd*/, unsigned /*events*/) { flush(); }
+    void flush()
+    {
+        error_code ec;
+        const auto size = dst_.write(buf_.data(), ec);
+        if (!ec) {
+            buf_.consume(size);
+        }
+        const bool blocked{!buf_.empty()};
+        if (blocked != blocked_) {
+            // Stop reading while the destination is blocked.
+            src_sub_.set_events(blocked ? 0U : unsigned{EpollIn});
+            dst_sub_.set_events(blocked ? unsigned{EpollOut} : 0U);
+            blocked_ = blocked;
+        }
+    }
+
+    IoSock src_, dst_;
+    Reactor::Handle src_sub_, dst_sub_;
+    Buffer buf_;
+    bool blocked_{false};
+};
+
+/// Pumps chunks from a client, through a relay running on a Reactor thread, to a server.
+template <typename RelayT>
+class Loopback {
+  public:
+    Loopback()
+    : Loopback{tcp_pair(), tcp_pair()}
+    {
+    }
+    void pump()
+    {
+        os::send(clnt_.get(), chunk_.data(), chunk_.size(), 0);
+        os::recv(serv_.get(), chunk_.data(), chunk_.size(), MSG_WAITALL);
+    }
+
+  private:
+    Loopback(pair<IoSock, IoSock> front, pair<IoSock, IoSock> back)
+    : clnt_{std::move(front.first)}
+    , serv_{std::move(back.second)}
+    , relay_{reactor_, std::move(front.second), std::move(back.first)}
+    {
+    }
+
+    vector<char> chunk_ = vector<char>(ChunkSize, 'x');
+    IoSock clnt_, serv_;
+    Reactor reactor_{1024};
+    RelayT relay_;
+    ReactorRunner runner_{reactor_, 0, "relay"s};
+};
+
+TOOLBOX_BENCHMARK(copy_relay_64k)
+{
+    Loopback<CopyRelay> lb;
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(16)) {
+            lb.pump();
+        }
+    }
+}
+
+TOOLBOX_BENCHMARK(splice_proxy_64k)
+{
+    Loopback<SpliceProxy> lb;
+    while (ctx) {
+        for ([[maybe_unused]] auto _ : ctx.range(16)) {
+            lb.pump();
+        }
+    }
+}
+
+} // namespace
@@ -0,0 +1,110 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <toolbox/io.hpp>
+#include <toolbox/net.hpp>
+#include <toolbox/sys.hpp>
+#include <toolbox/util.hpp>
+
+using namespace toolbox;
+
+namespace {
+
+/// Captures the datagrams sent to a multicast group or unicast port until interrupted.
+void capture(const std::string& path, const std::string& addr, std::uint16_t port,
+             const std::string& ifname)
+{
+    using namespace std::literals::string_literals;
+
+    const auto ip_addr = boost::asio::ip::make_address(addr);
+    const UdpEndpoint ep{ip_addr, port};
+    McastSock sock{ep.protocol()};
+    sock.set_reuse_addr(true);
+    sock.bind(ep);
+    if (ip_addr.is_multicast()) {
+        sock.join_group(ip_addr, ifname.c_str());
+    }
+
+    Reactor reactor{};
+    PcapWriter writer{path.c_str()};
+    PcapCapture capture{reactor, sock, DgramEndpoint{ep.data(), ep.size(), IPPROTO_UDP}, writer};
+    {
+        // Busy-poll the reactor to minimise timestamp skew.
+        ReactorRunner reactor_runner{reactor, 1'000'000, "capture"s};
+        SigWait sig_wait;
+        while (sig_wait() == SIGHUP) {
+        }
+    }
+    TOOLBOX_INFO << "captured " << writer.packets() << " packets";
+}
+
+/// Replays a capture file to the original destinations, or to the specified destination.
+void replay(const std::string& path, double speed, const std::string& dest,
+            const std::string& ifname)
+{
+    std::optional<DgramEndpoint> dst;
+    int family{AF_INET};
+    if (!dest.empty()) {
+        dst = parse_dgram_endpoint(dest);
+        family = dst->protocol().family();
+    }
+    DgramSock sock{family == AF_INET ? DgramProtocol::udp4() : DgramProtocol::udp6()};
+    set_ip_mcast_if(sock.get(), family, ifname.c_str());
+    set_ip_mcast_loop(sock.get(), family, true);
+
+    PcapReader reader{path.c_str()};
+    const auto start = MonoClock::now();
+    const auto n = pcap_replay(reader, sock, speed, dst);
+    const auto elapsed = std::chrono::duration_cast<Micros>(MonoClock::now() - start);
+    TOOLBOX_INFO << "replayed " << n << " packets in " << elapsed.count() << "us";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    int ret = 1;
+    try {
+        std::string path, addr, dest;
+        std::string ifname{"lo"};
+        int port{0};
+        double speed{1.0};
+        bool replay_mode{false};
+
+        Options opts{"tb-pcap [OPTIONS] FILE"};
+        // clang-format off
+        opts('a', "addr", Value{addr}, "capture datagrams sent to address, typically a group")
+            ('p', "port", Value{port}, "capture datagrams sent to port")
+            ('r', "replay", Switch{replay_mode}, "replay FILE rather than capturing to it")
+            ('s', "speed", Value{speed}, "multiple of original rate, or zero for max speed")
+            ('d', "dest", Value{dest}, "replay to endpoint rather than original destination")
+            ('i', "interface", Value{ifname}, "multicast interface (default lo)")
+            ('h', "help", Help{})
+            (Value{path}.required(), "capture file");
+        // clang-format on
+        opts.parse(argc, argv);
+
+        if (replay_mode) {
+            replay(path, speed, dest, ifname);
+        } else {
+            capture(path, addr.empty() ? "0.0.0.0" : addr, port, ifname);
+        }
+        ret = 0;
+
+    } catch (const std::exception& e) {
+        TOOLBOX_ERROR << "exception on main thread: " << e.what();
+    }
+    return ret;
+}
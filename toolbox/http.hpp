@@ -18,14 +18,23 @@
 #define TOOLBOX_HTTP_HPP
 
 #include "http/App.hpp"
+#include "http/Client.hpp"
 #include "http/Conn.hpp"
 #include "http/Error.cpp"
 #include "http/Exception.cpp"
 #include "http/Parser.hpp"
+#include "http/Producer.hpp"
 #include "http/Request.hpp"
+#include "http/RequestView.hpp"
+#include "http/Response.hpp"
+#include "http/ResponseWriter.hpp"
+#include "http/Router.hpp"
 #include "http/Serv.hpp"
+#include "http/SimdParser.hpp"
+#include "http/StaticFiles.hpp"
 #include "http/Stream.hpp"
 #include "http/Types.hpp"
 #include "http/Url.hpp"
+#include "http/WebSocket.hpp"
 
 #endif // TOOLBOX_HTTP_HPP
@@ -16,10 +16,41 @@
 
 #include "App.hpp"
 
+#include "Request.hpp"
+#include "RequestView.hpp"
+#include "ResponseWriter.hpp"
+#include "Stream.hpp"
+
 namespace toolbox {
 inline namespace http {
 
-App::~App() = default;
+template <typename RequestT, typename StreamT>
+BasicApp<RequestT, StreamT>::~BasicApp() = default;
+
+template <typename RequestT, typename StreamT>
+bool BasicApp<RequestT, StreamT>::do_on_http_headers(CyclTime /*now*/, const Endpoint& /*ep*/,
+                                                     const Request& /*req*/)
+{
+    return false;
+}
+
+template <typename RequestT, typename StreamT>
+void BasicApp<RequestT, StreamT>::do_on_http_body(CyclTime /*now*/, const Endpoint& /*ep*/,
+                                                  const Request& /*req*/, std::string_view /*data*/)
+{
+}
+
+template <typename RequestT, typename StreamT>
+WsHandler* BasicApp<RequestT, StreamT>::do_on_ws_upgrade(CyclTime /*now*/, const Endpoint& /*ep*/,
+                                                         const Request& /*req*/)
+{
+    return nullptr;
+}
+
+template class BasicApp<Request, OStream>;
+template class BasicApp<RequestView, OStream>;
+template class BasicApp<Request, ResponseWriter>;
+template class BasicApp<RequestView, ResponseWriter>;
 
 } // namespace http
 } // namespace toolbox
@@ -22,24 +22,26 @@
 namespace toolbox {
 inline namespace http {
 
-class OStream;
-class Request;
-
-class TOOLBOX_API App {
+/// Application interface for HTTP connections. The stream type is the response stream that is
+/// passed to the callbacks, which is either OStream or ResponseWriter.
+template <typename RequestT, typename StreamT>
+class TOOLBOX_API BasicApp {
   public:
     using Protocol = StreamProtocol;
     using Endpoint = StreamEndpoint;
+    using Request = RequestT;
+    using Stream = StreamT;
 
-    App() noexcept = default;
-    virtual ~App();
+    BasicApp() noexcept = default;
+    virtual ~BasicApp();
 
     // Copy.
-    constexpr App(const App&) noexcept = default;
-    App& operator=(const App&) noexcept = default;
+    constexpr BasicApp(const BasicApp&) noexcept = default;
+    BasicApp& operator=(const BasicApp&) noexcept = default;
 
     // Move.
-    constexpr App(App&&) noexcept = default;
-    App& operator=(App&&) noexcept = default;
+    constexpr BasicApp(BasicApp&&) noexcept = default;
+    BasicApp& operator=(BasicApp&&) noexcept = default;
 
     void on_http_connect(CyclTime now, const Endpoint& ep) { do_on_http_connect(now, ep); }
     void on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept
@@ -47,28 +49,69 @@ class TOOLBOX_API App {
         do_on_http_disconnect(now, ep);
     }
     void on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
-                       OStream& os) noexcept
+                       Stream& os) noexcept
     {
         do_on_http_error(now, ep, e, os);
     }
-    void on_http_message(CyclTime now, const Endpoint& ep, const Request& req, OStream& os)
+    /// Called when the request headers are complete. Returns true to receive the body in parts
+    /// through on_http_body(), as it arrives, in which case the request that is passed to
+    /// on_http_message() has an empty body.
+    bool on_http_headers(CyclTime now, const Endpoint& ep, const Request& req)
+    {
+        return do_on_http_headers(now, ep, req);
+    }
+    /// Called with each part of a streamed request body. The data is only valid for the duration of
+    /// the callback.
+    void on_http_body(CyclTime now, const Endpoint& ep, const Request& req, std::string_view data)
+    {
+        do_on_http_body(now, ep, req, data);
+    }
+    void on_http_message(CyclTime now, const Endpoint& ep, const Request& req, Stream& os)
     {
         do_on_http_message(now, ep, req, os);
     }
     void on_http_timeout(CyclTime now, const Endpoint& ep) noexcept { do_on_http_timeout(now, ep); }
+    /// Returns the handler for a WebSocket upgrade request, or nullptr to decline the upgrade, in
+    /// which case the request is passed to on_http_message() instead.
+    WsHandler* on_ws_upgrade(CyclTime now, const Endpoint& ep, const Request& req)
+    {
+        return do_on_ws_upgrade(now, ep, req);
+    }
 
   protected:
     virtual void do_on_http_connect(CyclTime now, const Endpoint& ep) = 0;
     virtual void do_on_http_disconnect(CyclTime now, const Endpoint& ep) noexcept = 0;
     virtual void do_on_http_error(CyclTime now, const Endpoint& ep, const std::exception& e,
-                                  OStream& os) noexcept
+                                  Stream& os) noexcept
         = 0;
+    /// Request bodies are buffered by default.
+    virtual bool do_on_http_headers(CyclTime now, const Endpoint& ep, const Request& req);
+    virtual void do_on_http_body(CyclTime now, const Endpoint& ep, const Request& req,
+                                 std::string_view data);
     virtual void do_on_http_message(CyclTime now, const Endpoint& ep, const Request& req,
-                                    OStream& os)
+                                    Stream& os)
         = 0;
     virtual void do_on_http_timeout(CyclTime now, const Endpoint& ep) noexcept = 0;
+    /// WebSocket upgrades are declined by default.
+    virtual WsHandler* do_on_ws_upgrade(CyclTime now, const Endpoint& ep, const Request& req);
 };
 
+/// Application interface for connections that copy the request into owned strings.
+using App = BasicApp<Request>;
+/// Application interface for connections with zero-copy requests, which refer to the connection's
+/// input buffer, and are only valid for the duration of the on_http_message callback.
+using ViewApp = BasicApp<RequestView>;
+/// Application interface for connections that write responses with ResponseWriter.
+using WriterApp = BasicApp<Request, ResponseWriter>;
+/// Application interface for connections with zero-copy requests and ResponseWriter responses.
+using ViewWriterApp = BasicApp<RequestView, ResponseWriter>;
+
+// Instantiated and exported by the library.
+extern template class BasicApp<Request, OStream>;
+extern template class BasicApp<RequestView, OStream>;
+extern template class BasicApp<Request, ResponseWriter>;
+extern template class BasicApp<RequestView, ResponseWriter>;
+
 } // namespace http
 } // namespace toolbox
 
@@ -0,0 +1,406 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Client.hpp"
+
+#include <toolbox/util/String.hpp>
+
+#include <charconv>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+
+Client::Conn::Conn(Client& client)
+: BasicParser<Conn>{Type::Response}
+, client_{client}
+{
+}
+
+Client::Conn::~Conn() = default;
+
+void Client::Conn::send(CyclTime now, const ClientRequest& req, ClientSlot slot)
+{
+    put(enum_string(req.method));
+    put(" ");
+    put(req.target);
+    put(" HTTP/1.1\r\nHost: ");
+    put(client_.opts_.host);
+    put("\r\n");
+    for (const auto& [field, value] : req.headers) {
+        put(field);
+        put(": ");
+        put(value);
+        put("\r\n");
+    }
+    if (!req.content_type.empty()) {
+        put("Content-Type: ");
+        put(req.content_type);
+        put("\r\n");
+    }
+    if (!req.body.empty() || req.method == Method::Post || req.method == Method::Put
+        || req.method == Method::Patch) {
+        char buf[20];
+        const auto [end, ec] = to_chars(buf, buf + sizeof(buf), req.body.size());
+        put("Content-Length: ");
+        put({buf, static_cast<size_t>(end - buf)});
+        put("\r\n");
+    }
+    put("\r\n");
+    put(req.body);
+
+    pending_.push_back({slot, now.mono_time() + client_.opts_.timeout});
+    if (pending_.size() == 1) {
+        schedule_timeout();
+    }
+    switch (state_) {
+    case State::Closed:
+        state_ = State::Connecting;
+        try {
+            connect(now, client_.reactor_, client_.ep_);
+        } catch (const system_error& e) {
+            close(now, e.code());
+        }
+        break;
+    case State::Connecting:
+        // The request is written when the connection is established.
+        break;
+    case State::Open:
+        if (!write_blocked_) {
+            flush_output(now);
+        }
+        break;
+    }
+}
+
+void Client::Conn::on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
+
+void Client::Conn::on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& /*ep*/)
+{
+    if (state_ != State::Connecting) {
+        // The connection was closed while the attempt was in progress.
+        return;
+    }
+    ++client_.stats_.connects;
+    sock_ = std::move(sock);
+    sub_ = client_.reactor_.subscribe(*sock_, EpollIn, bind<&Conn::on_io_event>(this));
+    state_ = State::Open;
+    flush_output(now);
+}
+
+void Client::Conn::on_sock_connect_error(CyclTime now, const std::exception& e)
+{
+    if (state_ != State::Connecting) {
+        return;
+    }
+    const auto* const se = dynamic_cast<const system_error*>(&e);
+    close(now, se ? se->code() : make_error_code(errc::connection_aborted));
+}
+
+void Client::Conn::on_io_event(CyclTime now, int /*fd*/, unsigned events)
+{
+    if (events & (EpollIn | EpollHup | EpollErr)) {
+        if (!drain_input(now)) {
+            return;
+        }
+    }
+    if (write_blocked_ && (events & EpollOut)) {
+        flush_output(now);
+    }
+}
+
+void Client::Conn::on_timer(CyclTime now, Timer& /*tmr*/)
+{
+    close(now, make_error_code(errc::timed_out));
+}
+
+bool Client::Conn::on_http_message_begin(CyclTime /*now*/) noexcept
+{
+    resp_.clear();
+    return true;
+}
+
+bool Client::Conn::on_http_url(CyclTime /*now*/, string_view /*sv*/) noexcept
+{
+    // Only supported for HTTP requests.
+    return false;
+}
+
+bool Client::Conn::on_http_status(CyclTime /*now*/, string_view sv) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.append_reason(sv);
+        ret = true;
+    } catch (const std::exception&) {
+    }
+    return ret;
+}
+
+bool Client::Conn::on_http_header_field(CyclTime /*now*/, string_view sv, First first) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.append_header_field(sv, first);
+        ret = true;
+    } catch (const std::exception&) {
+    }
+    return ret;
+}
+
+bool Client::Conn::on_http_header_value(CyclTime /*now*/, string_view sv, First first) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.append_header_value(sv, first);
+        ret = true;
+    } catch (const std::exception&) {
+    }
+    return ret;
+}
+
+bool Client::Conn::on_http_headers_end(CyclTime /*now*/) noexcept
+{
+    resp_.set_status_code(status_code());
+    return true;
+}
+
+bool Client::Conn::on_http_body(CyclTime /*now*/, string_view sv) noexcept
+{
+    bool ret{false};
+    try {
+        resp_.append_body(sv);
+        ret = true;
+    } catch (const std::exception&) {
+    }
+    return ret;
+}
+
+bool Client::Conn::on_http_message_end(CyclTime /*now*/) noexcept
+{
+    // The completion callback is invoked once the parser has returned, because it may send or close
+    // the connection.
+    complete_ = true;
+    keep_alive_ = should_keep_alive();
+    pause();
+    return true;
+}
+
+bool Client::Conn::on_http_chunk_header(CyclTime /*now*/, size_t /*len*/) noexcept
+{
+    return true;
+}
+
+bool Client::Conn::on_http_chunk_end(CyclTime /*now*/) noexcept
+{
+    return true;
+}
+
+void Client::Conn::put(string_view sv)
+{
+    const auto buf = out_.prepare(sv.size());
+    memcpy(buf.data(), sv.data(), sv.size());
+    out_.commit(sv.size());
+}
+
+bool Client::Conn::drain_input(CyclTime now)
+{
+    bool eof{false};
+    // Limit the number of reads to avoid starvation.
+    for (int i{0}; i < 4; ++i) {
+        error_code ec;
+        const auto buf = in_.prepare(2944);
+        const auto size = sock_.read(buf, ec);
+        if (ec) {
+            if (ec == errc::operation_would_block) {
+                break;
+            }
+            close(now, ec);
+            return false;
+        }
+        if (size == 0) {
+            eof = true;
+            break;
+        }
+        in_.commit(size);
+        if (static_cast<size_t>(size) < buffer_size(buf)) {
+            break;
+        }
+    }
+    bool signalled{false};
+    for (;;) {
+        try {
+            if (!in_.empty()) {
+                in_.consume(parse(now, in_.data()));
+            } else if (eof && !signalled) {
+                // An empty buffer signals the end of the stream to the parser, which completes a
+                // response that is delimited by the connection closing.
+                signalled = true;
+                parse(now, {});
+            } else {
+                break;
+            }
+        } catch (const std::exception&) {
+            close(now, make_error_code(eof ? errc::connection_reset : errc::bad_message));
+            return false;
+        }
+        if (!complete_) {
+            // The parser consumes all input unless it is paused.
+            if (eof && !signalled) {
+                continue;
+            }
+            break;
+        }
+        complete_ = false;
+        if (pending_.empty()) {
+            // Unsolicited response.
+            close(now, make_error_code(errc::bad_message));
+            return false;
+        }
+        const auto slot = pending_.front().slot;
+        pending_.pop_front();
+        ++client_.stats_.responses;
+        schedule_timeout();
+        const auto keep_alive = keep_alive_;
+        slot(now, {}, resp_);
+        if (state_ != State::Open) {
+            // Closed by the callback.
+            return false;
+        }
+        if (!keep_alive) {
+            close(now, make_error_code(errc::connection_reset));
+            return false;
+        }
+    }
+    if (eof) {
+        close(now, make_error_code(errc::connection_reset));
+        return false;
+    }
+    return true;
+}
+
+void Client::Conn::flush_output(CyclTime now)
+{
+    if (!out_.empty()) {
+        error_code ec;
+        const auto size = sock_.send(out_.data(), MSG_NOSIGNAL, ec);
+        if (ec) {
+            if (ec != errc::operation_would_block) {
+                close(now, ec);
+                return;
+            }
+        } else {
+            out_.consume(size);
+        }
+    }
+    if (out_.empty()) {
+        if (write_blocked_) {
+            sub_.set_events(EpollIn);
+            write_blocked_ = false;
+        }
+    } else if (!write_blocked_) {
+        sub_.set_events(EpollIn | EpollOut);
+        write_blocked_ = true;
+    }
+}
+
+void Client::Conn::schedule_timeout()
+{
+    if (pending_.empty()) {
+        tmr_.reset();
+    } else {
+        tmr_ = client_.reactor_.timer(pending_.front().expiry, Priority::Low,
+                                      bind<&Conn::on_timer>(this));
+    }
+}
+
+void Client::Conn::close(CyclTime now, error_code ec)
+{
+    state_ = State::Closed;
+    sub_.reset();
+    sock_.close();
+    tmr_.reset();
+    in_.clear();
+    out_.clear();
+    resp_.clear();
+    reset();
+    write_blocked_ = false;
+    complete_ = false;
+    keep_alive_ = true;
+
+    // Callbacks may send new requests on this connection.
+    auto pending = std::move(pending_);
+    pending_.clear();
+    for (const auto& p : pending) {
+        ++client_.stats_.errors;
+        if (ec == errc::timed_out) {
+            ++client_.stats_.timeouts;
+        }
+        p.slot(now, ec, resp_);
+    }
+}
+
+Client::Client(Reactor& r, const Endpoint& ep, const ClientOptions& opts)
+: reactor_{r}
+, ep_{ep}
+, opts_{opts}
+{
+    if (opts_.host.empty()) {
+        opts_.host = ep.protocol().family() == AF_UNIX ? "localhost"s : make_string(*ep.data());
+    }
+    const auto n = max<size_t>(opts_.max_conns, 1);
+    conns_.reserve(n);
+    for (size_t i{0}; i < n; ++i) {
+        conns_.push_back(make_unique<Conn>(*this));
+    }
+}
+
+Client::~Client() = default;
+
+size_t Client::pending() const noexcept
+{
+    size_t n{0};
+    for (const auto& conn : conns_) {
+        n += conn->pending();
+    }
+    return n;
+}
+
+void Client::send(CyclTime now, const ClientRequest& req, ClientSlot slot)
+{
+    if (req.method == Method::Head) {
+        throw invalid_argument{"HEAD requests are not supported"};
+    }
+    // Prefer the least loaded connection, unless it is full and another can be opened.
+    Conn* best{nullptr};
+    Conn* closed{nullptr};
+    for (const auto& conn : conns_) {
+        if (conn->closed()) {
+            if (!closed) {
+                closed = conn.get();
+            }
+        } else if (!best || conn->pending() < best->pending()) {
+            best = conn.get();
+        }
+    }
+    if (!best || (closed && best->pending() >= opts_.max_pipeline)) {
+        best = closed;
+    }
+    ++stats_.requests;
+    best->send(now, req, slot);
+}
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,201 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_CLIENT_HPP
+#define TOOLBOX_HTTP_CLIENT_HPP
+
+#include <toolbox/http/Parser.hpp>
+#include <toolbox/http/Response.hpp>
+#include <toolbox/net/StreamConnector.hpp>
+#include <toolbox/util/Slot.hpp>
+
+#include <deque>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace toolbox {
+inline namespace http {
+
+/// Completion callback for a client request. The error code is set if no response was received,
+/// in which case the response is empty. Possible errors are std::errc::timed_out,
+/// std::errc::connection_reset if the connection was closed before the response arrived,
+/// std::errc::bad_message if the response could not be parsed, and any error from connect().
+using ClientSlot = BasicSlot<void(CyclTime now, std::error_code ec, const Response& resp)>;
+
+struct ClientRequest {
+    Method method{Method::Get};
+    std::string_view target{"/"};
+    /// Additional header fields.
+    std::span<const std::pair<std::string_view, std::string_view>> headers{};
+    /// Content-Type header, which is omitted if empty.
+    std::string_view content_type{};
+    std::string_view body{};
+};
+
+struct ClientOptions {
+    /// Maximum number of connections to the endpoint.
+    std::size_t max_conns{4};
+    /// Number of outstanding requests on a connection beyond which another connection is opened,
+    /// if one is available. A value of one disables pipelining unless all connections are busy.
+    std::size_t max_pipeline{16};
+    /// Time allowed for each response to arrive, including any time spent connecting.
+    Duration timeout{std::chrono::seconds{5}};
+    /// Value of the Host header. Defaults to the endpoint's address.
+    std::string host{};
+};
+
+struct ClientStats {
+    /// Number of requests sent.
+    std::uint64_t requests{0};
+    /// Number of responses received.
+    std::uint64_t responses{0};
+    /// Number of requests that completed with an error, including timeouts.
+    std::uint64_t errors{0};
+    /// Number of requests that timed out.
+    std::uint64_t timeouts{0};
+    /// Number of connections established.
+    std::uint64_t connects{0};
+};
+
+/// Asynchronous HTTP/1.1 client for a single endpoint, which is driven by the Reactor.
+///
+/// Requests are spread over a small pool of keep-alive connections, which are opened on demand and
+/// reused for subsequent requests. Requests are pipelined, so each is written as soon as its
+/// connection is established, without waiting for the responses to earlier requests, and the
+/// responses are matched to the requests in the order that they were sent. If a response times
+/// out, or the connection fails, then the connection is closed and every request that is still
+/// outstanding on it completes with an error.
+///
+/// Requests for HEAD are not supported, because their responses cannot be framed by the parser.
+/// Callbacks may send further requests, but must not destroy the client. Outstanding callbacks are
+/// not invoked when the client is destroyed.
+class TOOLBOX_API Client {
+    class Conn
+    : public StreamConnector<Conn>
+    , BasicParser<Conn> {
+        friend StreamConnector<Conn>;
+        friend BasicParser<Conn>;
+
+      public:
+        explicit Conn(Client& client);
+        ~Conn();
+
+        // Copy.
+        Conn(const Conn&) = delete;
+        Conn& operator=(const Conn&) = delete;
+
+        // Move.
+        Conn(Conn&&) = delete;
+        Conn& operator=(Conn&&) = delete;
+
+        bool closed() const noexcept { return state_ == State::Closed; }
+        std::size_t pending() const noexcept { return pending_.size(); }
+
+        void send(CyclTime now, const ClientRequest& req, ClientSlot slot);
+
+      private:
+        enum class State { Closed, Connecting, Open };
+        struct Pending {
+            ClientSlot slot;
+            MonoTime expiry;
+        };
+
+        void on_sock_prepare(CyclTime now, IoSock& sock);
+        void on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& ep);
+        void on_sock_connect_error(CyclTime now, const std::exception& e);
+        void on_io_event(CyclTime now, int fd, unsigned events);
+        void on_timer(CyclTime now, Timer& tmr);
+
+        bool on_http_message_begin(CyclTime now) noexcept;
+        bool on_http_url(CyclTime now, std::string_view sv) noexcept;
+        bool on_http_status(CyclTime now, std::string_view sv) noexcept;
+        bool on_http_header_field(CyclTime now, std::string_view sv, First first) noexcept;
+        bool on_http_header_value(CyclTime now, std::string_view sv, First first) noexcept;
+        bool on_http_headers_end(CyclTime now) noexcept;
+        bool on_http_body(CyclTime now, std::string_view sv) noexcept;
+        bool on_http_message_end(CyclTime now) noexcept;
+        bool on_http_chunk_header(CyclTime now, std::size_t len) noexcept;
+        bool on_http_chunk_end(CyclTime now) noexcept;
+
+        void put(std::string_view sv);
+        /// Reads and parses all available input. Returns false if the peer closed the connection.
+        bool drain_input(CyclTime now);
+        void flush_output(CyclTime now);
+        void schedule_timeout();
+        /// Closes the connection, and completes the outstanding requests with the error.
+        void close(CyclTime now, std::error_code ec);
+
+        Client& client_;
+        State state_{State::Closed};
+        IoSock sock_;
+        Reactor::Handle sub_;
+        Timer tmr_;
+        Buffer in_, out_;
+        Response resp_;
+        std::deque<Pending> pending_;
+        bool write_blocked_{false}, keep_alive_{true}, complete_{false};
+    };
+
+  public:
+    using Endpoint = StreamEndpoint;
+
+    Client(Reactor& r, const Endpoint& ep, const ClientOptions& opts = {});
+    ~Client();
+
+    // Copy.
+    Client(const Client&) = delete;
+    Client& operator=(const Client&) = delete;
+
+    // Move.
+    Client(Client&&) = delete;
+    Client& operator=(Client&&) = delete;
+
+    const Endpoint& endpoint() const noexcept { return ep_; }
+    const ClientOptions& options() const noexcept { return opts_; }
+    const ClientStats& stats() const noexcept { return stats_; }
+    /// Returns the number of requests that have not yet completed.
+    std::size_t pending() const noexcept;
+
+    /// Sends the request, and invokes the slot when the response arrives or the request fails.
+    /// Throws std::invalid_argument for HEAD requests.
+    void send(CyclTime now, const ClientRequest& req, ClientSlot slot);
+    void get(CyclTime now, std::string_view target, ClientSlot slot)
+    {
+        send(now, {.method = Method::Get, .target = target}, slot);
+    }
+    void post(CyclTime now, std::string_view target, std::string_view content_type,
+              std::string_view body, ClientSlot slot)
+    {
+        send(now,
+             {.method = Method::Post,
+              .target = target,
+              .content_type = content_type,
+              .body = body},
+             slot);
+    }
+
+  private:
+    Reactor& reactor_;
+    const Endpoint ep_;
+    ClientOptions opts_;
+    ClientStats stats_;
+    std::vector<std::unique_ptr<Conn>> conns_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_CLIENT_HPP
@@ -0,0 +1,242 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Client.hpp"
+
+#include <toolbox/http/App.hpp>
+#include <toolbox/http/Serv.hpp>
+#include <toolbox/io/Reactor.ut.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+StreamSockServ make_listener(StreamEndpoint& ep)
+{
+    StreamSockServ serv{StreamProtocol::tcp4()};
+    serv.bind(parse_stream_endpoint("tcp4://127.0.0.1:0"));
+    serv.listen(SOMAXCONN);
+    serv.get_sock_name(ep);
+    return serv;
+}
+
+/// Serves /foo as the HttpServ example does, echoes the path and body for /echo, and returns 404
+/// for everything else.
+class TestApp final : public App {
+  public:
+    int timeouts{0};
+
+  protected:
+    void do_on_http_connect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    void do_on_http_disconnect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    void do_on_http_error(CyclTime /*now*/, const Endpoint& /*ep*/, const std::exception& /*e*/,
+                          http::OStream& /*os*/) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime /*now*/, const Endpoint& /*ep*/, const Request& req,
+                            http::OStream& os) override
+    {
+        if (req.path() == "/foo") {
+            os.reset(Status::Ok, TextPlain);
+            os << "Hello, Foo!";
+        } else if (req.path().starts_with("/echo")) {
+            os.reset(Status::Ok, TextPlain);
+            os << req.path() << ':' << req.body();
+        } else {
+            os.reset(Status::NotFound, TextPlain);
+            os << "Error 404 - Page not found";
+        }
+        os.commit();
+    }
+    void do_on_http_timeout(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override
+    {
+        ++timeouts;
+    }
+};
+
+/// Records the outcome of each request.
+struct Results {
+    void operator()(CyclTime /*now*/, error_code ec, const Response& resp)
+    {
+        errors.push_back(ec);
+        status_codes.push_back(resp.status_code());
+        bodies.push_back(resp.body());
+    }
+    size_t size() const noexcept { return errors.size(); }
+    vector<error_code> errors;
+    vector<int> status_codes;
+    vector<string> bodies;
+};
+
+struct Fixture {
+    Fixture()
+    : serv{CyclTime::now(), reactor, make_listener(ep), app}
+    {
+    }
+    StreamEndpoint ep;
+    Reactor reactor{1024};
+    TestApp app;
+    Serv serv;
+    Results results;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ClientSuite)
+
+BOOST_FIXTURE_TEST_CASE(ClientGetCase, Fixture)
+{
+    Client clnt{reactor, ep};
+    clnt.get(CyclTime::now(), "/foo", bind(&results));
+    clnt.get(CyclTime::now(), "/bar", bind(&results));
+    BOOST_CHECK_EQUAL(clnt.pending(), 2U);
+    BOOST_CHECK(poll_until(reactor, [&]() { return results.size() == 2; }));
+    BOOST_CHECK_EQUAL(clnt.pending(), 0U);
+
+    BOOST_CHECK(!results.errors[0]);
+    BOOST_CHECK_EQUAL(results.status_codes[0], 200);
+    BOOST_CHECK_EQUAL(results.bodies[0], "Hello, Foo!");
+    BOOST_CHECK(!results.errors[1]);
+    BOOST_CHECK_EQUAL(results.status_codes[1], 404);
+    BOOST_CHECK_EQUAL(results.bodies[1], "Error 404 - Page not found");
+
+    BOOST_CHECK_EQUAL(clnt.stats().requests, 2U);
+    BOOST_CHECK_EQUAL(clnt.stats().responses, 2U);
+    BOOST_CHECK_EQUAL(clnt.stats().errors, 0U);
+}
+
+BOOST_FIXTURE_TEST_CASE(ClientPostCase, Fixture)
+{
+    Client clnt{reactor, ep};
+    clnt.post(CyclTime::now(), "/echo", TextPlain, "hello", bind(&results));
+    clnt.post(CyclTime::now(), "/echo", TextPlain, "", bind(&results));
+    const pair<string_view, string_view> headers[]{{"X-Request-Id", "101"}};
+    clnt.send(CyclTime::now(), {.method = Method::Put, .target = "/echo/1", .headers = headers},
+              bind(&results));
+    BOOST_CHECK(poll_until(reactor, [&]() { return results.size() == 3; }));
+    BOOST_CHECK_EQUAL(results.bodies[0], "/echo:hello");
+    BOOST_CHECK_EQUAL(results.bodies[1], "/echo:");
+    BOOST_CHECK_EQUAL(results.bodies[2], "/echo/1:");
+}
+
+BOOST_FIXTURE_TEST_CASE(ClientPipelineCase, Fixture)
+{
+    // A single connection carries all of the requests, and the responses arrive in order.
+    Client clnt{reactor, ep, {.max_conns = 1}};
+    constexpr int N{200};
+    for (int i{0}; i < N; ++i) {
+        clnt.get(CyclTime::now(), "/echo/" + to_string(i), bind(&results));
+    }
+    BOOST_CHECK(poll_until(reactor, [&]() { return results.size() == N; }));
+    for (int i{0}; i < N; ++i) {
+        BOOST_CHECK_EQUAL(results.bodies[i], "/echo/" + to_string(i) + ':');
+    }
+    BOOST_CHECK_EQUAL(clnt.stats().connects, 1U);
+    BOOST_CHECK_EQUAL(clnt.stats().responses, N);
+}
+
+BOOST_FIXTURE_TEST_CASE(ClientPoolCase, Fixture)
+{
+    Client clnt{reactor, ep, {.max_conns = 3, .max_pipeline = 1}};
+    for (int i{0}; i < 6; ++i) {
+        clnt.get(CyclTime::now(), "/foo", bind(&results));
+    }
+    BOOST_CHECK(poll_until(reactor, [&]() { return results.size() == 6; }));
+    BOOST_CHECK_EQUAL(clnt.stats().connects, 3U);
+
+    // Idle connections are reused.
+    for (int i{0}; i < 3; ++i) {
+        clnt.get(CyclTime::now(), "/foo", bind(&results));
+    }
+    BOOST_CHECK(poll_until(reactor, [&]() { return results.size() == 9; }));
+    BOOST_CHECK_EQUAL(clnt.stats().connects, 3U);
+    BOOST_CHECK_EQUAL(clnt.stats().errors, 0U);
+}
+
+BOOST_FIXTURE_TEST_CASE(ServPoolCase, Fixture)
+{
+    {
+        Client clnt{reactor, ep, {.max_conns = 3, .max_pipeline = 1}};
+        for (int i{0}; i < 6; ++i) {
+            clnt.get(CyclTime::now(), "/foo", bind(&results));
+        }
+        BOOST_CHECK(poll_until(reactor, [&]() { return results.size() == 6; }));
+        BOOST_CHECK_EQUAL(serv.conn_pool().size(), 3U);
+        // The idle connections have returned their buffers to the cache.
+        BOOST_CHECK_GE(serv.buffer_cache().size(), 2U);
+    }
+    // The connections are returned to the pool when the client disconnects.
+    BOOST_CHECK(poll_until(reactor, [&]() { return serv.conn_pool().size() == 0; }));
+    BOOST_CHECK_GE(serv.conn_pool().capacity(), 3U);
+}
+
+BOOST_AUTO_TEST_CASE(ConnIdleCase)
+{
+    // Without a timeout, the reaper closes the silent connection at the start of the next second,
+    // rather than after the server's idle timeout.
+    Reactor r{1024};
+    TestApp app;
+    IdleReaper reaper{CyclTime::now(), r, 0s};
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.second.set_non_block();
+    new Conn{CyclTime::now(), r, std::move(socks.second), StreamEndpoint{}, app,
+             {.reaper = &reaper}};
+    BOOST_CHECK(poll_until(r, [&]() { return app.timeouts == 1; }));
+    char c;
+    BOOST_CHECK_EQUAL(os::read(socks.first.get(), &c, 1), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(ClientTimeoutCase)
+{
+    // The listener never accepts, so the request is never answered.
+    StreamEndpoint ep;
+    auto serv = make_listener(ep);
+
+    Reactor r{1024};
+    Results results;
+    Client clnt{r, ep, {.timeout = 20ms}};
+    clnt.get(CyclTime::now(), "/foo", bind(&results));
+    clnt.get(CyclTime::now(), "/foo", bind(&results));
+    BOOST_CHECK(poll_until(r, [&]() { return results.size() == 2; }));
+    BOOST_CHECK(results.errors[0] == errc::timed_out);
+    BOOST_CHECK(results.errors[1] == errc::timed_out);
+    BOOST_CHECK_EQUAL(results.status_codes[0], 0);
+    BOOST_CHECK_EQUAL(clnt.stats().timeouts, 2U);
+    BOOST_CHECK_EQUAL(clnt.pending(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(ClientConnectErrorCase)
+{
+    StreamEndpoint ep;
+    // Nothing is listening once the socket has been closed.
+    make_listener(ep).close();
+
+    Reactor r{1024};
+    Results results;
+    Client clnt{r, ep};
+    clnt.get(CyclTime::now(), "/foo", bind(&results));
+    BOOST_CHECK(poll_until(r, [&]() { return results.size() == 1; }));
+    BOOST_CHECK(results.errors[0] == errc::connection_refused);
+    BOOST_CHECK_EQUAL(clnt.stats().errors, 1U);
+    BOOST_CHECK_EQUAL(clnt.stats().connects, 0U);
+
+    BOOST_CHECK_THROW(clnt.send(CyclTime::now(), {.method = Method::Head}, bind(&results)),
+                      invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
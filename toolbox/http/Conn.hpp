@@ -18,50 +18,95 @@
 #define TOOLBOX_HTTP_CONN_HPP
 
 #include <toolbox/http/Parser.hpp>
+#include <toolbox/http/Producer.hpp>
 #include <toolbox/http/Request.hpp>
+#include <toolbox/http/RequestView.hpp>
+#include <toolbox/http/ResponseWriter.hpp>
+#include <toolbox/http/SimdParser.hpp>
 #include <toolbox/http/Stream.hpp>
+#include <toolbox/http/WebSocket.hpp>
+#include <toolbox/io/BufferCache.hpp>
 #include <toolbox/io/Disposer.hpp>
+#include <toolbox/io/Hook.hpp>
+#include <toolbox/io/IdleReaper.hpp>
 #include <toolbox/io/Reactor.hpp>
 #include <toolbox/net/Endpoint.hpp>
 #include <toolbox/net/IoSock.hpp>
+#include <toolbox/net/TcpInfo.hpp>
 #include <toolbox/util/Allocator.hpp>
 
 namespace toolbox {
 inline namespace http {
-class App;
+template <typename RequestT, typename StreamT = OStream>
+class BasicApp;
 
-template <typename RequestT, typename AppT>
-class BasicConn
+/// State that is shared by the connections of a server. Any of the members may be null.
+struct ConnShared {
+    /// The pool that the connection was allocated from, and is returned to when disposed.
+    SlabPool* conns{nullptr};
+    /// The cache that idle connections return their buffer storage to.
+    BufferCache* buffers{nullptr};
+    /// The reaper that expires idle connections. Connections without a reaper schedule a timer of
+    /// their own.
+    IdleReaper* reaper{nullptr};
+};
+
+/// The ParserT template may be BasicParser or BasicSimdParser, which invoke the same callbacks.
+///
+/// A connection is upgraded to a WebSocket when the App returns a handler from on_ws_upgrade(),
+/// after which the input is decoded as WebSocket frames. In this state, the idle timer sends a ping
+/// when the peer has been silent for an idle period, and closes the connection if the peer is still
+/// silent after another. Text messages are not validated as UTF-8.
+///
+/// Request bodies are streamed to the App if it returns true from on_http_headers(). Responses with
+/// a BodyProducer are sent with chunked encoding, and the producer is only called while the socket
+/// is accepting data, so it pauses while the socket is write-blocked and resumes on EpollOut. File
+/// bodies that are attached to a response are sent with sendfile() in the same way.
+///
+/// When shared state is supplied, the connection returns its buffer storage to the buffer cache
+/// whenever its buffers have been drained, so that idle connections hold no buffer storage, and it
+/// returns itself to the connection pool when disposed. Connections with a reaper are expired by it
+/// instead of scheduling an idle timer of their own.
+template <typename RequestT, typename AppT, template <typename> class ParserT = BasicParser>
+class BasicConn final
 : public Allocator
-, public BasicDisposer<BasicConn<RequestT, AppT>>
-, BasicParser<BasicConn<RequestT, AppT>> {
+, public BasicDisposer<BasicConn<RequestT, AppT, ParserT>>
+, public WebSocket
+, ParserT<BasicConn<RequestT, AppT, ParserT>> {
 
-    friend class BasicDisposer<BasicConn<RequestT, AppT>>;
-    friend class BasicParser<BasicConn<RequestT, AppT>>;
+    friend class BasicDisposer<BasicConn<RequestT, AppT, ParserT>>;
+    friend class ParserT<BasicConn<RequestT, AppT, ParserT>>;
 
+    using Parser = ParserT<BasicConn<RequestT, AppT, ParserT>>;
     using Request = RequestT;
     using App = AppT;
+    using Stream = typename AppT::Stream;
     // Automatically unlink when object is destroyed.
     using AutoUnlinkOption = boost::intrusive::link_mode<boost::intrusive::auto_unlink>;
 
-    static constexpr auto IdleTimeout = 5s;
-
-    using BasicParser<BasicConn<RequestT, AppT>>::method;
-    using BasicParser<BasicConn<RequestT, AppT>>::parse;
-    using BasicParser<BasicConn<RequestT, AppT>>::should_keep_alive;
+    using Parser::method;
+    using Parser::parse;
+    using Parser::pause;
+    using Parser::should_keep_alive;
 
   public:
     using Protocol = StreamProtocol;
     using Endpoint = StreamEndpoint;
 
-    BasicConn(CyclTime now, Reactor& r, IoSock&& sock, const Endpoint& ep, App& app)
-    : BasicParser<BasicConn<RequestT, AppT>>{Type::Request}
+    static constexpr auto IdleTimeout = 5s;
+
+    BasicConn(CyclTime now, Reactor& r, IoSock&& sock, const Endpoint& ep, App& app,
+              ConnShared shared = {})
+    : Parser{Type::Request}
     , reactor_{r}
     , sock_{std::move(sock)}
     , ep_{ep}
     , app_{app}
+    , shared_{shared}
+    , flush_hook_{bind<&BasicConn::on_flush>(this)}
     {
         sub_ = r.subscribe(*sock_, EpollIn, bind<&BasicConn::on_io_event>(this));
+        tcp_probe.set_fd(*sock_);
         schedule_timeout(now);
         app.on_http_connect(now, ep_);
     }
@@ -77,10 +122,19 @@ class BasicConn
     const Endpoint& endpoint() const noexcept { return ep_; }
     void clear() noexcept { req_.clear(); }
     boost::intrusive::list_member_hook<AutoUnlinkOption> list_hook;
+    /// Transport metrics, which are sampled while the probe is linked into a TcpInfoSampler.
+    TcpInfoProbe tcp_probe;
 
   protected:
     void dispose_now(CyclTime now) noexcept
     {
+        if (ws_) {
+            ws_->on_ws_close(now, *this, ws_code_); // noexcept
+        }
+        if (producer_) {
+            producer_->detach();
+            producer_->on_http_abort(now); // noexcept
+        }
         app_.on_http_disconnect(now, ep_); // noexcept
         // Best effort to drain any data still pending in the write buffer before the socket is
         // closed.
@@ -88,7 +142,18 @@ class BasicConn
             std::error_code ec;
             os::write(sock_.get(), out_.data(), ec); // noexcept
         }
-        delete this;
+        if (shared_.buffers) {
+            in_.clear();
+            out_.clear();
+            shared_.buffers->release(in_);
+            shared_.buffers->release(out_);
+        }
+        if (auto* const pool = shared_.conns; pool) {
+            this->~BasicConn();
+            pool->deallocate(this);
+        } else {
+            delete this;
+        }
     }
 
   private:
@@ -96,6 +161,7 @@ class BasicConn
     bool on_http_message_begin(CyclTime /*now*/) noexcept
     {
         in_progress_ = true;
+        streaming_ = false;
         req_.clear();
         return true;
     }
@@ -140,16 +206,29 @@ class BasicConn
         }
         return ret;
     }
-    bool on_http_headers_end(CyclTime /*now*/) noexcept
+    bool on_http_headers_end(CyclTime now) noexcept
     {
-        req_.set_method(method());
-        return true;
+        bool ret{false};
+        try {
+            req_.set_method(method());
+            req_.flush(); // May throw.
+            streaming_ = app_.on_http_headers(now, ep_, req_);
+            ret = true;
+        } catch (const std::exception& e) {
+            app_.on_http_error(now, ep_, e, os_);
+            this->dispose(now);
+        }
+        return ret;
     }
     bool on_http_body(CyclTime now, std::string_view sv) noexcept
     {
         bool ret{false};
         try {
-            req_.append_body(sv);
+            if (streaming_) {
+                app_.on_http_body(now, ep_, req_, sv);
+            } else {
+                req_.append_body(sv);
+            }
             ret = true;
         } catch (const std::exception& e) {
             app_.on_http_error(now, ep_, e, os_);
@@ -162,8 +241,24 @@ class BasicConn
         bool ret{false};
         try {
             in_progress_ = false;
-            req_.flush(); // May throw.
+            if (const auto key = ws_upgrade_key(req_); !key.empty()) {
+                if (auto* const handler = app_.on_ws_upgrade(now, ep_, req_); handler) {
+                    ws_upgrade(now, key, *handler);
+                    return true;
+                }
+            }
+            acquire(out_);
             app_.on_http_message(now, ep_, req_, os_);
+            if (auto file = os_.release_file(); file) {
+                // Stop parsing until the file has been sent.
+                pause();
+                file_ = std::move(file);
+            } else if (auto* const producer = os_.release_producer(); producer) {
+                // Stop parsing until the body has been produced.
+                pause();
+                producer->attach(bind<&BasicConn::on_resume>(this));
+                producer_ = producer;
+            }
             ret = true;
         } catch (const std::exception& e) {
             app_.on_http_error(now, ep_, e, os_);
@@ -173,12 +268,42 @@ class BasicConn
     }
     bool on_http_chunk_header(CyclTime /*now*/, std::size_t /*len*/) noexcept { return true; }
     bool on_http_chunk_end(CyclTime /*now*/) noexcept { return true; }
-    void on_timeout_timer(CyclTime now, Timer& /*tmr*/)
+    void on_timeout_timer(CyclTime now, Timer& /*tmr*/) { on_idle(now); }
+    void on_idle(CyclTime now)
     {
         auto lock = this->lock_this(now);
+        if (ws_ && !ws_closing_ && !ws_ping_) {
+            // Probe the silent peer before giving up on it.
+            try {
+                ws_ping_ = true;
+                ping();
+                schedule_timeout(now);
+                return;
+            } catch (const std::exception& e) {
+                app_.on_http_error(now, ep_, e, os_);
+                this->dispose(now);
+                return;
+            }
+        }
         app_.on_http_timeout(now, ep_);
         this->dispose(now);
     }
+    void on_flush(CyclTime now)
+    {
+        // The hook is only installed while WebSocket output is pending, or when an idle producer
+        // resumes.
+        flush_hook_.unlink();
+        auto lock = this->lock_this(now);
+        try {
+            if (!write_blocked_) {
+                flush_output(now);
+            }
+        } catch (const Exception&) {
+            // Already reported by the parser callbacks.
+        } catch (const std::exception& e) {
+            on_output_error(now, e);
+        }
+    }
     void on_io_event(CyclTime now, int fd, unsigned events)
     {
         auto lock = this->lock_this(now);
@@ -191,7 +316,7 @@ class BasicConn
             }
             // Do not attempt to flush the output buffer if it is empty or if we are still waiting
             // for the socket to become writable.
-            if (out_.empty() || (write_blocked_ && !(events & EpollOut))) {
+            if ((out_.empty() && !body_pending()) || (write_blocked_ && !(events & EpollOut))) {
                 return;
             }
             flush_output(now);
@@ -199,12 +324,21 @@ class BasicConn
             // Do not call on_http_error() here, because it will have already been called in one of
             // the noexcept parser callback functions.
         } catch (const std::exception& e) {
+            on_output_error(now, e);
+        }
+    }
+    void on_output_error(CyclTime now, const std::exception& e) noexcept
+    {
+        // The headers have already been sent once a body has started, so an error response cannot
+        // be written, and the connection is simply closed.
+        if (!body_pending()) {
             app_.on_http_error(now, ep_, e, os_);
-            this->dispose(now);
         }
+        this->dispose(now);
     }
     bool drain_input(CyclTime now, int fd)
     {
+        acquire(in_);
         // Limit the number of reads to avoid starvation.
         for (int i{0}; i < 4; ++i) {
             std::error_code ec;
@@ -232,17 +366,43 @@ class BasicConn
             }
         }
         flush_input(now);
+        if (in_.empty()) {
+            release(in_);
+        }
         // Reset timer.
         schedule_timeout(now);
         return true;
     }
-    void flush_input(CyclTime now) { in_.consume(parse(now, in_.data())); }
+    void flush_input(CyclTime now)
+    {
+        if (body_pending()) {
+            // Pipelined requests are parsed once the body of the current response is complete.
+            return;
+        }
+        if (!ws_) {
+            const auto n = parse(now, in_.data());
+            if (in_progress_) {
+                // A partial request may refer to the input buffer, which is about to be consumed.
+                req_.retain();
+            }
+            in_.consume(n);
+            if (!ws_) {
+                return;
+            }
+            // Any input that follows the upgrade request is framed.
+        }
+        ws_flush_input(now);
+    }
     void flush_output(CyclTime now)
     {
         // Attempt to flush buffered data.
-        out_.consume(sock_.write(out_.data()));
-        if (out_.empty()) {
-            if (!in_progress_ && !should_keep_alive()) {
+        write_output();
+        // Send more of the body while the socket accepts everything written.
+        while (out_.empty() && (file_ ? send_file(now) : producer_ && produce(now))) {
+            write_output();
+        }
+        if (out_.empty() && !file_) {
+            if (ws_ ? ws_closing_ : !producer_ && !in_progress_ && !should_keep_alive()) {
                 this->dispose(now);
                 return;
             }
@@ -251,31 +411,314 @@ class BasicConn
                 sub_.set_events(EpollIn);
                 write_blocked_ = false;
             }
+            if (!producer_) {
+                release(out_);
+            }
         } else if (!write_blocked_) {
             // Set the state to read-write if the entire buffer could not be written.
             sub_.set_events(EpollIn | EpollOut);
             write_blocked_ = true;
         }
     }
+    void write_output()
+    {
+        std::error_code ec;
+        const auto size = sock_.write(out_.data(), ec);
+        if (ec) {
+            // The socket may be full even though the previous write was complete.
+            if (ec != std::errc::operation_would_block) {
+                throw std::system_error{ec, "write"};
+            }
+            return;
+        }
+        out_.consume(size);
+    }
+    /// Returns false if the producer is idle.
+    bool produce(CyclTime now)
+    {
+        acquire(out_);
+        ChunkWriter w{out_};
+        if (!producer_->on_http_produce(now, w)) {
+            if (out_.empty()) {
+                return false;
+            }
+            // The idle timeout applies to the peer, which is accepting the body.
+            schedule_timeout(now);
+            return true;
+        }
+        w.finish();
+        auto* const producer = std::exchange(producer_, nullptr);
+        producer->detach();
+        end_body(now);
+        return true;
+    }
+    /// Returns false if the socket is full.
+    bool send_file(CyclTime now)
+    {
+        while (file_.size > 0) {
+            std::error_code ec;
+            const auto n = os::sendfile(sock_.get(), file_.fh.get(), file_.offset, file_.size, ec);
+            if (ec) {
+                if (ec != std::errc::operation_would_block) {
+                    throw std::system_error{ec, "sendfile"};
+                }
+                return false;
+            }
+            if (n == 0) {
+                // The file was truncated, so the response cannot be completed.
+                throw std::system_error{make_error_code(std::errc::io_error), "sendfile"};
+            }
+            file_.size -= n;
+            // The idle timeout applies to the peer, which is accepting the body.
+            schedule_timeout(now);
+        }
+        file_ = {};
+        end_body(now);
+        return true;
+    }
+    bool body_pending() const noexcept { return producer_ || file_; }
+    void acquire(Buffer& buf) noexcept
+    {
+        if (shared_.buffers) {
+            shared_.buffers->acquire(buf);
+        }
+    }
+    /// The buffer must be empty.
+    void release(Buffer& buf) noexcept
+    {
+        if (shared_.buffers) {
+            shared_.buffers->release(buf);
+        }
+    }
+    void end_body(CyclTime now)
+    {
+        // Parse any requests that were pipelined behind the response.
+        if (!in_.empty()) {
+            flush_input(now);
+        }
+    }
+    void on_resume(CyclTime /*now*/)
+    {
+        // The producer is called from the flush hook, because it may resume from within a callback.
+        if (!write_blocked_ && !flush_hook_.is_linked()) {
+            reactor_.add_hook(flush_hook_);
+        }
+    }
     void schedule_timeout(CyclTime now)
     {
+        if (shared_.reaper) {
+            shared_.reaper->touch(now.mono_time(), idle_);
+            return;
+        }
         const auto timeout = std::chrono::ceil<Seconds>(now.mono_time() + IdleTimeout);
         tmr_ = reactor_.timer(timeout, Priority::Low, bind<&BasicConn::on_timeout_timer>(this));
     }
 
+    void ws_upgrade(CyclTime now, std::string_view key, WsHandler& handler)
+    {
+        put("HTTP/1.1 101 Switching Protocols\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Accept: ");
+        put(ws_accept_key(key));
+        put("\r\n\r\n");
+        // Stop parsing at the end of the upgrade request.
+        pause();
+        ws_ = &handler;
+        handler.on_ws_open(now, *this);
+    }
+    void ws_flush_input(CyclTime now)
+    {
+        // Any input shows that the peer is alive.
+        ws_ping_ = false;
+        while (!ws_closing_) {
+            WsHeader h;
+            const auto n = parse_ws_header(in_.data(), h);
+            if (n == 0) {
+                break;
+            }
+            if (const auto code = ws_check(h); code != WsClose::Normal) {
+                ws_close(code, {});
+                break;
+            }
+            if (in_.size() < n + h.len) {
+                // Wait for the rest of the payload.
+                break;
+            }
+            char* const payload{in_.rptr() + n};
+            const std::size_t len{h.len};
+            // Client frames are always masked.
+            ws_mask(payload, len, h.mask);
+            ws_on_frame(now, h, {payload, len});
+            in_.consume(n + len);
+        }
+        if (ws_closing_) {
+            in_.clear();
+        }
+    }
+    /// Returns WsClose::Normal if the frame header is valid in the current state.
+    WsClose ws_check(const WsHeader& h) const noexcept
+    {
+        if (h.rsv != 0 || !h.masked) {
+            return WsClose::ProtocolError;
+        }
+        switch (h.opcode) {
+        case WsOpcode::Text:
+        case WsOpcode::Binary:
+            if (ws_msg_op_ != WsOpcode::Continuation) {
+                // The previous message is incomplete.
+                return WsClose::ProtocolError;
+            }
+            break;
+        case WsOpcode::Continuation:
+            if (ws_msg_op_ == WsOpcode::Continuation) {
+                // There is no message to continue.
+                return WsClose::ProtocolError;
+            }
+            break;
+        case WsOpcode::Close:
+        case WsOpcode::Ping:
+        case WsOpcode::Pong:
+            // Control frames may be interleaved with fragments, but may not be fragmented.
+            if (!h.fin || h.len > 125) {
+                return WsClose::ProtocolError;
+            }
+            return WsClose::Normal;
+        default:
+            return WsClose::ProtocolError;
+        }
+        if (h.len > MaxMessageSize - ws_msg_.size()) {
+            return WsClose::TooBig;
+        }
+        return WsClose::Normal;
+    }
+    void ws_on_frame(CyclTime now, const WsHeader& h, std::string_view payload)
+    {
+        switch (h.opcode) {
+        case WsOpcode::Text:
+        case WsOpcode::Binary:
+            if (h.fin) {
+                ws_->on_ws_message(now, *this, h.opcode, payload);
+            } else {
+                ws_msg_op_ = h.opcode;
+                ws_msg_.assign(payload);
+            }
+            break;
+        case WsOpcode::Continuation:
+            ws_msg_.append(payload);
+            if (h.fin) {
+                const auto opcode = ws_msg_op_;
+                ws_msg_op_ = WsOpcode::Continuation;
+                ws_->on_ws_message(now, *this, opcode, ws_msg_);
+                ws_msg_.clear();
+            }
+            break;
+        case WsOpcode::Ping:
+            if (!ws_closing_) {
+                ws_write(WsOpcode::Pong, payload);
+            }
+            break;
+        case WsOpcode::Pong:
+            break;
+        case WsOpcode::Close:
+            if (payload.size() == 1) {
+                ws_close(WsClose::ProtocolError, {});
+            } else if (payload.empty()) {
+                ws_close(WsClose::NoStatus, {});
+            } else {
+                const auto* const p = reinterpret_cast<const unsigned char*>(payload.data());
+                const auto code = static_cast<std::uint16_t>(p[0] << 8 | p[1]);
+                // Echo the peer's status code, unless it is not one that may be sent.
+                ws_close(is_valid_close(code) ? static_cast<WsClose>(code) : WsClose::ProtocolError,
+                         {});
+            }
+            break;
+        }
+    }
+    /// Queues a control frame, which is not subject to the high-water mark.
+    void ws_write(WsOpcode opcode, std::string_view payload)
+    {
+        char head[MaxWsHeaderSize];
+        const auto n = put_ws_header(head, opcode, payload.size());
+        ws_put({head, n}, payload);
+    }
+    void ws_put(std::string_view head, std::string_view payload)
+    {
+        put(head);
+        put(payload);
+        if (!write_blocked_ && !flush_hook_.is_linked()) {
+            reactor_.add_hook(flush_hook_);
+        }
+    }
+    void ws_close(WsClose code, std::string_view reason)
+    {
+        if (ws_closing_) {
+            return;
+        }
+        char payload[125];
+        std::size_t len{0};
+        if (code != WsClose::NoStatus) {
+            const auto val = static_cast<std::uint16_t>(code);
+            payload[0] = static_cast<char>(val >> 8);
+            payload[1] = static_cast<char>(val);
+            reason = reason.substr(0, sizeof(payload) - 2);
+            std::memcpy(payload + 2, reason.data(), reason.size());
+            len = 2 + reason.size();
+        }
+        ws_write(WsOpcode::Close, {payload, len});
+        // The connection is closed once the close frame has been written.
+        ws_closing_ = true;
+        ws_code_ = code;
+    }
+    const Endpoint& do_endpoint() const noexcept override { return ep_; }
+    std::size_t do_queued() const noexcept override { return out_.size(); }
+    void do_send(std::string_view head, std::string_view payload) override
+    {
+        if (ws_closing_) {
+            return;
+        }
+        if (out_.size() + head.size() + payload.size() > max_queued()) {
+            ws_close(WsClose::PolicyViolation, "slow consumer");
+            return;
+        }
+        ws_put(head, payload);
+    }
+    void do_close(WsClose code, std::string_view reason) override { ws_close(code, reason); }
+    void put(std::string_view sv)
+    {
+        acquire(out_);
+        const auto buf = out_.prepare(sv.size());
+        std::memcpy(buf.data(), sv.data(), sv.size());
+        out_.commit(sv.size());
+    }
+
     Reactor& reactor_;
     IoSock sock_;
     Endpoint ep_;
     App& app_;
+    const ConnShared shared_;
     Reactor::Handle sub_;
     Timer tmr_;
+    IdleEntry idle_{bind<&BasicConn::on_idle>(this)};
+    Hook flush_hook_;
     Buffer in_, out_;
     Request req_;
-    OStream os_{out_};
-    bool in_progress_{false}, write_blocked_{false};
+    Stream os_{out_};
+    bool in_progress_{false}, write_blocked_{false}, streaming_{false};
+    BodyProducer* producer_{nullptr};
+    FileBody file_;
+    WsHandler* ws_{nullptr};
+    // The opcode of the fragmented message in progress, if any.
+    WsOpcode ws_msg_op_{WsOpcode::Continuation};
+    std::string ws_msg_;
+    WsClose ws_code_{WsClose::Abnormal};
+    bool ws_closing_{false}, ws_ping_{false};
 };
 
-using Conn = BasicConn<Request, App>;
+using Conn = BasicConn<Request, BasicApp<Request>>;
+using ViewConn = BasicConn<RequestView, BasicApp<RequestView>>;
+using WriterConn = BasicConn<Request, BasicApp<Request, ResponseWriter>>;
+using ViewWriterConn = BasicConn<RequestView, BasicApp<RequestView, ResponseWriter>>;
 
 } // namespace http
 } // namespace toolbox
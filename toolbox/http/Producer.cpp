@@ -0,0 +1,57 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Producer.hpp"
+
+#include <charconv>
+#include <cstring>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+
+ChunkWriter::~ChunkWriter() = default;
+
+void ChunkWriter::write(string_view data)
+{
+    if (data.empty()) {
+        return;
+    }
+    // The chunk size is hexadecimal, without leading zeros.
+    char head[2 * sizeof(size_t) + 2];
+    auto* const end = to_chars(head, head + 2 * sizeof(size_t), data.size(), 16).ptr;
+    end[0] = '\r';
+    end[1] = '\n';
+    const size_t n = end + 2 - head;
+    const auto buf = buf_.prepare(n + data.size() + 2);
+    auto* const p = static_cast<char*>(buf.data());
+    memcpy(p, head, n);
+    memcpy(p + n, data.data(), data.size());
+    memcpy(p + n + data.size(), "\r\n", 2);
+    buf_.commit(n + data.size() + 2);
+}
+
+void ChunkWriter::finish()
+{
+    constexpr string_view LastChunk{"0\r\n\r\n"};
+    const auto buf = buf_.prepare(LastChunk.size());
+    memcpy(buf.data(), LastChunk.data(), LastChunk.size());
+    buf_.commit(LastChunk.size());
+}
+
+BodyProducer::~BodyProducer() = default;
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,130 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_PRODUCER_HPP
+#define TOOLBOX_HTTP_PRODUCER_HPP
+
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/io/Handle.hpp>
+#include <toolbox/sys/Time.hpp>
+#include <toolbox/util/Slot.hpp>
+
+namespace toolbox {
+inline namespace http {
+
+/// Writes the body of a chunked response to the connection's output buffer, where each write is
+/// framed as a single chunk.
+class TOOLBOX_API ChunkWriter {
+  public:
+    /// The amount of output that a producer should aim to write in each call. The connection only
+    /// calls the producer once the socket has accepted all previous output, so this bounds the
+    /// memory held by each connection, regardless of the size of the body.
+    static constexpr std::size_t HighWater{1 << 16};
+
+    explicit ChunkWriter(Buffer& buf) noexcept
+    : buf_{buf}
+    {
+    }
+    ~ChunkWriter();
+
+    // Copy.
+    ChunkWriter(const ChunkWriter&) = delete;
+    ChunkWriter& operator=(const ChunkWriter&) = delete;
+
+    // Move.
+    ChunkWriter(ChunkWriter&&) = delete;
+    ChunkWriter& operator=(ChunkWriter&&) = delete;
+
+    /// Returns the number of bytes that may be written before the high-water mark is reached.
+    std::size_t available() const noexcept
+    {
+        const auto size = buf_.size();
+        return size < HighWater ? HighWater - size : 0;
+    }
+    /// Writes the data as a single chunk. Empty data is ignored, because an empty chunk would
+    /// terminate the body.
+    void write(std::string_view data);
+    /// Writes the last chunk, which terminates the body. Called by the connection once the producer
+    /// has completed.
+    void finish();
+
+  private:
+    Buffer& buf_;
+};
+
+/// Source of a chunked response body, which is attached to a response with the reset() overload of
+/// the response stream that takes a producer.
+///
+/// The connection pulls the body from the producer, and only while the socket is accepting data,
+/// so a slow client applies back-pressure to the producer instead of the body accumulating in
+/// memory. Requests that are pipelined behind the response are not processed until the body is
+/// complete. The producer must outlive the response, or until on_http_abort() is called.
+class TOOLBOX_API BodyProducer {
+  public:
+    using Slot = BasicSlot<void(CyclTime)>;
+
+    BodyProducer() noexcept = default;
+    virtual ~BodyProducer();
+
+    // Copy.
+    BodyProducer(const BodyProducer&) = delete;
+    BodyProducer& operator=(const BodyProducer&) = delete;
+
+    // Move.
+    BodyProducer(BodyProducer&&) = delete;
+    BodyProducer& operator=(BodyProducer&&) = delete;
+
+    /// Writes the next part of the body, and returns true once the body is complete. A producer
+    /// that returns false without writing anything is idle, and is not called again until it calls
+    /// resume().
+    bool on_http_produce(CyclTime now, ChunkWriter& w) { return do_on_http_produce(now, w); }
+    /// Called if the connection closes before the body is complete.
+    void on_http_abort(CyclTime now) noexcept { do_on_http_abort(now); }
+
+    /// Signals that an idle producer has more of the body to write. The producer is called again at
+    /// the end of the current Reactor cycle. Does nothing if the producer is not attached to a
+    /// connection.
+    void resume(CyclTime now)
+    {
+        if (resume_slot_) {
+            resume_slot_(now);
+        }
+    }
+    /// Called by the connection when the response starts and ends.
+    void attach(Slot slot) noexcept { resume_slot_ = slot; }
+    void detach() noexcept { resume_slot_ = Slot{}; }
+
+  protected:
+    virtual bool do_on_http_produce(CyclTime now, ChunkWriter& w) = 0;
+    virtual void do_on_http_abort(CyclTime now) noexcept = 0;
+
+  private:
+    Slot resume_slot_;
+};
+
+/// A response body that is sent from a file with sendfile(), so that it is never copied into the
+/// output buffer. The body is attached to a response after the headers have been committed, and
+/// the headers must include a Content-Length of the number of bytes to send.
+struct FileBody {
+    FileHandle fh{};
+    off_t offset{0};
+    std::size_t size{0};
+    explicit operator bool() const noexcept { return !fh.empty(); }
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_PRODUCER_HPP
@@ -0,0 +1,357 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Producer.hpp"
+
+#include "App.hpp"
+#include "Conn.hpp"
+#include "ResponseWriter.hpp"
+#include "Stream.hpp"
+
+#include <toolbox/net/IoSock.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <charconv>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+/// Writes the body in parts of up to the writer's available space, and may be told to idle.
+class TestProducer final : public BodyProducer {
+  public:
+    explicit TestProducer(size_t total)
+    : total_{total}
+    {
+    }
+    size_t produced{0};
+    int calls{0};
+    bool idle{false}, fail{false}, aborted{false};
+
+  protected:
+    bool do_on_http_produce(CyclTime /*now*/, ChunkWriter& w) override
+    {
+        ++calls;
+        if (fail) {
+            throw runtime_error{"produce"};
+        }
+        if (idle) {
+            return false;
+        }
+        const auto n = min(w.available(), total_ - produced);
+        const string part(n, static_cast<char>('a' + calls % 26));
+        w.write(part);
+        produced += n;
+        return produced == total_;
+    }
+    void do_on_http_abort(CyclTime /*now*/) noexcept override { aborted = true; }
+
+  private:
+    const size_t total_;
+};
+
+class TestApp final : public App {
+  public:
+    explicit TestApp(TestProducer& producer)
+    : producer_{producer}
+    {
+    }
+    vector<string> events;
+
+  protected:
+    void do_on_http_connect(CyclTime /*now*/, const Endpoint& /*ep*/) override {}
+    void do_on_http_disconnect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    void do_on_http_error(CyclTime /*now*/, const Endpoint& /*ep*/, const std::exception& e,
+                          http::OStream& /*os*/) noexcept override
+    {
+        events.emplace_back("error:"s + e.what());
+    }
+    bool do_on_http_headers(CyclTime /*now*/, const Endpoint& /*ep*/, const Request& req) override
+    {
+        return req.path() == "/upload";
+    }
+    void do_on_http_body(CyclTime /*now*/, const Endpoint& /*ep*/, const Request& /*req*/,
+                         string_view data) override
+    {
+        events.emplace_back("body:" + string{data});
+    }
+    void do_on_http_message(CyclTime /*now*/, const Endpoint& /*ep*/, const Request& req,
+                            http::OStream& os) override
+    {
+        events.emplace_back("message:" + string{req.path()} + ':' + string{req.body()});
+        if (req.path() == "/download") {
+            os.reset(Status::Ok, TextPlain, producer_);
+        } else {
+            os.reset(Status::Ok, TextPlain);
+            os << req.path();
+        }
+        os.commit();
+    }
+    void do_on_http_timeout(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+
+  private:
+    TestProducer& producer_;
+};
+
+/// The client end of a connection to a BasicConn over a socket pair.
+class Peer {
+  public:
+    Peer(Reactor& r, App& app)
+    : r_{r}
+    {
+        auto socks = socketpair(UnixStreamProtocol{});
+        socks.first.set_non_block();
+        socks.second.set_non_block();
+        sock_ = std::move(socks.first);
+        new Conn{CyclTime::now(), r, std::move(socks.second), StreamEndpoint{}, app};
+    }
+    ~Peer() { close(); }
+    void close()
+    {
+        if (sock_) {
+            sock_.close();
+            r_.poll(CyclTime::now(), 0ms);
+        }
+    }
+    void write(string_view sv)
+    {
+        os::write(sock_.get(), sv.data(), sv.size());
+        poll();
+    }
+    /// Runs the reactor, including the end of cycle hooks that flush output.
+    void poll()
+    {
+        for (int i{0}; i < 3; ++i) {
+            r_.poll(CyclTime::now(), 0ms);
+        }
+    }
+    /// Returns all of the data that is available to read.
+    string read()
+    {
+        string out;
+        char buf[4096];
+        for (;;) {
+            error_code ec;
+            const auto n = os::read(sock_.get(), buf, sizeof(buf), ec);
+            if (ec || n == 0) {
+                break;
+            }
+            out.append(buf, n);
+        }
+        return out;
+    }
+
+  private:
+    Reactor& r_;
+    IoSock sock_;
+};
+
+/// Decodes a chunked body, and returns the remaining input after the last chunk, or nullopt if the
+/// body is incomplete.
+optional<string_view> dechunk(string_view sv, string& body)
+{
+    for (;;) {
+        const auto pos = sv.find("\r\n");
+        if (pos == string_view::npos) {
+            return nullopt;
+        }
+        size_t len{0};
+        from_chars(sv.data(), sv.data() + pos, len, 16);
+        if (sv.size() < pos + 2 + len + 2) {
+            return nullopt;
+        }
+        body.append(sv.substr(pos + 2, len));
+        sv.remove_prefix(pos + 2 + len + 2);
+        if (len == 0) {
+            return sv;
+        }
+    }
+}
+
+constexpr auto DownloadHead =        //
+    "HTTP/1.1 200 OK\r\n"            //
+    "Cache-Control: no-cache\r\n"    //
+    "Content-Type: text/plain\r\n"   //
+    "Transfer-Encoding: chunked\r\n" //
+    "\r\n"sv;
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ProducerSuite)
+
+BOOST_AUTO_TEST_CASE(ChunkWriterCase)
+{
+    Buffer buf;
+    ChunkWriter w{buf};
+    BOOST_TEST(w.available() == ChunkWriter::HighWater);
+    w.write("hello");
+    w.write("");
+    w.write(string(26, 'x'));
+    w.finish();
+    BOOST_TEST(buf.str() == "5\r\nhello\r\n1a\r\n" + string(26, 'x') + "\r\n0\r\n\r\n");
+    BOOST_TEST(w.available() == ChunkWriter::HighWater - buf.size());
+}
+
+BOOST_AUTO_TEST_CASE(ChunkedHeadersCase)
+{
+    TestProducer producer{0};
+    Buffer buf1, buf2;
+    http::OStream os{buf1};
+    os.reset(Status::Ok, TextPlain, producer);
+    os.commit();
+    BOOST_TEST(buf1.str() == DownloadHead);
+    BOOST_TEST(os.release_producer() == &producer);
+    BOOST_TEST(os.release_producer() == nullptr);
+
+    ResponseWriter w{buf2};
+    w.reset(Status::Ok, TextPlain, producer);
+    w.commit();
+    BOOST_TEST(buf2.str() == DownloadHead);
+    BOOST_TEST(w.release_producer() == &producer);
+
+    // A regular response releases the producer.
+    w.reset(Status::Ok, TextPlain, producer);
+    w.reset(Status::Ok, TextPlain);
+    BOOST_TEST(w.release_producer() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(StreamBodyCase)
+{
+    Reactor r;
+    TestProducer producer{0};
+    TestApp app{producer};
+    Peer peer{r, app};
+
+    peer.write("POST /upload HTTP/1.1\r\nContent-Length: 10\r\n\r\nhello");
+    peer.write("world");
+    peer.write("POST /buffered HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello");
+    const vector<string> events{"body:hello", "body:world", "message:/upload:",
+                                "message:/buffered:hello"};
+    BOOST_TEST(app.events == events, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(ChunkedCase)
+{
+    Reactor r;
+    TestProducer producer{100'000};
+    TestApp app{producer};
+    Peer peer{r, app};
+
+    // The pipelined request is answered after the body is complete.
+    peer.write("GET /download HTTP/1.1\r\n\r\nGET /next HTTP/1.1\r\n\r\n");
+    const auto out = peer.read();
+    BOOST_TEST(out.starts_with(DownloadHead));
+    string body;
+    const auto rest = dechunk(string_view{out}.substr(DownloadHead.size()), body);
+    BOOST_TEST_REQUIRE(rest.has_value());
+    BOOST_TEST(body.size() == 100'000U);
+    BOOST_TEST(rest->starts_with("HTTP/1.1 200 OK\r\n"));
+    BOOST_TEST(rest->ends_with("\r\n\r\n/next"));
+    BOOST_TEST(!producer.aborted);
+}
+
+BOOST_AUTO_TEST_CASE(BackPressureCase)
+{
+    constexpr size_t Total{16 << 20};
+    Reactor r;
+    TestProducer producer{Total};
+    TestApp app{producer};
+    Peer peer{r, app};
+
+    peer.write("GET /download HTTP/1.1\r\n\r\n");
+    // The producer pauses when the socket is full.
+    const auto calls = producer.calls;
+    BOOST_TEST(producer.produced < Total);
+    peer.poll();
+    BOOST_TEST(producer.calls == calls);
+
+    // And resumes as the peer reads.
+    string out;
+    for (int i{0}; i < 10'000 && !out.ends_with("\r\n0\r\n\r\n"); ++i) {
+        out += peer.read();
+        peer.poll();
+    }
+    BOOST_TEST(producer.produced == Total);
+    string body;
+    const auto rest = dechunk(string_view{out}.substr(DownloadHead.size()), body);
+    BOOST_TEST_REQUIRE(rest.has_value());
+    BOOST_TEST(body.size() == Total);
+    BOOST_TEST(rest->empty());
+}
+
+BOOST_AUTO_TEST_CASE(ResumeCase)
+{
+    Reactor r;
+    TestProducer producer{10};
+    producer.idle = true;
+    TestApp app{producer};
+    Peer peer{r, app};
+
+    peer.write("GET /download HTTP/1.1\r\n\r\n");
+    BOOST_TEST(peer.read() == DownloadHead);
+    const auto calls = producer.calls;
+    peer.poll();
+    BOOST_TEST(producer.calls == calls);
+
+    producer.idle = false;
+    producer.resume(CyclTime::now());
+    peer.poll();
+    BOOST_TEST(peer.read() == "a\r\n" + string(10, 'a' + producer.calls % 26) + "\r\n0\r\n\r\n");
+
+    // The producer is detached once the body is complete.
+    producer.resume(CyclTime::now());
+    BOOST_TEST(!producer.aborted);
+}
+
+BOOST_AUTO_TEST_CASE(AbortCase)
+{
+    Reactor r;
+    TestProducer producer{10};
+    producer.idle = true;
+    TestApp app{producer};
+    Peer peer{r, app};
+
+    peer.write("GET /download HTTP/1.1\r\n\r\n");
+    peer.close();
+    BOOST_TEST(producer.aborted);
+    // Resuming a detached producer does nothing.
+    producer.resume(CyclTime::now());
+}
+
+BOOST_AUTO_TEST_CASE(ProduceErrorCase)
+{
+    Reactor r;
+    TestProducer producer{10};
+    producer.idle = true;
+    TestApp app{producer};
+    Peer peer{r, app};
+
+    peer.write("GET /download HTTP/1.1\r\n\r\n");
+    BOOST_TEST(peer.read() == DownloadHead);
+
+    // The headers have been sent, so the connection is closed without an error response.
+    producer.fail = true;
+    producer.resume(CyclTime::now());
+    peer.poll();
+    BOOST_TEST(producer.aborted);
+    BOOST_TEST(peer.read().empty());
+    const vector<string> events{"message:/download:"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(app.events.begin(), app.events.end(), events.begin(),
+                                  events.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
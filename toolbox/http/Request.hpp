@@ -52,6 +52,8 @@ class TOOLBOX_API Request : public BasicUrl<Request> {
         body_.clear();
     }
     void flush() { parse(); }
+    /// The request owns its data, so the input buffer can be consumed at any time.
+    void retain() noexcept {}
     void set_method(Method method) noexcept { method_ = method; }
     void append_url(std::string_view sv) { url_.append(sv.data(), sv.size()); }
     void append_header_field(std::string_view sv, First first)
@@ -0,0 +1,115 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RequestView.hpp"
+
+#include <cstring>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+// Typically enough for all of the values that span a single read.
+constexpr size_t ArenaBlockSize{4096};
+} // namespace
+
+RequestView::~RequestView() = default;
+
+void RequestView::retain()
+{
+    const auto retain = [this](string_view& val) {
+        if (!val.empty() && !arena_.owns(val.data())) {
+            val = arena_.copy(val);
+        }
+    };
+    retain(url_);
+    // Headers before the last one that was retained are already in the arena, because any
+    // subsequent fragments are appended in the arena.
+    for (auto i = retained_; i < headers_.size(); ++i) {
+        retain(headers_[i].first);
+        retain(headers_[i].second);
+    }
+    retained_ = headers_.empty() ? 0 : headers_.size() - 1;
+    if (!body_.empty() && body_.data() != body_buf_.data()) {
+        body_buf_.assign(body_);
+        body_ = body_buf_;
+    }
+}
+
+void RequestView::append_body(string_view sv)
+{
+    if (body_.empty()) {
+        body_ = sv;
+    } else if (body_.data() == body_buf_.data()) {
+        // Appended in place, so that a body of many chunks is not copied repeatedly.
+        body_buf_.append(sv);
+        body_ = body_buf_;
+    } else if (body_.data() + body_.size() == sv.data()) {
+        // The parser has split a body that is contiguous in the input buffer.
+        body_ = {body_.data(), body_.size() + sv.size()};
+    } else {
+        body_buf_.reserve(body_.size() + sv.size());
+        body_buf_.assign(body_).append(sv);
+        body_ = body_buf_;
+    }
+}
+
+string_view RequestView::Arena::copy(string_view lhs, string_view rhs)
+{
+    const auto size = lhs.size() + rhs.size();
+    if (cur_ < blocks_.size() && used_ + size > blocks_[cur_].size) {
+        ++cur_;
+        used_ = 0;
+    }
+    if (cur_ == blocks_.size() || blocks_[cur_].size < size) {
+        const auto block_size = max(size, ArenaBlockSize);
+        blocks_.insert(blocks_.begin() + cur_, Block{make_unique<char[]>(block_size), block_size});
+        used_ = 0;
+    }
+    auto* const ptr = blocks_[cur_].data.get() + used_;
+    memcpy(ptr, lhs.data(), lhs.size());
+    memcpy(ptr + lhs.size(), rhs.data(), rhs.size());
+    used_ += size;
+    return {ptr, size};
+}
+
+bool RequestView::Arena::owns(const char* ptr) const noexcept
+{
+    for (size_t i{0}; i <= cur_ && i < blocks_.size(); ++i) {
+        const auto* const data = blocks_[i].data.get();
+        if (ptr >= data && ptr < data + blocks_[i].size) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t RequestView::Arena::capacity() const noexcept
+{
+    size_t n{0};
+    for (const auto& block : blocks_) {
+        n += block.size;
+    }
+    return n;
+}
+
+void RequestView::Arena::clear() noexcept
+{
+    erase_if(blocks_, [](const auto& block) { return block.size > ArenaBlockSize; });
+    cur_ = used_ = 0;
+}
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,141 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_REQUESTVIEW_HPP
+#define TOOLBOX_HTTP_REQUESTVIEW_HPP
+
+#include <toolbox/http/Url.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace toolbox {
+inline namespace http {
+
+using HeaderViews = std::vector<std::pair<std::string_view, std::string_view>>;
+
+/// Zero-copy alternative to Request, whose URL, headers and body are views into the connection's
+/// input buffer. The views remain valid until the on_http_message callback returns.
+///
+/// A value is only copied if it spans reads, or if a chunked body arrives in more than one chunk.
+/// The copies are made into an arena that belongs to the connection, and whose memory is reused by
+/// subsequent requests, so that a connection does not allocate in the steady state. A body that is
+/// copied is appended to a growable buffer instead, so that the cost of a body that arrives in many
+/// chunks remains linear in its size.
+class TOOLBOX_API RequestView : public BasicUrl<RequestView> {
+  public:
+    RequestView() = default;
+    ~RequestView();
+
+    // Copy.
+    RequestView(const RequestView&) = delete;
+    RequestView& operator=(const RequestView&) = delete;
+
+    // Move.
+    RequestView(RequestView&&) = delete;
+    RequestView& operator=(RequestView&&) = delete;
+
+    Method method() const noexcept { return method_; }
+    const std::string_view& url() const noexcept { return url_; }
+    const HeaderViews& headers() const noexcept { return headers_; }
+    std::string_view body() const noexcept { return body_; }
+    /// Returns the memory that is held for copies of values.
+    std::size_t capacity() const noexcept { return arena_.capacity() + body_buf_.capacity(); }
+
+    void clear() noexcept
+    {
+        method_ = Method::Get;
+        url_ = {};
+        headers_.clear();
+        retained_ = 0;
+        body_ = {};
+        arena_.clear();
+        // Release the storage of oversized bodies, as the arena does for oversized values.
+        if (body_buf_.capacity() > MaxBodyCapacity) {
+            std::string{}.swap(body_buf_);
+        } else {
+            body_buf_.clear();
+        }
+    }
+    void flush() { parse(); }
+    /// Copies any values that refer to the input buffer into the arena. This is called before the
+    /// connection consumes its input buffer while a request is still in progress.
+    void retain();
+    void set_method(Method method) noexcept { method_ = method; }
+    void append_url(std::string_view sv) { append(url_, sv); }
+    void append_header_field(std::string_view sv, First first)
+    {
+        if (first == First::Yes) {
+            headers_.emplace_back(sv, std::string_view{});
+        } else {
+            append(headers_.back().first, sv);
+        }
+    }
+    void append_header_value(std::string_view sv, First /*first*/)
+    {
+        append(headers_.back().second, sv);
+    }
+    void append_body(std::string_view sv);
+
+  private:
+    /// Bump allocator for values that cannot be referenced in place.
+    class Arena {
+      public:
+        /// Returns the concatenation of the two strings.
+        std::string_view copy(std::string_view lhs, std::string_view rhs = {});
+        bool owns(const char* ptr) const noexcept;
+        std::size_t capacity() const noexcept;
+        /// Rewinds the arena, and releases any blocks that were allocated for oversized values.
+        void clear() noexcept;
+
+      private:
+        struct Block {
+            std::unique_ptr<char[]> data;
+            std::size_t size;
+        };
+        std::vector<Block> blocks_;
+        std::size_t cur_{0}, used_{0};
+    };
+
+    static constexpr std::size_t MaxBodyCapacity{4096};
+
+    void append(std::string_view& val, std::string_view sv)
+    {
+        if (val.empty()) {
+            val = sv;
+        } else if (val.data() + val.size() == sv.data() && !arena_.owns(val.data())) {
+            // The parser has split a value that is contiguous in the input buffer.
+            val = {val.data(), val.size() + sv.size()};
+        } else {
+            val = arena_.copy(val, sv);
+        }
+    }
+
+    Method method_{Method::Get};
+    std::string_view url_;
+    HeaderViews headers_;
+    /// Index of the first header that may refer to the input buffer.
+    std::size_t retained_{0};
+    std::string_view body_;
+    /// Holds the body if it cannot be referenced in place.
+    std::string body_buf_;
+    Arena arena_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_REQUESTVIEW_HPP
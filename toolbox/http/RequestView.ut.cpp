@@ -0,0 +1,206 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RequestView.hpp"
+
+#include "App.hpp"
+
+#include <toolbox/net/IoSock.hpp>
+#include <toolbox/net/Protocol.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+bool contains(string_view buf, string_view sv)
+{
+    return sv.data() >= buf.data() && sv.data() + sv.size() <= buf.data() + buf.size();
+}
+
+struct TestApp final : ViewApp {
+    void do_on_http_connect(CyclTime /*now*/, const Endpoint& /*ep*/) override {}
+    void do_on_http_disconnect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override
+    {
+        disconnected = true;
+    }
+    void do_on_http_error(CyclTime /*now*/, const Endpoint& /*ep*/, const std::exception& e,
+                          http::OStream& /*os*/) noexcept override
+    {
+        error = e.what();
+    }
+    void do_on_http_message(CyclTime /*now*/, const Endpoint& /*ep*/, const RequestView& req,
+                            http::OStream& os) override
+    {
+        path = req.path();
+        for (const auto& [field, value] : req.headers()) {
+            headers.emplace_back(field, value);
+        }
+        body = req.body();
+        os.reset(Status::Ok, TextPlain);
+        os << "ok";
+        os.commit();
+    }
+    void do_on_http_timeout(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+
+    string path;
+    vector<pair<string, string>> headers;
+    string body;
+    string error;
+    bool disconnected{false};
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(RequestViewSuite)
+
+BOOST_AUTO_TEST_CASE(RequestViewInPlaceCase)
+{
+    const string buf{"/foo?bar=1HostexampleBody"};
+    const string_view sv{buf};
+
+    RequestView req;
+    req.append_url(sv.substr(0, 4));
+    // Contiguous fragments are merged without copying.
+    req.append_url(sv.substr(4, 6));
+    req.append_header_field(sv.substr(10, 4), First::Yes);
+    req.append_header_value(sv.substr(14, 7), First::Yes);
+    req.append_body(sv.substr(21, 4));
+    req.flush();
+
+    BOOST_CHECK_EQUAL(req.url(), "/foo?bar=1");
+    BOOST_CHECK_EQUAL(req.path(), "/foo");
+    BOOST_CHECK_EQUAL(req.query(), "bar=1");
+    BOOST_CHECK_EQUAL(req.headers().size(), 1U);
+    BOOST_CHECK_EQUAL(req.headers()[0].first, "Host");
+    BOOST_CHECK_EQUAL(req.headers()[0].second, "example");
+    BOOST_CHECK_EQUAL(req.body(), "Body");
+
+    BOOST_CHECK(contains(sv, req.url()));
+    BOOST_CHECK(contains(sv, req.headers()[0].first));
+    BOOST_CHECK(contains(sv, req.headers()[0].second));
+    BOOST_CHECK(contains(sv, req.body()));
+
+    req.clear();
+    BOOST_CHECK(req.url().empty());
+    BOOST_CHECK(req.headers().empty());
+    BOOST_CHECK(req.body().empty());
+}
+
+BOOST_AUTO_TEST_CASE(RequestViewSpanCase)
+{
+    RequestView req;
+    string buf{"/fooHo"};
+    req.append_url(string_view{buf}.substr(0, 4));
+    req.append_header_field(string_view{buf}.substr(4, 2), First::Yes);
+    req.retain();
+    // The input buffer is reused by the next read.
+    buf = "stexample";
+    req.append_header_field(string_view{buf}.substr(0, 2), First::No);
+    req.append_header_value(string_view{buf}.substr(2, 7), First::Yes);
+    req.retain();
+    buf = "xxxxxxxxx";
+    req.flush();
+
+    BOOST_CHECK_EQUAL(req.url(), "/foo");
+    BOOST_CHECK_EQUAL(req.path(), "/foo");
+    BOOST_CHECK_EQUAL(req.headers()[0].first, "Host");
+    BOOST_CHECK_EQUAL(req.headers()[0].second, "example");
+
+    // Non-contiguous chunks of the body are concatenated in the arena.
+    const string chunks{"abc\r\n3\r\ndef"};
+    req.append_body(string_view{chunks}.substr(0, 3));
+    req.append_body(string_view{chunks}.substr(8, 3));
+    BOOST_CHECK_EQUAL(req.body(), "abcdef");
+
+    // Values larger than an arena block.
+    const string large(10000, 'x');
+    req.append_body(large);
+    BOOST_CHECK_EQUAL(req.body().size(), 10006U);
+    req.retain();
+    BOOST_CHECK_EQUAL(req.body().substr(0, 7), "abcdefx");
+}
+
+BOOST_AUTO_TEST_CASE(RequestViewChunksCase)
+{
+    RequestView req;
+    req.set_method(Method::Post);
+    req.append_url("/upload");
+
+    // Each chunk is separated from the next by its framing in the input buffer.
+    constexpr size_t ChunkSize{1024}, Chunks{1024};
+    string buf(ChunkSize + 2, 'x');
+    for (size_t i{0}; i < Chunks; ++i) {
+        buf[0] = static_cast<char>('a' + i % 26);
+        req.append_body(string_view{buf}.substr(0, ChunkSize));
+        req.retain();
+    }
+    req.flush();
+    BOOST_CHECK_EQUAL(req.body().size(), ChunkSize * Chunks);
+    BOOST_CHECK_EQUAL(req.body()[(Chunks - 1) * ChunkSize], 'a' + (Chunks - 1) % 26);
+    // The body is appended in place, rather than copied for each chunk.
+    BOOST_CHECK_LE(req.capacity(), 4 * ChunkSize * Chunks);
+
+    // Oversized bodies are released when the request is cleared.
+    req.clear();
+    BOOST_CHECK_LE(req.capacity(), 8192U);
+}
+
+BOOST_AUTO_TEST_CASE(RequestViewConnCase)
+{
+    Reactor r{1024};
+    TestApp app;
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.second.set_non_block();
+    const auto now = CyclTime::now();
+    new ViewConn{now, r, std::move(socks.second), StreamEndpoint{}, app};
+
+    // The request spans reads, and each header is split across the reads in turn.
+    const string req{"POST /foo?bar=1 HTTP/1.1\r\n"
+                     "Host: example.com\r\n"
+                     "Content-Type: text/plain\r\n"
+                     "Content-Length: 5\r\n"
+                     "\r\n"
+                     "hello"};
+    for (size_t pos{0}; pos < req.size(); pos += 7) {
+        const auto part = req.substr(pos, 7);
+        os::write(socks.first.get(), part.data(), part.size());
+        r.poll(CyclTime::now(), 0ms);
+    }
+    BOOST_CHECK_EQUAL(app.error, "");
+    BOOST_CHECK_EQUAL(app.path, "/foo");
+    BOOST_CHECK_EQUAL(app.headers.size(), 3U);
+    BOOST_CHECK_EQUAL(app.headers[0].first, "Host");
+    BOOST_CHECK_EQUAL(app.headers[0].second, "example.com");
+    BOOST_CHECK_EQUAL(app.headers[1].first, "Content-Type");
+    BOOST_CHECK_EQUAL(app.headers[1].second, "text/plain");
+    BOOST_CHECK_EQUAL(app.headers[2].first, "Content-Length");
+    BOOST_CHECK_EQUAL(app.headers[2].second, "5");
+    BOOST_CHECK_EQUAL(app.body, "hello");
+
+    char buf[256];
+    const auto n = os::read(socks.first.get(), buf, sizeof(buf));
+    const string_view resp{buf, n};
+    BOOST_CHECK(resp.starts_with("HTTP/1.1 200 OK\r\n"));
+    BOOST_CHECK(resp.ends_with("\r\n\r\nok"));
+
+    socks.first.reset();
+    r.poll(CyclTime::now(), 0ms);
+    BOOST_CHECK(app.disconnected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
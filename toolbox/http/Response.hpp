@@ -0,0 +1,81 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_RESPONSE_HPP
+#define TOOLBOX_HTTP_RESPONSE_HPP
+
+#include <toolbox/http/Request.hpp>
+
+namespace toolbox {
+inline namespace http {
+
+/// A response received by an HTTP client. The status code is an integer, because servers may return
+/// codes that have no Status enumerator.
+class TOOLBOX_API Response {
+  public:
+    Response() = default;
+    ~Response();
+
+    // Copy.
+    Response(const Response&) = delete;
+    Response& operator=(const Response&) = delete;
+
+    // Move.
+    Response(Response&&) = delete;
+    Response& operator=(Response&&) = delete;
+
+    int status_code() const noexcept { return status_code_; }
+    const std::string& reason() const noexcept { return reason_; }
+    const Headers& headers() const noexcept { return headers_; }
+    const std::string& body() const noexcept { return body_; }
+
+    /// Returns the value of the first header with the field name, ignoring case, or an empty view
+    /// if there is none.
+    std::string_view header(std::string_view field) const noexcept;
+
+    void clear() noexcept
+    {
+        status_code_ = 0;
+        reason_.clear();
+        headers_.clear();
+        body_.clear();
+    }
+    void set_status_code(int status_code) noexcept { status_code_ = status_code; }
+    void append_reason(std::string_view sv) { reason_.append(sv.data(), sv.size()); }
+    void append_header_field(std::string_view sv, First first)
+    {
+        if (first == First::Yes) {
+            headers_.emplace_back(std::string{sv.data(), sv.size()}, "");
+        } else {
+            headers_.back().first.append(sv.data(), sv.size());
+        }
+    }
+    void append_header_value(std::string_view sv, First /*first*/)
+    {
+        headers_.back().second.append(sv.data(), sv.size());
+    }
+    void append_body(std::string_view sv) { body_.append(sv.data(), sv.size()); }
+
+  private:
+    int status_code_{0};
+    std::string reason_;
+    Headers headers_;
+    std::string body_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_RESPONSE_HPP
@@ -0,0 +1,117 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ResponseWriter.hpp"
+
+#include "Stream.hpp"
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+constexpr string_view NoCacheBlock{"\r\nCache-Control: no-cache"};
+constexpr string_view ContentTypeBlock{"\r\nContent-Type: "};
+constexpr string_view ChunkedBlock{"\r\nTransfer-Encoding: chunked\r\n\r\n"};
+// Use 10 space place-holder for content length. RFC2616 states that field value MAY be preceded by
+// any amount of LWS, though a single SP is preferred.
+constexpr string_view ContentLengthBlock{"\r\nContent-Length:          0\r\n\r\n"};
+
+/// Precomputed header blocks for the common content types.
+struct CommonContentType {
+    string_view type;
+    string_view block;
+};
+constexpr CommonContentType CommonContentTypes[]{
+    {ApplicationJson,
+     "\r\nContent-Type: application/json\r\nContent-Length:          0\r\n\r\n"},
+    {TextHtml, "\r\nContent-Type: text/html\r\nContent-Length:          0\r\n\r\n"},
+    {TextPlain, "\r\nContent-Type: text/plain\r\nContent-Length:          0\r\n\r\n"}};
+
+} // namespace
+
+string_view status_line(Status status) noexcept
+{
+    switch (static_cast<int>(status)) {
+#define XX(num, name, string)                                                                      \
+    case num:                                                                                      \
+        return "HTTP/1.1 " #num " " #string;
+        HTTP_STATUS_MAP(XX)
+#undef XX
+    }
+    std::terminate();
+}
+
+ResponseWriter::~ResponseWriter() = default;
+
+void ResponseWriter::commit() noexcept
+{
+    if (cloff_ > 0) {
+        auto len = pcount_ - hcount_;
+        auto* it = buf_.wptr() + cloff_;
+        do {
+            *--it = '0' + len % 10;
+            len /= 10;
+        } while (len > 0);
+    }
+    buf_.commit(pcount_);
+    reset();
+}
+
+void ResponseWriter::reset(Status status, const char* content_type, NoCache no_cache)
+{
+    reset();
+    producer_ = nullptr;
+    file_ = {};
+    *this << status_line(status);
+    if (no_cache == NoCache::Yes) {
+        *this << NoCacheBlock;
+    }
+    if (content_type) {
+        const string_view type{content_type};
+        const auto it = find_if(begin(CommonContentTypes), end(CommonContentTypes),
+                                [type](const auto& common) { return common.type == type; });
+        if (it != end(CommonContentTypes)) {
+            *this << it->block;
+        } else {
+            *this << ContentTypeBlock << type << ContentLengthBlock;
+        }
+        // The slot ends before the blank line.
+        cloff_ = pcount_ - 4;
+    } else {
+        *this << "\r\n\r\n";
+    }
+    hcount_ = pcount_;
+}
+
+void ResponseWriter::reset(Status status, const char* content_type, BodyProducer& producer,
+                           NoCache no_cache)
+{
+    reset();
+    *this << status_line(status);
+    if (no_cache == NoCache::Yes) {
+        *this << NoCacheBlock;
+    }
+    if (content_type) {
+        *this << ContentTypeBlock << content_type;
+    }
+    *this << ChunkedBlock;
+    hcount_ = pcount_;
+    producer_ = &producer;
+    file_ = {};
+}
+
+} // namespace http
+} // namespace toolbox
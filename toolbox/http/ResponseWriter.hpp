@@ -0,0 +1,108 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_RESPONSEWRITER_HPP
+#define TOOLBOX_HTTP_RESPONSEWRITER_HPP
+
+#include <toolbox/http/Producer.hpp>
+#include <toolbox/http/Types.hpp>
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/util/OStreamBase.hpp>
+
+#include <utility>
+
+namespace toolbox {
+inline namespace http {
+
+/// Returns the status line for the status, without the trailing CRLF.
+TOOLBOX_API std::string_view status_line(Status status) noexcept;
+
+/// Response writer that produces the same output as OStream, but without the overhead of
+/// std::ostream. Writes are appended directly to the uncommitted region of the output buffer, the
+/// status line and common header blocks are precomputed, and the Content-Length is formatted into a
+/// reserved slot when the response is committed.
+///
+/// Applications opt into the writer by deriving from BasicApp<RequestT, ResponseWriter>.
+class TOOLBOX_API ResponseWriter final : public OStreamBase<ResponseWriter> {
+    friend OStreamBase<ResponseWriter>;
+
+  public:
+    explicit ResponseWriter(Buffer& buf) noexcept
+    : buf_{buf}
+    {
+    }
+    ~ResponseWriter();
+
+    // Copy.
+    ResponseWriter(const ResponseWriter&) = delete;
+    ResponseWriter& operator=(const ResponseWriter&) = delete;
+
+    // Move.
+    ResponseWriter(ResponseWriter&&) = delete;
+    ResponseWriter& operator=(ResponseWriter&&) = delete;
+
+    /// Returns false if an output error occurred.
+    explicit operator bool() const noexcept { return !badbit_; }
+    /// Returns the number of bytes written since the last reset.
+    std::size_t pcount() const noexcept { return pcount_; }
+    /// Returns the uncommitted response.
+    std::string_view str() const noexcept { return {buf_.wptr(), pcount_}; }
+
+    /// Commits the response to the output buffer, after setting the Content-Length.
+    void commit() noexcept;
+    /// Discards the uncommitted response.
+    void reset() noexcept
+    {
+        pcount_ = cloff_ = hcount_ = 0;
+        badbit_ = false;
+    }
+    /// Discards the uncommitted response, and writes the status line and headers for a new one.
+    void reset(Status status, const char* content_type, NoCache no_cache = NoCache::Yes);
+    /// Discards the uncommitted response, and writes the status line and headers for a chunked
+    /// response, whose body is pulled from the producer once the headers have been committed.
+    /// Nothing else may be written to the response.
+    void reset(Status status, const char* content_type, BodyProducer& producer,
+               NoCache no_cache = NoCache::Yes);
+    /// Returns the producer of the last chunked response, if any, and releases it from the writer.
+    BodyProducer* release_producer() noexcept { return std::exchange(producer_, nullptr); }
+    /// Sends the file after the committed response, whose headers describe the file.
+    void attach(FileBody&& body) noexcept { file_ = std::move(body); }
+    /// Returns the file attached to the last response, if any, and releases it from the writer.
+    FileBody release_file() noexcept { return std::exchange(file_, {}); }
+
+  private:
+    char* do_prepare_space(std::size_t num_bytes)
+    {
+        buf_.prepare(pcount_ + num_bytes);
+        return buf_.wptr() + pcount_;
+    }
+    void do_relinquish_space(std::size_t consumed_num_bytes) { pcount_ += consumed_num_bytes; }
+    void do_set_badbit() { badbit_ = true; }
+
+    Buffer& buf_;
+    std::size_t pcount_{0};
+    /// Content-Length offset, which is the end of the reserved slot.
+    std::size_t cloff_{0};
+    /// Header size.
+    std::size_t hcount_{0};
+    BodyProducer* producer_{nullptr};
+    FileBody file_;
+    bool badbit_{false};
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_RESPONSEWRITER_HPP
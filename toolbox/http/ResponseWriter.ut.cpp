@@ -0,0 +1,145 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ResponseWriter.hpp"
+
+#include "App.hpp"
+#include "Stream.hpp"
+
+#include <toolbox/net/IoSock.hpp>
+#include <toolbox/net/Protocol.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct TestApp final : WriterApp {
+    void do_on_http_connect(CyclTime /*now*/, const Endpoint& /*ep*/) override {}
+    void do_on_http_disconnect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    void do_on_http_error(CyclTime /*now*/, const Endpoint& /*ep*/, const std::exception& /*e*/,
+                          ResponseWriter& /*os*/) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime /*now*/, const Endpoint& /*ep*/, const Request& req,
+                            ResponseWriter& os) override
+    {
+        os.reset(Status::Ok, ApplicationJson);
+        os << "{\"path\":\"" << req.path() << "\"}";
+        os.commit();
+    }
+    void do_on_http_timeout(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+};
+
+/// Writes the same response with OStream and ResponseWriter.
+template <typename FnT>
+pair<string, string> write_both(Status status, const char* content_type, NoCache no_cache, FnT fn)
+{
+    Buffer buf1, buf2;
+    http::OStream os{buf1};
+    os.reset(status, content_type, no_cache);
+    fn(os);
+    os.commit();
+    ResponseWriter w{buf2};
+    w.reset(status, content_type, no_cache);
+    fn(w);
+    w.commit();
+    return {string{buf1.str()}, string{buf2.str()}};
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ResponseWriterSuite)
+
+BOOST_AUTO_TEST_CASE(StatusLineCase)
+{
+    BOOST_CHECK_EQUAL(status_line(Status::Ok), "HTTP/1.1 200 OK");
+    BOOST_CHECK_EQUAL(status_line(Status::NotFound), "HTTP/1.1 404 Not Found");
+    BOOST_CHECK_EQUAL(status_line(Status::InternalServerError),
+                      "HTTP/1.1 500 Internal Server Error");
+}
+
+BOOST_AUTO_TEST_CASE(ResponseWriterCase)
+{
+    Buffer buf;
+    ResponseWriter w{buf};
+    w.reset(Status::Ok, TextPlain);
+    w << "Hello, " << 42 << '!';
+    BOOST_CHECK(w);
+    // Nothing is visible until the response is committed.
+    BOOST_CHECK(buf.empty());
+    w.commit();
+    BOOST_CHECK_EQUAL(buf.str(), "HTTP/1.1 200 OK\r\n"
+                                 "Cache-Control: no-cache\r\n"
+                                 "Content-Type: text/plain\r\n"
+                                 "Content-Length:         10\r\n"
+                                 "\r\n"
+                                 "Hello, 42!");
+    BOOST_CHECK_EQUAL(w.pcount(), 0U);
+
+    // Discarded responses leave the buffer unchanged.
+    buf.clear();
+    w.reset(Status::Ok, TextPlain);
+    w << "discarded";
+    w.reset();
+    w.commit();
+    BOOST_CHECK(buf.empty());
+
+    w.reset(Status::NoContent, nullptr, NoCache::No);
+    w.commit();
+    BOOST_CHECK_EQUAL(buf.str(), "HTTP/1.1 204 No Content\r\n\r\n");
+}
+
+BOOST_AUTO_TEST_CASE(ResponseWriterCompatCase)
+{
+    const auto body = [](auto& os) { os << "body of the response " << 123456789; };
+    for (const auto* type : {TextPlain, TextHtml, ApplicationJson, "image/png"}) {
+        for (const auto no_cache : {NoCache::Yes, NoCache::No}) {
+            const auto [expected, actual] = write_both(Status::NotFound, type, no_cache, body);
+            BOOST_CHECK_EQUAL(actual, expected);
+        }
+    }
+    const auto [expected, actual] = write_both(Status::Ok, TextPlain, NoCache::Yes,
+                                               [](auto& os) { os << string(100'000, 'x'); });
+    BOOST_CHECK_EQUAL(actual, expected);
+}
+
+BOOST_AUTO_TEST_CASE(ResponseWriterConnCase)
+{
+    Reactor r{1024};
+    TestApp app;
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.second.set_non_block();
+    new WriterConn{CyclTime::now(), r, std::move(socks.second), StreamEndpoint{}, app};
+
+    const string req{"GET /foo HTTP/1.1\r\n\r\n"};
+    os::write(socks.first.get(), req.data(), req.size());
+    r.poll(CyclTime::now(), 0ms);
+
+    char buf[256];
+    const auto n = os::read(socks.first.get(), buf, sizeof(buf));
+    BOOST_CHECK_EQUAL(string_view(buf, n), "HTTP/1.1 200 OK\r\n"
+                                           "Cache-Control: no-cache\r\n"
+                                           "Content-Type: application/json\r\n"
+                                           "Content-Length:         15\r\n"
+                                           "\r\n"
+                                           "{\"path\":\"/foo\"}");
+    socks.first.reset();
+    r.poll(CyclTime::now(), 0ms);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,33 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Router.hpp"
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+
+string_view RouteParams::get(string_view name) const noexcept
+{
+    for (const auto& [key, value] : *this) {
+        if (key == name) {
+            return value;
+        }
+    }
+    return {};
+}
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,317 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_ROUTER_HPP
+#define TOOLBOX_HTTP_ROUTER_HPP
+
+#include <toolbox/http/Types.hpp>
+#include <toolbox/util/String.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace toolbox {
+inline namespace http {
+template <typename ValueT>
+class BasicRouter;
+
+/// Path parameters captured by BasicRouter::match(). The names refer to the router's patterns, and
+/// the values refer to the matched path, so the parameters are only valid while both exist. Values
+/// are not percent-decoded.
+class TOOLBOX_API RouteParams {
+    template <typename>
+    friend class BasicRouter;
+
+  public:
+    using value_type = std::pair<std::string_view, std::string_view>;
+    using const_iterator = const value_type*;
+
+    /// The maximum number of parameters in a single pattern.
+    static constexpr std::size_t MaxSize{8};
+
+    RouteParams() noexcept = default;
+    ~RouteParams() = default;
+
+    // Copy.
+    RouteParams(const RouteParams&) noexcept = default;
+    RouteParams& operator=(const RouteParams&) noexcept = default;
+
+    // Move.
+    RouteParams(RouteParams&&) noexcept = default;
+    RouteParams& operator=(RouteParams&&) noexcept = default;
+
+    bool empty() const noexcept { return size_ == 0; }
+    std::size_t size() const noexcept { return size_; }
+    const_iterator begin() const noexcept { return params_.data(); }
+    const_iterator end() const noexcept { return params_.data() + size_; }
+    const value_type& operator[](std::size_t i) const noexcept { return params_[i]; }
+
+    /// Returns the value of the named parameter, or an empty view if there is none.
+    std::string_view get(std::string_view name) const noexcept;
+
+    void clear() noexcept { size_ = 0; }
+
+  private:
+    std::array<value_type, MaxSize> params_;
+    std::size_t size_{0};
+};
+
+/// Maps request methods and paths to values, typically handlers, so that an App can dispatch each
+/// request without comparing its path against every route.
+///
+/// Patterns are sequences of '/' separated segments, where each segment is either a literal, a
+/// named parameter such as {id}, which matches any non-empty segment, or, in the final position
+/// only, a wildcard * or {name*}, which matches the remainder of the path. Wildcards are captured
+/// with the name "*" when they are not named.
+///
+/// The patterns are compiled into a trie of path segments, in which the literal children of each
+/// node are held in a sorted array. A lookup therefore visits one node per path segment, and
+/// performs a binary search at each. Literal segments take precedence over parameters, and
+/// parameters over wildcards, and the search backtracks when a more specific branch fails to match.
+/// Lookups do not allocate.
+template <typename ValueT>
+class BasicRouter {
+    using Names = std::vector<std::string>;
+    static constexpr std::uint32_t None{0};
+
+  public:
+    BasicRouter() { nodes_.emplace_back(); }
+    ~BasicRouter() = default;
+
+    // Copy.
+    BasicRouter(const BasicRouter&) = default;
+    BasicRouter& operator=(const BasicRouter&) = default;
+
+    // Move.
+    BasicRouter(BasicRouter&&) noexcept = default;
+    BasicRouter& operator=(BasicRouter&&) noexcept = default;
+
+    /// Returns the number of registered routes.
+    std::size_t size() const noexcept { return size_; }
+
+    /// Registers a value for the method and pattern. Throws std::invalid_argument if the pattern is
+    /// malformed, or if the method and pattern have already been registered.
+    void add(Method method, std::string_view pattern, ValueT value)
+    {
+        // The pattern is validated before any nodes are created, so that the router is unchanged
+        // if it is rejected.
+        const auto segs = parse(pattern);
+        Names names;
+        auto idx = std::uint32_t{0};
+        for (const auto& [seg, kind] : segs) {
+            switch (kind) {
+            case Kind::Literal:
+                idx = literal(idx, seg);
+                break;
+            case Kind::Param:
+                names.emplace_back(seg);
+                idx = child(idx, &Node::param);
+                break;
+            case Kind::Wildcard:
+                names.emplace_back(seg);
+                idx = child(idx, &Node::wildcard);
+                break;
+            }
+        }
+        auto& routes = nodes_[idx].routes;
+        if (std::any_of(routes.begin(), routes.end(),
+                        [method](const auto& route) { return route.method == method; })) {
+            throw std::invalid_argument{make_string("duplicate route: ", method, ' ', pattern)};
+        }
+        routes.push_back({method, std::move(names), std::move(value)});
+        ++size_;
+    }
+
+    /// Returns the value registered for the method and path, or nullptr if there is none. On
+    /// failure, the status is set to MethodNotAllowed if the path matched a pattern that was only
+    /// registered for other methods, and to NotFound otherwise.
+    const ValueT* match(Method method, std::string_view path, RouteParams& params,
+                        Status& status) const noexcept
+    {
+        params.clear();
+        status = Status::NotFound;
+        if (path.empty() || path.front() != '/') {
+            return nullptr;
+        }
+        const auto* const route = find(nodes_.front(), method, path.substr(1), params, status);
+        if (!route) {
+            return nullptr;
+        }
+        for (std::size_t i{0}; i < params.size_; ++i) {
+            params.params_[i].first = route->names[i];
+        }
+        status = Status::Ok;
+        return &route->value;
+    }
+    const ValueT* match(Method method, std::string_view path, RouteParams& params) const noexcept
+    {
+        Status status;
+        return match(method, path, params, status);
+    }
+
+  private:
+    struct Route {
+        Method method;
+        Names names;
+        ValueT value;
+    };
+    struct Node {
+        std::vector<std::pair<std::string, std::uint32_t>> literals;
+        std::uint32_t param{None}, wildcard{None};
+        std::vector<Route> routes;
+    };
+
+    enum class Kind { Literal, Param, Wildcard };
+    using Segments = std::vector<std::pair<std::string_view, Kind>>;
+
+    /// Splits the pattern into segments, where the parameters are represented by their names.
+    /// Throws std::invalid_argument if the pattern is malformed.
+    static Segments parse(std::string_view pattern)
+    {
+        if (pattern.empty() || pattern.front() != '/') {
+            throw std::invalid_argument{make_string("invalid route pattern: ", pattern)};
+        }
+        Segments segs;
+        std::size_t params{0};
+        auto rest = pattern.substr(1);
+        for (;;) {
+            const auto pos = rest.find('/');
+            const auto seg = rest.substr(0, pos);
+            auto kind = Kind::Literal;
+            auto name = seg;
+            if (seg == "*") {
+                kind = Kind::Wildcard;
+            } else if (seg.size() > 2 && seg.front() == '{' && seg.back() == '}') {
+                name = seg.substr(1, seg.size() - 2);
+                kind = Kind::Param;
+                if (name.ends_with('*')) {
+                    name.remove_suffix(1);
+                    kind = Kind::Wildcard;
+                }
+                if (name.empty() || name.find_first_of("{}*") != std::string_view::npos) {
+                    throw std::invalid_argument{make_string("invalid route segment: ", pattern)};
+                }
+            } else if (seg.find_first_of("{}*") != std::string_view::npos) {
+                throw std::invalid_argument{make_string("invalid route segment: ", pattern)};
+            }
+            if (kind == Kind::Wildcard && pos != std::string_view::npos) {
+                throw std::invalid_argument{
+                    make_string("wildcard must be the final segment: ", pattern)};
+            }
+            if (kind != Kind::Literal && ++params > RouteParams::MaxSize) {
+                throw std::invalid_argument{make_string("too many route parameters: ", pattern)};
+            }
+            segs.emplace_back(name, kind);
+            if (pos == std::string_view::npos) {
+                break;
+            }
+            rest.remove_prefix(pos + 1);
+        }
+        return segs;
+    }
+    std::uint32_t child(std::uint32_t idx, std::uint32_t Node::* member)
+    {
+        if (nodes_[idx].*member == None) {
+            const auto next = static_cast<std::uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+            nodes_[idx].*member = next;
+        }
+        return nodes_[idx].*member;
+    }
+    std::uint32_t literal(std::uint32_t idx, std::string_view seg)
+    {
+        auto& literals = nodes_[idx].literals;
+        auto it = std::lower_bound(literals.begin(), literals.end(), seg,
+                                   [](const auto& lhs, std::string_view rhs) {
+                                       return std::string_view{lhs.first} < rhs;
+                                   });
+        if (it == literals.end() || it->first != seg) {
+            const auto next = static_cast<std::uint32_t>(nodes_.size());
+            it = literals.emplace(it, std::string{seg}, next);
+            nodes_.emplace_back();
+        }
+        return it->second;
+    }
+    /// Returns the route for the method, if the path ends at this node.
+    static const Route* route(const Node& node, Method method, Status& status) noexcept
+    {
+        for (const auto& route : node.routes) {
+            if (route.method == method) {
+                return &route;
+            }
+        }
+        if (!node.routes.empty()) {
+            status = Status::MethodNotAllowed;
+        }
+        return nullptr;
+    }
+    /// Matches the remainder of the path, which follows a '/', against the children of the node.
+    const Route* find(const Node& node, Method method, std::string_view rest, RouteParams& params,
+                      Status& status) const noexcept
+    {
+        const auto pos = rest.find('/');
+        const auto seg = rest.substr(0, pos);
+        const auto tail = pos == std::string_view::npos ? std::string_view{} : rest.substr(pos + 1);
+        const auto& literals = node.literals;
+        const auto it = std::lower_bound(literals.begin(), literals.end(), seg,
+                                         [](const auto& lhs, std::string_view rhs) {
+                                             return std::string_view{lhs.first} < rhs;
+                                         });
+        if (it != literals.end() && it->first == seg) {
+            const auto& next = nodes_[it->second];
+            const auto* const r = pos == std::string_view::npos
+                ? route(next, method, status)
+                : find(next, method, tail, params, status);
+            if (r) {
+                return r;
+            }
+        }
+        // The number of parameters in a pattern is bounded by add().
+        assert(params.size_ < RouteParams::MaxSize
+               || (node.param == None && node.wildcard == None));
+        if (node.param != None && !seg.empty()) {
+            const auto& next = nodes_[node.param];
+            params.params_[params.size_++].second = seg;
+            const auto* const r = pos == std::string_view::npos
+                ? route(next, method, status)
+                : find(next, method, tail, params, status);
+            if (r) {
+                return r;
+            }
+            --params.size_;
+        }
+        if (node.wildcard != None) {
+            params.params_[params.size_++].second = rest;
+            const auto* const r = route(nodes_[node.wildcard], method, status);
+            if (r) {
+                return r;
+            }
+            --params.size_;
+        }
+        return nullptr;
+    }
+
+    std::vector<Node> nodes_;
+    std::size_t size_{0};
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_ROUTER_HPP
@@ -0,0 +1,163 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Router.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+using Router = BasicRouter<int>;
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(RouterSuite)
+
+BOOST_AUTO_TEST_CASE(RouterLiteralCase)
+{
+    Router r;
+    r.add(Method::Get, "/", 1);
+    r.add(Method::Get, "/orders", 2);
+    r.add(Method::Get, "/orders/", 3);
+    r.add(Method::Post, "/orders", 4);
+    r.add(Method::Get, "/orders/open", 5);
+    BOOST_CHECK_EQUAL(r.size(), 5U);
+
+    RouteParams params;
+    Status status;
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/", params), 1);
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/orders", params), 2);
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/orders/", params), 3);
+    BOOST_CHECK_EQUAL(*r.match(Method::Post, "/orders", params), 4);
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/orders/open", params, status), 5);
+    BOOST_CHECK_EQUAL(status, Status::Ok);
+    BOOST_CHECK(params.empty());
+
+    BOOST_CHECK(r.match(Method::Get, "", params, status) == nullptr);
+    BOOST_CHECK_EQUAL(status, Status::NotFound);
+    BOOST_CHECK(r.match(Method::Get, "orders", params, status) == nullptr);
+    BOOST_CHECK_EQUAL(status, Status::NotFound);
+    BOOST_CHECK(r.match(Method::Get, "/order", params, status) == nullptr);
+    BOOST_CHECK_EQUAL(status, Status::NotFound);
+    BOOST_CHECK(r.match(Method::Get, "/orders/open/1", params, status) == nullptr);
+    BOOST_CHECK_EQUAL(status, Status::NotFound);
+    BOOST_CHECK(r.match(Method::Delete, "/orders", params, status) == nullptr);
+    BOOST_CHECK_EQUAL(status, Status::MethodNotAllowed);
+}
+
+BOOST_AUTO_TEST_CASE(RouterParamCase)
+{
+    Router r;
+    r.add(Method::Get, "/orders/{id}", 1);
+    r.add(Method::Get, "/orders/{id}/fills/{fill}", 2);
+    r.add(Method::Delete, "/orders/{oid}", 3);
+    r.add(Method::Post, "/orders/new", 4);
+
+    RouteParams params;
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/orders/101", params), 1);
+    BOOST_CHECK_EQUAL(params.size(), 1U);
+    BOOST_CHECK_EQUAL(params[0].first, "id");
+    BOOST_CHECK_EQUAL(params[0].second, "101");
+    BOOST_CHECK_EQUAL(params.get("id"), "101");
+    BOOST_CHECK(params.get("fill").empty());
+
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/orders/101/fills/7", params), 2);
+    BOOST_CHECK_EQUAL(params.size(), 2U);
+    BOOST_CHECK_EQUAL(params.get("id"), "101");
+    BOOST_CHECK_EQUAL(params.get("fill"), "7");
+
+    // Each route has its own parameter names.
+    BOOST_CHECK_EQUAL(*r.match(Method::Delete, "/orders/101", params), 3);
+    BOOST_CHECK_EQUAL(params.get("oid"), "101");
+
+    // The literal only matches for POST, so GET backtracks to the parameter.
+    BOOST_CHECK_EQUAL(*r.match(Method::Post, "/orders/new", params), 4);
+    BOOST_CHECK(params.empty());
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/orders/new", params), 1);
+    BOOST_CHECK_EQUAL(params.get("id"), "new");
+
+    // Parameters do not match empty segments.
+    BOOST_CHECK(r.match(Method::Get, "/orders/", params) == nullptr);
+    BOOST_CHECK(r.match(Method::Get, "/orders/101/fills/", params) == nullptr);
+    BOOST_CHECK(params.empty());
+}
+
+BOOST_AUTO_TEST_CASE(RouterWildcardCase)
+{
+    Router r;
+    r.add(Method::Get, "/static/*", 1);
+    r.add(Method::Get, "/static/index.html", 2);
+    r.add(Method::Get, "/users/{user}/files/{path*}", 3);
+
+    RouteParams params;
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/static/css/main.css", params), 1);
+    BOOST_CHECK_EQUAL(params.get("*"), "css/main.css");
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/static/", params), 1);
+    BOOST_CHECK_EQUAL(params.get("*"), "");
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/static/index.html", params), 2);
+    BOOST_CHECK(params.empty());
+    BOOST_CHECK(r.match(Method::Get, "/static", params) == nullptr);
+
+    BOOST_CHECK_EQUAL(*r.match(Method::Get, "/users/mark/files/a/b/c.txt", params), 3);
+    BOOST_CHECK_EQUAL(params.size(), 2U);
+    BOOST_CHECK_EQUAL(params.get("user"), "mark");
+    BOOST_CHECK_EQUAL(params.get("path"), "a/b/c.txt");
+}
+
+BOOST_AUTO_TEST_CASE(RouterInvalidCase)
+{
+    Router r;
+    r.add(Method::Get, "/orders/{id}", 1);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/orders/{id}", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/orders/{oid}", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "orders", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/orders/{}", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/orders/{id", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/orders/x{id}", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/static/*/x", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/static/{path*}/x", 2), invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/{a}/{b}/{c}/{d}/{e}/{f}/{g}/{h}/{i}", 2),
+                      invalid_argument);
+    BOOST_CHECK_EQUAL(r.size(), 1U);
+}
+
+BOOST_AUTO_TEST_CASE(RouterRejectedCase)
+{
+    // A rejected pattern leaves the router unchanged.
+    Router r;
+    BOOST_CHECK_THROW(r.add(Method::Get, "/{a}/{b}/{c}/{d}/{e}/{f}/{g}/{h}/{i}", 1),
+                      invalid_argument);
+    BOOST_CHECK_THROW(r.add(Method::Get, "/static/*/x", 1), invalid_argument);
+    BOOST_CHECK_EQUAL(r.size(), 0U);
+
+    RouteParams params;
+    Status status;
+    BOOST_CHECK(!r.match(Method::Get, "/1/2/3/4/5/6/7/8/9", params, status));
+    BOOST_CHECK(status == Status::NotFound);
+    BOOST_CHECK(params.empty());
+    BOOST_CHECK(!r.match(Method::Get, "/static/x", params, status));
+
+    r.add(Method::Get, "/{a}/{b}/{c}/{d}/{e}/{f}/{g}/{h}", 1);
+    BOOST_CHECK(!r.match(Method::Get, "/1/2/3/4/5/6/7/8/9", params));
+    const auto* const value = r.match(Method::Get, "/1/2/3/4/5/6/7/8", params);
+    BOOST_TEST_REQUIRE(value);
+    BOOST_CHECK_EQUAL(*value, 1);
+    BOOST_CHECK_EQUAL(params.size(), RouteParams::MaxSize);
+    BOOST_CHECK_EQUAL(params.get("h"), "8");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -38,10 +38,20 @@ class BasicServ : public StreamAcceptor<BasicServ<ConnT, AppT>> {
     using typename StreamAcceptor<BasicServ<ConnT, AppT>>::Endpoint;
 
   public:
-    BasicServ(CyclTime /*now*/, Reactor& r, const Endpoint& ep, App& app)
+    BasicServ(CyclTime now, Reactor& r, const Endpoint& ep, App& app)
     : StreamAcceptor<BasicServ<ConnT, AppT>>{r, ep}
     , reactor_{r}
     , app_{app}
+    , reaper_{now, r, Conn::IdleTimeout}
+    {
+    }
+    /// Adopts a listening socket that is already bound, typically one handed over by a previous
+    /// instance of the process.
+    BasicServ(CyclTime now, Reactor& r, StreamSockServ&& sock, App& app)
+    : StreamAcceptor<BasicServ<ConnT, AppT>>{r, std::move(sock)}
+    , reactor_{r}
+    , app_{app}
+    , reaper_{now, r, Conn::IdleTimeout}
     {
     }
     ~BasicServ()
@@ -58,21 +68,64 @@ class BasicServ : public StreamAcceptor<BasicServ<ConnT, AppT>> {
     BasicServ(BasicServ&&) = delete;
     BasicServ& operator=(BasicServ&&) = delete;
 
+    /// Adopts an established connection, typically one handed over by a previous instance of the
+    /// process. The connection should be handed over at a message boundary, because any data
+    /// buffered by the previous owner is lost.
+    void adopt(CyclTime now, IoSock&& sock, const Endpoint& ep)
+    {
+        on_sock_accept(now, std::move(sock), ep);
+    }
+
+    /// Returns the pool that connections are allocated from.
+    const SlabPool& conn_pool() const noexcept { return conn_pool_; }
+    /// Returns the cache that idle connections return their buffer storage to.
+    const BufferCache& buffer_cache() const noexcept { return buffer_cache_; }
+
+    /// Returns the TCP_INFO sampler, or null if sampling has not been enabled.
+    const TcpInfoSampler* tcp_info() const noexcept { return tcp_info_.get(); }
+
+    /// Samples TCP_INFO for all current and future TCP connections on a low priority timer. The
+    /// sampler aggregates the samples into histograms for the server, and each connection's
+    /// tcp_probe holds its latest snapshot.
+    void enable_tcp_info(Duration interval)
+    {
+        tcp_info_ = std::make_unique<TcpInfoSampler>(reactor_, interval);
+        for (auto& conn : conn_list_) {
+            if (conn.endpoint().protocol().family() != AF_UNIX) {
+                tcp_info_->add(conn.tcp_probe);
+            }
+        }
+    }
+
   private:
     void on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
     void on_sock_accept(CyclTime now, IoSock&& sock, const Endpoint& ep)
     {
-        auto* const conn = new Conn{now, reactor_, std::move(sock), ep, app_};
+        const ConnShared shared{&conn_pool_, &buffer_cache_, &reaper_};
+        auto* const conn = new (conn_pool_) Conn{now, reactor_, std::move(sock), ep, app_, shared};
         conn_list_.push_back(*conn);
+        if (tcp_info_ && ep.protocol().family() != AF_UNIX) {
+            tcp_info_->add(conn->tcp_probe);
+        }
     }
 
     Reactor& reactor_;
     App& app_;
+    // The shared state must outlive the connections, which are disposed when the server is
+    // destroyed.
+    SlabPool conn_pool_{sizeof(Conn)};
+    BufferCache buffer_cache_;
+    // Expires idle connections with a single timer, rather than a timer per connection.
+    IdleReaper reaper_;
     // List of active connections.
     ConnList conn_list_;
+    std::unique_ptr<TcpInfoSampler> tcp_info_;
 };
 
-using Serv = BasicServ<Conn, App>;
+using Serv = BasicServ<Conn, BasicApp<Request>>;
+using ViewServ = BasicServ<ViewConn, BasicApp<RequestView>>;
+using WriterServ = BasicServ<WriterConn, BasicApp<Request, ResponseWriter>>;
+using ViewWriterServ = BasicServ<ViewWriterConn, BasicApp<RequestView, ResponseWriter>>;
 
 } // namespace http
 } // namespace toolbox
@@ -0,0 +1,165 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SimdParser.hpp"
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+namespace toolbox {
+inline namespace http {
+namespace detail {
+using namespace std;
+namespace {
+
+// Request-target: any byte below 0x21, and DEL.
+constexpr unsigned char UrlMin{0x21};
+// Header value: any byte below 0x20 except HTAB, and DEL.
+constexpr unsigned char ValueMin{0x20};
+
+#if defined(__AVX2__)
+
+template <unsigned char MinV, bool AllowTab>
+inline uint32_t ctl_mask(__m256i x) noexcept
+{
+    // Unsigned comparison: x >= min if max(x, min) == x.
+    const auto ge = _mm256_cmpeq_epi8(_mm256_max_epu8(x, _mm256_set1_epi8(MinV)), x);
+    auto mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(ge));
+    if constexpr (AllowTab) {
+        mask &= ~static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('\t'))));
+    }
+    const auto del = _mm256_cmpeq_epi8(x, _mm256_set1_epi8(0x7f));
+    return mask | static_cast<uint32_t>(_mm256_movemask_epi8(del));
+}
+
+#elif defined(__SSE4_2__)
+
+// Inclusive byte ranges matched by PCMPESTRI.
+alignas(16) constexpr char UrlRanges[16]{'\x00', '\x20', '\x7f', '\x7f'};
+alignas(16) constexpr char ValueRanges[16]{'\x00', '\x08', '\x0a', '\x1f', '\x7f', '\x7f'};
+
+#endif
+
+constexpr char to_lower(char c) noexcept
+{
+    return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c;
+}
+
+template <unsigned char MinV, bool AllowTab>
+const char* find_ctl(const char* first, const char* last) noexcept
+{
+#if defined(__AVX2__)
+    for (; last - first >= 32; first += 32) {
+        const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        const auto mask = ctl_mask<MinV, AllowTab>(x);
+        if (mask != 0) {
+            return first + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__SSE4_2__)
+    const auto ranges = _mm_load_si128(
+        reinterpret_cast<const __m128i*>(AllowTab ? ValueRanges : UrlRanges));
+    constexpr int RangesLen{AllowTab ? 6 : 4};
+    for (; last - first >= 16; first += 16) {
+        const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        const auto i = _mm_cmpestri(ranges, RangesLen, x, 16,
+                                    _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_LEAST_SIGNIFICANT);
+        if (i != 16) {
+            return first + i;
+        }
+    }
+#endif
+    for (; first != last; ++first) {
+        const auto c = static_cast<unsigned char>(*first);
+        if ((c < MinV && !(AllowTab && c == '\t')) || c == 0x7f) {
+            break;
+        }
+    }
+    return first;
+}
+
+} // namespace
+
+const char* find_url_end(const char* first, const char* last) noexcept
+{
+    return find_ctl<UrlMin, false>(first, last);
+}
+
+const char* find_value_end(const char* first, const char* last) noexcept
+{
+    return find_ctl<ValueMin, true>(first, last);
+}
+
+const char* find_head_end(const char* first, const char* last) noexcept
+{
+    // The C library's memchr is already vectorised.
+    while (first != last) {
+        const auto* nl = static_cast<const char*>(memchr(first, '\n', last - first));
+        if (!nl) {
+            break;
+        }
+        first = nl + 1;
+        if (first == last) {
+            break;
+        }
+        if (*first == '\n') {
+            return first + 1;
+        }
+        if (*first == '\r' && last - first >= 2 && first[1] == '\n') {
+            return first + 2;
+        }
+    }
+    return nullptr;
+}
+
+bool parse_method(string_view sv, Method& method) noexcept
+{
+    // Fast path for the most common methods.
+    if (sv == "GET") {
+        method = Method::Get;
+        return true;
+    }
+    if (sv == "POST") {
+        method = Method::Post;
+        return true;
+    }
+#define XX(num, name, string)                                                                      \
+    if (sv == #string) {                                                                           \
+        method = static_cast<Method>(num);                                                         \
+        return true;                                                                               \
+    }
+    HTTP_METHOD_MAP(XX)
+#undef XX
+    return false;
+}
+
+bool iequals(string_view lhs, string_view rhs) noexcept
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (size_t i{0}; i < lhs.size(); ++i) {
+        if (to_lower(lhs[i]) != to_lower(rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+} // namespace http
+} // namespace toolbox
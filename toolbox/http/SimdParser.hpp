@@ -0,0 +1,438 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_SIMDPARSER_HPP
+#define TOOLBOX_HTTP_SIMDPARSER_HPP
+
+#include <toolbox/http/Exception.hpp>
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/sys/Time.hpp>
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace toolbox {
+inline namespace http {
+namespace detail {
+
+/// Returns a pointer to the first byte in [first, last) that cannot appear in a request-target,
+/// i.e. a control character, space or DEL, or last if there is none.
+TOOLBOX_API const char* find_url_end(const char* first, const char* last) noexcept;
+
+/// Returns a pointer to the first byte in [first, last) that cannot appear in a header value, i.e.
+/// a control character other than HTAB, or DEL, or last if there is none. The CR or LF that
+/// terminates a well-formed header line is therefore the first such byte.
+TOOLBOX_API const char* find_value_end(const char* first, const char* last) noexcept;
+
+/// Returns a pointer to the first byte after the empty line that terminates the request line and
+/// header fields, or nullptr if [first, last) does not contain one.
+TOOLBOX_API const char* find_head_end(const char* first, const char* last) noexcept;
+
+/// Parses a request method token. Returns false if the method is unknown.
+TOOLBOX_API bool parse_method(std::string_view sv, Method& method) noexcept;
+
+/// Returns true if the fields are equal, ignoring case.
+TOOLBOX_API bool iequals(std::string_view lhs, std::string_view rhs) noexcept;
+
+/// The tchar set from RFC 9110, which is used for methods and header field names.
+inline constexpr auto TokenChars = [] {
+    std::array<bool, 256> chars{};
+    for (int c{'0'}; c <= '9'; ++c) {
+        chars[c] = true;
+    }
+    for (int c{'A'}; c <= 'Z'; ++c) {
+        chars[c] = chars[c + 'a' - 'A'] = true;
+    }
+    for (const char c : std::string_view{"!#$%&'*+-.^_`|~"}) {
+        chars[static_cast<unsigned char>(c)] = true;
+    }
+    return chars;
+}();
+
+inline bool is_token(char c) noexcept
+{
+    return TokenChars[static_cast<unsigned char>(c)];
+}
+
+} // namespace detail
+
+/// An HTTP/1.x request parser that is a drop-in replacement for BasicParser<DerivedT> with
+/// Type::Request. The same on_http_* callbacks are invoked on the derived class, so that BasicConn
+/// can use either parser.
+///
+/// Unlike http_parser, which is a byte-at-a-time state machine, the request line and header fields
+/// are not parsed until the empty line that terminates them has been buffered. The header block is
+/// then scanned with SSE4.2 or AVX2 instructions when the target architecture supports them, and
+/// with a scalar loop otherwise. Each header field and value is therefore delivered in a single
+/// callback with First::Yes, and without the optional whitespace that surrounds it. Bytes that
+/// cannot be parsed yet are not consumed, so the caller must present them again, followed by any
+/// new data, on the next call to parse(). The body is streamed as it arrives, for both
+/// Content-Length and chunked transfer encodings.
+template <typename DerivedT>
+class BasicSimdParser {
+  public:
+    explicit BasicSimdParser(Type type)
+    {
+        if (type != Type::Request) {
+            throw std::invalid_argument{"only requests are supported"};
+        }
+    }
+
+    // Copy.
+    BasicSimdParser(const BasicSimdParser&) noexcept = default;
+    BasicSimdParser& operator=(const BasicSimdParser&) noexcept = default;
+
+    // Move.
+    BasicSimdParser(BasicSimdParser&&) noexcept = default;
+    BasicSimdParser& operator=(BasicSimdParser&&) noexcept = default;
+
+    int http_major() const noexcept { return 1; }
+    int http_minor() const noexcept { return minor_; }
+    Method method() const noexcept { return method_; }
+    bool should_keep_alive() const noexcept { return keep_alive_; }
+
+    /// Stops the parser after the current message has been completed.
+    void pause() noexcept { paused_ = true; }
+
+  protected:
+    ~BasicSimdParser() = default;
+
+    void reset() noexcept
+    {
+        state_ = State::Head;
+        paused_ = false;
+        scanned_ = 0;
+    }
+    std::size_t parse(CyclTime now, ConstBuffer buf)
+    {
+        const auto* const first = static_cast<const char*>(buf.data());
+        const auto* const last = first + buffer_size(buf);
+        const char* it{first};
+        while (it != last) {
+            const char* next{nullptr};
+            switch (state_) {
+            case State::Head:
+                next = parse_head(now, it, last);
+                break;
+            case State::Body:
+            case State::ChunkData:
+                next = parse_data(now, it, last);
+                break;
+            case State::ChunkSize:
+                next = parse_chunk_size(now, it, last);
+                break;
+            case State::ChunkEnd:
+                next = parse_chunk_end(now, it, last);
+                break;
+            case State::Trailer:
+                next = parse_trailer(now, it, last);
+                break;
+            }
+            if (!next) {
+                // Incomplete.
+                break;
+            }
+            it = next;
+            if (paused_ && state_ == State::Head) {
+                paused_ = false;
+                break;
+            }
+        }
+        return it - first;
+    }
+
+  private:
+    enum class State { Head, Body, ChunkSize, ChunkData, ChunkEnd, Trailer };
+
+    static constexpr std::size_t MaxChunkLine{1024};
+
+    DerivedT& derived() noexcept { return *static_cast<DerivedT*>(this); }
+    [[noreturn]] static void fail(const char* what)
+    {
+        throw Exception{Status::BadRequest, what};
+    }
+    static void check(bool ok)
+    {
+        if (!ok) {
+            fail("callback failed");
+        }
+    }
+    /// Consumes a CRLF or bare LF line terminator.
+    static const char* parse_eol(const char* it, const char* last, const char* what)
+    {
+        if (it != last && *it == '\r') {
+            ++it;
+        }
+        if (it == last || *it != '\n') {
+            fail(what);
+        }
+        return it + 1;
+    }
+    /// Parses a header or trailer field line, which must be terminated by a line feed before end.
+    static const char* parse_field(const char* it, const char* end, std::string_view& name,
+                                   std::string_view& val)
+    {
+        const auto* const field = it;
+        while (detail::is_token(*it)) {
+            ++it;
+        }
+        if (it == field || *it != ':') {
+            fail("invalid header token");
+        }
+        name = {field, std::size_t(it - field)};
+        ++it;
+        // Optional whitespace is not part of the field value.
+        while (*it == ' ' || *it == '\t') {
+            ++it;
+        }
+        const auto* const value = it;
+        it = detail::find_value_end(it, end);
+        const auto* trim = it;
+        while (trim != value && (trim[-1] == ' ' || trim[-1] == '\t')) {
+            --trim;
+        }
+        val = {value, std::size_t(trim - value)};
+        return parse_eol(it, end, "invalid header value");
+    }
+    const char* parse_head(CyclTime now, const char* first, const char* last)
+    {
+        // Ignore empty lines that precede the request line.
+        if (*first == '\r' || *first == '\n') {
+            scanned_ = 0;
+            const auto* it = first;
+            while (it != last && (*it == '\r' || *it == '\n')) {
+                ++it;
+            }
+            return it;
+        }
+        // Resume the search where the previous call left off. The last three bytes are searched
+        // again, because they may be the start of a terminator that straddles the two calls.
+        const auto* const end = detail::find_head_end(first + scanned_, last);
+        if (!end) {
+            const std::size_t size = last - first;
+            if (size > HTTP_MAX_HEADER_SIZE) {
+                fail("header overflow");
+            }
+            scanned_ = size > 3 ? size - 3 : 0;
+            return nullptr;
+        }
+        scanned_ = 0;
+        check(derived().on_http_message_begin(now));
+
+        // Method.
+        const char* it{first};
+        while (detail::is_token(*it)) {
+            ++it;
+        }
+        if (it == first || *it != ' ' || !detail::parse_method({first, std::size_t(it - first)},
+                                                                method_)) {
+            fail("invalid method");
+        }
+        // Request target.
+        const auto* const url = ++it;
+        it = detail::find_url_end(it, end);
+        if (it == url || *it != ' ') {
+            fail("invalid URL");
+        }
+        check(derived().on_http_url(now, {url, std::size_t(it - url)}));
+        ++it;
+        // Version.
+        if (end - it < 10 || std::memcmp(it, "HTTP/1.", 7) != 0 || it[7] < '0' || it[7] > '9') {
+            fail("invalid HTTP version");
+        }
+        minor_ = it[7] - '0';
+        it = parse_eol(it + 8, end, "invalid HTTP version");
+
+        std::uint64_t content_length{0};
+        bool has_content_length{false}, chunked{false}, close{false}, keep_alive{false};
+        // Header fields.
+        while (*it != '\r' && *it != '\n') {
+            std::string_view name, val;
+            it = parse_field(it, end, name, val);
+
+            if (detail::iequals(name, "content-length")) {
+                const auto n = parse_content_length(val);
+                if (has_content_length && n != content_length) {
+                    fail("unexpected content-length header");
+                }
+                content_length = n;
+                has_content_length = true;
+            } else if (detail::iequals(name, "transfer-encoding")) {
+                // Chunked must be the final transfer coding applied to a request.
+                if (val.size() < 7 || !detail::iequals(val.substr(val.size() - 7), "chunked")) {
+                    fail("invalid transfer-encoding header");
+                }
+                chunked = true;
+            } else if (detail::iequals(name, "connection")) {
+                parse_connection(val, close, keep_alive);
+            }
+            check(derived().on_http_header_field(now, name, First::Yes));
+            check(derived().on_http_header_value(now, val, First::Yes));
+        }
+        it = parse_eol(it, end, "invalid header token");
+        if (has_content_length && chunked) {
+            // Reject ambiguous framing, which may be used to smuggle requests.
+            fail("unexpected content-length header");
+        }
+        keep_alive_ = minor_ > 0 ? !close : keep_alive;
+        check(derived().on_http_headers_end(now));
+        if (chunked) {
+            state_ = State::ChunkSize;
+        } else if (content_length > 0) {
+            remain_ = content_length;
+            state_ = State::Body;
+        } else {
+            check(derived().on_http_message_end(now));
+        }
+        return it;
+    }
+    const char* parse_data(CyclTime now, const char* first, const char* last)
+    {
+        const auto len = std::min<std::uint64_t>(remain_, last - first);
+        check(derived().on_http_body(now, {first, len}));
+        remain_ -= len;
+        if (remain_ == 0) {
+            if (state_ == State::Body) {
+                state_ = State::Head;
+                check(derived().on_http_message_end(now));
+            } else {
+                state_ = State::ChunkEnd;
+            }
+        }
+        return first + len;
+    }
+    const char* parse_chunk_size(CyclTime now, const char* first, const char* last)
+    {
+        const auto* const eol = find_eol(first, last);
+        if (!eol) {
+            return nullptr;
+        }
+        std::uint64_t len{0};
+        const char* it{first};
+        for (; it != eol; ++it) {
+            const auto c = *it;
+            int digit;
+            if (c >= '0' && c <= '9') {
+                digit = c - '0';
+            } else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+                digit = (c | 0x20) - 'a' + 10;
+            } else {
+                break;
+            }
+            if (len >> 60 != 0) {
+                fail("invalid chunk size");
+            }
+            len = len << 4 | digit;
+        }
+        // Chunk extensions are ignored.
+        if (it == first
+            || (*it != ';' && *it != ' ' && *it != '\t' && *it != '\r' && *it != '\n')) {
+            fail("invalid chunk size");
+        }
+        check(derived().on_http_chunk_header(now, len));
+        if (len > 0) {
+            remain_ = len;
+            state_ = State::ChunkData;
+        } else {
+            state_ = State::Trailer;
+        }
+        return eol + 1;
+    }
+    const char* parse_chunk_end(CyclTime now, const char* first, const char* last)
+    {
+        if (*first == '\r' && last - first < 2) {
+            return nullptr;
+        }
+        const auto* const it = parse_eol(first, last, "invalid chunk terminator");
+        state_ = State::ChunkSize;
+        check(derived().on_http_chunk_end(now));
+        return it;
+    }
+    const char* parse_trailer(CyclTime now, const char* first, const char* last)
+    {
+        const auto* const eol = find_eol(first, last);
+        if (!eol) {
+            return nullptr;
+        }
+        // An empty line ends the message.
+        if (eol == first || (eol == first + 1 && *first == '\r')) {
+            state_ = State::Head;
+            check(derived().on_http_chunk_end(now));
+            check(derived().on_http_message_end(now));
+            return eol + 1;
+        }
+        std::string_view name, val;
+        const auto* const it = parse_field(first, eol + 1, name, val);
+        check(derived().on_http_header_field(now, name, First::Yes));
+        check(derived().on_http_header_value(now, val, First::Yes));
+        return it;
+    }
+    static const char* find_eol(const char* first, const char* last)
+    {
+        const auto* const eol = static_cast<const char*>(std::memchr(first, '\n', last - first));
+        if (!eol && std::size_t(last - first) > MaxChunkLine) {
+            fail("invalid chunk size");
+        }
+        return eol;
+    }
+    static std::uint64_t parse_content_length(std::string_view sv)
+    {
+        if (sv.empty() || sv.size() > 18) {
+            fail("invalid content-length header");
+        }
+        std::uint64_t n{0};
+        for (const auto c : sv) {
+            if (c < '0' || c > '9') {
+                fail("invalid content-length header");
+            }
+            n = n * 10 + (c - '0');
+        }
+        return n;
+    }
+    static void parse_connection(std::string_view sv, bool& close, bool& keep_alive) noexcept
+    {
+        while (!sv.empty()) {
+            const auto pos = sv.find(',');
+            auto tok = sv.substr(0, pos);
+            sv = pos == std::string_view::npos ? std::string_view{} : sv.substr(pos + 1);
+            while (!tok.empty() && (tok.front() == ' ' || tok.front() == '\t')) {
+                tok.remove_prefix(1);
+            }
+            while (!tok.empty() && (tok.back() == ' ' || tok.back() == '\t')) {
+                tok.remove_suffix(1);
+            }
+            if (detail::iequals(tok, "close")) {
+                close = true;
+            } else if (detail::iequals(tok, "keep-alive")) {
+                keep_alive = true;
+            }
+        }
+    }
+
+    State state_{State::Head};
+    Method method_{Method::Get};
+    int minor_{1};
+    bool keep_alive_{true}, paused_{false};
+    /// Number of head bytes already searched for the terminating empty line.
+    std::size_t scanned_{0};
+    /// Number of bytes remaining in the body or current chunk.
+    std::uint64_t remain_{0};
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_SIMDPARSER_HPP
@@ -0,0 +1,281 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SimdParser.hpp"
+
+#include <toolbox/http/Parser.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+/// Records the callbacks as a sequence of events, so that the two parsers can be compared.
+template <template <typename> class ParserT>
+class Recorder : public ParserT<Recorder<ParserT>> {
+    friend class ParserT<Recorder<ParserT>>;
+    using Base = ParserT<Recorder<ParserT>>;
+
+  public:
+    Recorder()
+    : Base{Type::Request}
+    {
+    }
+    const auto& events() const noexcept { return events_; }
+    int messages() const noexcept { return messages_; }
+
+    std::size_t parse(string_view sv)
+    {
+        return Base::parse(CyclTime::now(), {sv.data(), sv.size()});
+    }
+    /// Parses the input one byte at a time, and retains unconsumed bytes as BasicConn would.
+    void parse_split(string_view sv)
+    {
+        string in;
+        for (const auto c : sv) {
+            in += c;
+            in.erase(0, parse(in));
+        }
+        BOOST_CHECK(in.empty());
+    }
+
+  private:
+    bool on_http_message_begin(CyclTime /*now*/) noexcept
+    {
+        events_.emplace_back("begin");
+        return true;
+    }
+    bool on_http_url(CyclTime /*now*/, string_view sv) noexcept
+    {
+        append("url:", sv);
+        return true;
+    }
+    bool on_http_status(CyclTime /*now*/, string_view /*sv*/) noexcept { return false; }
+    bool on_http_header_field(CyclTime /*now*/, string_view sv, First first) noexcept
+    {
+        if (first == First::Yes) {
+            events_.emplace_back("field:");
+        }
+        events_.back().append(sv);
+        return true;
+    }
+    bool on_http_header_value(CyclTime /*now*/, string_view sv, First first) noexcept
+    {
+        if (first == First::Yes) {
+            events_.emplace_back("value:");
+        }
+        events_.back().append(sv);
+        return true;
+    }
+    bool on_http_headers_end(CyclTime /*now*/) noexcept
+    {
+        events_.emplace_back("headers:"s + enum_string(this->method()) + ':'
+                             + to_string(this->should_keep_alive()));
+        return true;
+    }
+    bool on_http_body(CyclTime /*now*/, string_view sv) noexcept
+    {
+        append("body:", sv);
+        return true;
+    }
+    bool on_http_message_end(CyclTime /*now*/) noexcept
+    {
+        events_.emplace_back("end");
+        ++messages_;
+        return true;
+    }
+    bool on_http_chunk_header(CyclTime /*now*/, std::size_t len) noexcept
+    {
+        events_.emplace_back("chunk:" + to_string(len));
+        return true;
+    }
+    bool on_http_chunk_end(CyclTime /*now*/) noexcept { return true; }
+    /// Coalesces consecutive fragments of the same event.
+    void append(string_view tag, string_view sv)
+    {
+        if (events_.empty() || !events_.back().starts_with(tag)) {
+            events_.emplace_back(tag);
+        }
+        events_.back().append(sv);
+    }
+
+    vector<string> events_;
+    int messages_{0};
+};
+
+using SimdRecorder = Recorder<BasicSimdParser>;
+using HttpRecorder = Recorder<BasicParser>;
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SimdParserSuite)
+
+BOOST_AUTO_TEST_CASE(SimdParserScanCase)
+{
+    // Place each delimiter at every offset, so that both the vector and scalar tails are covered.
+    for (std::size_t n{0}; n < 100; ++n) {
+        string s(n, 'a');
+        BOOST_CHECK_EQUAL(http::detail::find_url_end(s.data(), s.data() + n) - s.data(), n);
+        BOOST_CHECK_EQUAL(http::detail::find_value_end(s.data(), s.data() + n) - s.data(), n);
+        for (const char c : {' ', '\r', '\n', '\0', '\x7f'}) {
+            s += c;
+            s += "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+            const auto* const last = s.data() + s.size();
+            BOOST_CHECK_EQUAL(http::detail::find_url_end(s.data(), last) - s.data(), n);
+            if (c == ' ') {
+                BOOST_CHECK_EQUAL(http::detail::find_value_end(s.data(), last), last);
+            } else {
+                BOOST_CHECK_EQUAL(http::detail::find_value_end(s.data(), last) - s.data(), n);
+            }
+            s.resize(n);
+        }
+        // Tabs and high bytes are permitted in values.
+        s += "\t\x80\xff\r";
+        const auto* const last = s.data() + s.size();
+        BOOST_CHECK_EQUAL(http::detail::find_url_end(s.data(), last) - s.data(), n);
+        BOOST_CHECK_EQUAL(http::detail::find_value_end(s.data(), last) - s.data(), n + 3);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SimdParserBasicCase)
+{
+    constexpr auto Message =                     //
+        "GET /path/file.html HTTP/1.0\r\n"       //
+        "From: someuser@reactivemarkets.com\r\n" //
+        "User-Agent:  HTTPTool/1.0 \t\r\n"       //
+        "\r\n"sv;
+
+    SimdRecorder p;
+    BOOST_CHECK_EQUAL(p.parse(Message), Message.size());
+    BOOST_CHECK(!p.should_keep_alive());
+    BOOST_CHECK_EQUAL(p.http_major(), 1);
+    BOOST_CHECK_EQUAL(p.http_minor(), 0);
+    BOOST_CHECK_EQUAL(p.method(), Method::Get);
+
+    const vector<string> expected{"begin",
+                                  "url:/path/file.html",
+                                  "field:From",
+                                  "value:someuser@reactivemarkets.com",
+                                  "field:User-Agent",
+                                  "value:HTTPTool/1.0",
+                                  "headers:GET:0",
+                                  "end"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(p.events().begin(), p.events().end(), expected.begin(),
+                                  expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(SimdParserIncompleteCase)
+{
+    constexpr auto Message =              //
+        "POST /orders HTTP/1.1\r\n"       //
+        "Content-Length: 10\r\n"          //
+        "\r\n"                            //
+        "0123456789"sv;
+
+    SimdRecorder p;
+    // Nothing is consumed until the header block is complete.
+    BOOST_CHECK_EQUAL(p.parse(Message.substr(0, 44)), 0U);
+    BOOST_CHECK(p.events().empty());
+    // The body is streamed as it arrives.
+    BOOST_CHECK_EQUAL(p.parse(Message.substr(0, 50)), 50U);
+    BOOST_CHECK_EQUAL(p.parse(Message.substr(50)), 5U);
+    BOOST_CHECK_EQUAL(p.messages(), 1);
+    BOOST_CHECK(p.should_keep_alive());
+    BOOST_CHECK_EQUAL(p.method(), Method::Post);
+    BOOST_CHECK_EQUAL(p.events()[5], "body:0123456789");
+}
+
+BOOST_AUTO_TEST_CASE(SimdParserCompatCase)
+{
+    // Each message must produce the same events as http_parser, whether it is parsed in one go, or
+    // one byte at a time.
+    const string_view messages[]{
+        "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n",
+        "\r\nGET /?a=1&b=2 HTTP/1.1\r\nConnection: close\r\n\r\n",
+        "GET /index.html HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n",
+        "DELETE /orders/1 HTTP/1.1\nHost: localhost\n\n",
+        "M-SEARCH * HTTP/1.1\r\nEmpty:\r\nX:  y\r\n\r\n",
+        "PUT /x HTTP/1.1\r\nContent-Length: 5\r\n\r\nhelloGET /y HTTP/1.1\r\n\r\n",
+        "POST /chunked HTTP/1.1\r\n"
+        "Transfer-Encoding: chunked\r\n"
+        "\r\n"
+        "5;ext=1\r\nhello\r\n"
+        "1A\r\nabcdefghijklmnopqrstuvwxyz\r\n"
+        "0\r\n"
+        "Trailer: value\r\n"
+        "\r\n",
+        "GET /long HTTP/1.1\r\n"
+        "Cookie: aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\r\n"
+        "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko)\r\n"
+        "\r\n"};
+    for (const auto msg : messages) {
+        HttpRecorder expected;
+        expected.parse(msg);
+        SimdRecorder actual;
+        BOOST_CHECK_EQUAL(actual.parse(msg), msg.size());
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual.events().begin(), actual.events().end(),
+                                      expected.events().begin(), expected.events().end());
+        SimdRecorder split;
+        split.parse_split(msg);
+        BOOST_CHECK_EQUAL_COLLECTIONS(split.events().begin(), split.events().end(),
+                                      expected.events().begin(), expected.events().end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SimdParserPauseCase)
+{
+    constexpr auto Message = "GET /a HTTP/1.1\r\n\r\nGET /b HTTP/1.1\r\n\r\n"sv;
+
+    SimdRecorder p;
+    p.pause();
+    BOOST_CHECK_EQUAL(p.parse(Message), 19U);
+    BOOST_CHECK_EQUAL(p.messages(), 1);
+    BOOST_CHECK_EQUAL(p.parse(Message.substr(19)), 19U);
+    BOOST_CHECK_EQUAL(p.messages(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(SimdParserInvalidCase)
+{
+    const string_view messages[]{
+        "GET\r\n\r\n",
+        "G@T / HTTP/1.1\r\n\r\n",
+        "FOO / HTTP/1.1\r\n\r\n",
+        "GET  HTTP/1.1\r\n\r\n",
+        "GET /\x01 HTTP/1.1\r\n\r\n",
+        "GET / HTTP/2.0\r\n\r\n",
+        "GET / HTTP/1.1\r\nBad Field: x\r\n\r\n",
+        "GET / HTTP/1.1\r\nField: x\r\n folded\r\n\r\n",
+        "GET / HTTP/1.1\r\nField: x\ry\r\n\r\n",
+        "GET / HTTP/1.1\r\nContent-Length: x\r\n\r\n",
+        "GET / HTTP/1.1\r\nContent-Length: 1\r\nContent-Length: 2\r\n\r\n",
+        "GET / HTTP/1.1\r\nContent-Length: 1\r\nTransfer-Encoding: chunked\r\n\r\n",
+        "GET / HTTP/1.1\r\nTransfer-Encoding: gzip\r\n\r\n",
+        "GET / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nx\r\n",
+        "GET / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n1\r\nab\r\n"};
+    for (const auto msg : messages) {
+        SimdRecorder p;
+        BOOST_CHECK_THROW(p.parse(msg), http::Exception);
+    }
+    // The header block is limited in size.
+    SimdRecorder p;
+    const string msg{"GET / HTTP/1.1\r\nCookie: " + string(HTTP_MAX_HEADER_SIZE, 'a')};
+    BOOST_CHECK_THROW(p.parse(msg), http::Exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
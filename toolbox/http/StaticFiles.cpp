@@ -0,0 +1,279 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StaticFiles.hpp"
+
+#include "ResponseWriter.hpp"
+
+#include <toolbox/io/File.hpp>
+
+#include <charconv>
+#include <ctime>
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+/// Events that show that a cached file has been modified, replaced or removed.
+constexpr uint32_t InvalidateMask{IN_MODIFY | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF};
+
+struct MimeType {
+    string_view ext;
+    string_view type;
+};
+constexpr MimeType MimeTypes[]{
+    {".css", "text/css"},          {".csv", "text/csv"},
+    {".gif", "image/gif"},         {".htm", "text/html"},
+    {".html", "text/html"},        {".ico", "image/x-icon"},
+    {".jpeg", "image/jpeg"},       {".jpg", "image/jpeg"},
+    {".js", "text/javascript"},    {".json", "application/json"},
+    {".map", "application/json"},  {".png", "image/png"},
+    {".svg", "image/svg+xml"},     {".txt", "text/plain"},
+    {".wasm", "application/wasm"}, {".woff", "font/woff"},
+    {".woff2", "font/woff2"},      {".xml", "application/xml"}};
+
+string_view content_type(string_view path) noexcept
+{
+    const auto pos = path.find_last_of("./");
+    if (pos != string_view::npos && path[pos] == '.') {
+        const auto ext = path.substr(pos);
+        for (const auto& mime : MimeTypes) {
+            if (detail::iequals(mime.ext, ext)) {
+                return mime.type;
+            }
+        }
+    }
+    return "application/octet-stream";
+}
+
+/// Returns false if the path is not absolute, or if any segment is "..".
+bool valid_path(string_view path) noexcept
+{
+    if (path.empty() || path[0] != '/' || path.find('\0') != string_view::npos) {
+        return false;
+    }
+    for (size_t pos{0}; pos != string_view::npos;) {
+        const auto next = path.find('/', pos + 1);
+        if (path.substr(pos + 1, next - pos - 1) == "..") {
+            return false;
+        }
+        pos = next;
+    }
+    return true;
+}
+
+/// The ETag is derived from the modification time and size, as other servers do, so that it does
+/// not require the file to be hashed.
+string make_etag(const struct stat& st)
+{
+    const auto mtime
+        = static_cast<uint64_t>(st.st_mtim.tv_sec) * 1'000'000'000 + st.st_mtim.tv_nsec;
+    char buf[16];
+    string etag{'"'};
+    etag.append(buf, to_chars(buf, buf + sizeof(buf), mtime, 16).ptr);
+    etag += '-';
+    etag.append(buf, to_chars(buf, buf + sizeof(buf), static_cast<uint64_t>(st.st_size), 16).ptr);
+    etag += '"';
+    return etag;
+}
+
+/// Formats the modification time as an IMF-fixdate, e.g. "Sun, 06 Nov 1994 08:49:37 GMT".
+string make_last_modified(const struct stat& st)
+{
+    struct tm tm;
+    gmtime_r(&st.st_mtim.tv_sec, &tm);
+    char buf[32];
+    const auto n = strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+    return {buf, n};
+}
+
+void put_head(string& out, Status status, string_view etag, string_view last_modified)
+{
+    out += status_line(status);
+    out += "\r\nETag: ";
+    out += etag;
+    out += "\r\nLast-Modified: ";
+    out += last_modified;
+    out += "\r\n";
+}
+
+void put_head(string& out, string_view path, size_t size, string_view etag,
+              string_view last_modified)
+{
+    put_head(out, Status::Ok, etag, last_modified);
+    out += "Content-Type: ";
+    out += content_type(path);
+    out += "\r\nContent-Length: ";
+    char buf[20];
+    out.append(buf, to_chars(buf, buf + sizeof(buf), size).ptr);
+    out += "\r\n\r\n";
+}
+
+string make_root(const filesystem::path& root)
+{
+    // Request paths start with a slash.
+    string s{root.native()};
+    while (s.size() > 1 && s.back() == '/') {
+        s.pop_back();
+    }
+    return s;
+}
+
+/// Reads up to size bytes from the file, and returns the bytes read.
+string read_file(int fd, size_t size)
+{
+    string data(size, '\0');
+    size_t n{0};
+    while (n < size) {
+        const auto ret = os::read(fd, data.data() + n, size - n);
+        if (ret == 0) {
+            break;
+        }
+        n += ret;
+    }
+    data.resize(n);
+    return data;
+}
+
+} // namespace
+
+StaticFiles::StaticFiles(Reactor& r, const Path& root, const StaticFilesOptions& opts)
+: root_{make_root(root)}
+, opts_{opts}
+, inotify_{IN_CLOEXEC}
+, watcher_{r, inotify_}
+{
+}
+
+StaticFiles::~StaticFiles() = default;
+
+bool StaticFiles::lookup(string_view path, const Conditions& cond, Reply& reply)
+{
+    if (!valid_path(path)) {
+        return false;
+    }
+    path_.assign(root_).append(path);
+    if (path_.back() == '/') {
+        path_ += "index.html";
+    }
+    if (const auto it = index_.find(path_); it != index_.end()) {
+        const auto lit = it->second;
+        // Move to the front of the LRU list.
+        lru_.splice(lru_.begin(), lru_, lit);
+        ++stats_.hits;
+        if (!not_modified(cond, lit->etag, lit->last_modified, reply)) {
+            const string_view response{lit->response};
+            reply.head = response.substr(0, lit->head_size);
+            reply.body = response.substr(lit->head_size);
+        }
+        return true;
+    }
+    error_code ec;
+    auto fh = os::open(path_.c_str(), O_RDONLY | O_CLOEXEC, ec);
+    if (ec) {
+        return false;
+    }
+    struct stat st;
+    os::fstat(fh.get(), st);
+    if (!S_ISREG(st.st_mode)) {
+        return false;
+    }
+    const auto size = static_cast<size_t>(st.st_size);
+    if (size <= opts_.max_cached_size && size <= opts_.capacity) {
+        // Watch the file before it is read, so that a change cannot be missed.
+        watcher_.watch(path_, bind<&StaticFiles::on_file_event>(this), InvalidateMask);
+        Entry entry{.path = path_, .etag = make_etag(st), .last_modified = make_last_modified(st)};
+        const auto data = read_file(fh.get(), size);
+        put_head(entry.response, path_, data.size(), entry.etag, entry.last_modified);
+        entry.head_size = entry.response.size();
+        entry.response += data;
+        ++stats_.misses;
+        insert(std::move(entry));
+        const auto& front = lru_.front();
+        if (!not_modified(cond, front.etag, front.last_modified, reply)) {
+            const string_view response{front.response};
+            reply.head = response.substr(0, front.head_size);
+            reply.body = response.substr(front.head_size);
+        }
+        return true;
+    }
+    const auto etag = make_etag(st);
+    const auto last_modified = make_last_modified(st);
+    ++stats_.sendfiles;
+    if (!not_modified(cond, etag, last_modified, reply)) {
+        head_.clear();
+        put_head(head_, path_, size, etag, last_modified);
+        reply.head = head_;
+        reply.file = {.fh = std::move(fh), .offset = 0, .size = size};
+    }
+    return true;
+}
+
+bool StaticFiles::not_modified(const Conditions& cond, string_view etag,
+                               string_view last_modified, Reply& reply)
+{
+    // If-None-Match takes precedence over If-Modified-Since, which is compared exactly.
+    if (!cond.if_none_match.empty() ? cond.if_none_match != etag
+                                    : cond.if_modified_since != last_modified) {
+        return false;
+    }
+    ++stats_.not_modified;
+    head_.clear();
+    put_head(head_, Status::NotModified, etag, last_modified);
+    head_ += "\r\n";
+    reply.head = head_;
+    return true;
+}
+
+void StaticFiles::insert(Entry&& entry)
+{
+    // Replace any stale entry for the same path, keeping the watch that was just added for it.
+    if (const auto it = index_.find(entry.path); it != index_.end()) {
+        used_ -= it->second->response.size();
+        lru_.erase(it->second);
+        index_.erase(it);
+    }
+    used_ += entry.response.size();
+    lru_.push_front(std::move(entry));
+    index_.emplace(lru_.front().path, lru_.begin());
+    while (used_ > opts_.capacity && lru_.size() > 1) {
+        erase(prev(lru_.end()));
+    }
+}
+
+void StaticFiles::erase(Lru::iterator it) noexcept
+{
+    used_ -= it->response.size();
+    // The file is watched for as long as it is cached.
+    watcher_.unwatch(it->path);
+    index_.erase(it->path);
+    lru_.erase(it);
+}
+
+void StaticFiles::on_file_event(const Path& path, int /*wd*/, uint32_t mask)
+{
+    if ((mask & InvalidateMask) == 0) {
+        return;
+    }
+    // The file is not cached if it could not be read after the watch was added.
+    if (const auto it = index_.find(path.native()); it != index_.end()) {
+        ++stats_.invalidations;
+        erase(it->second);
+    }
+}
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,163 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_STATICFILES_HPP
+#define TOOLBOX_HTTP_STATICFILES_HPP
+
+#include <toolbox/http/Producer.hpp>
+#include <toolbox/http/SimdParser.hpp>
+#include <toolbox/http/Types.hpp>
+#include <toolbox/io/Inotify.hpp>
+
+#include <filesystem>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace toolbox {
+inline namespace http {
+
+struct StaticFilesOptions {
+    /// Files up to this size are cached in memory. Larger files are sent with sendfile().
+    std::size_t max_cached_size{64 << 10};
+    /// The maximum total size of the cached files, beyond which the least recently used files are
+    /// evicted.
+    std::size_t capacity{16 << 20};
+};
+
+struct StaticFilesStats {
+    /// Number of responses served from the cache.
+    std::uint64_t hits{0};
+    /// Number of files read into the cache.
+    std::uint64_t misses{0};
+    /// Number of responses sent with sendfile().
+    std::uint64_t sendfiles{0};
+    /// Number of conditional requests answered with 304 Not Modified.
+    std::uint64_t not_modified{0};
+    /// Number of cached files that were invalidated because they changed.
+    std::uint64_t invalidations{0};
+};
+
+/// Serves the files under a root directory.
+///
+/// Small files are held in an LRU cache as complete responses, with prebuilt headers that include
+/// an ETag and Last-Modified, so that a hit is a single copy into the output buffer. Cached files
+/// are watched with a FileWatcher, and are invalidated when they are modified, replaced or removed.
+/// Larger files are opened for each request, and the body is sent from the file with sendfile(),
+/// so it is never copied into user space.
+///
+/// Request paths are not percent-decoded, and paths containing a ".." segment are not served. A
+/// path that ends with a slash is mapped to the index.html file in that directory.
+class TOOLBOX_API StaticFiles {
+  public:
+    using Path = std::filesystem::path;
+
+    StaticFiles(Reactor& r, const Path& root, const StaticFilesOptions& opts = {});
+    ~StaticFiles();
+
+    // Copy.
+    StaticFiles(const StaticFiles&) = delete;
+    StaticFiles& operator=(const StaticFiles&) = delete;
+
+    // Move.
+    StaticFiles(StaticFiles&&) = delete;
+    StaticFiles& operator=(StaticFiles&&) = delete;
+
+    const StaticFilesStats& stats() const noexcept { return stats_; }
+    /// Returns the number of cached files.
+    std::size_t size() const noexcept { return lru_.size(); }
+    /// Returns the total size of the cached files.
+    std::size_t used() const noexcept { return used_; }
+
+    /// Writes the response for a GET or HEAD request to the stream, which is either OStream or
+    /// ResponseWriter. Returns false if the request is not for a regular file under the root, in
+    /// which case nothing is written, so that the application may respond as it sees fit.
+    template <typename RequestT, typename StreamT>
+    bool serve(const RequestT& req, StreamT& os)
+    {
+        const auto method = req.method();
+        if (method != Method::Get && method != Method::Head) {
+            return false;
+        }
+        Conditions cond;
+        for (const auto& [field, value] : req.headers()) {
+            if (detail::iequals(field, "If-None-Match")) {
+                cond.if_none_match = value;
+            } else if (detail::iequals(field, "If-Modified-Since")) {
+                cond.if_modified_since = value;
+            }
+        }
+        Reply reply;
+        if (!lookup(req.path(), cond, reply)) {
+            return false;
+        }
+        // The response is prebuilt, so the stream's own headers are not used.
+        os.reset();
+        os << reply.head;
+        if (method == Method::Get) {
+            os << reply.body;
+        }
+        os.commit();
+        if (method == Method::Get && reply.file) {
+            os.attach(std::move(reply.file));
+        }
+        return true;
+    }
+
+  private:
+    struct Conditions {
+        std::string_view if_none_match, if_modified_since;
+    };
+    /// The response for a lookup, whose views are valid until the next lookup.
+    struct Reply {
+        std::string_view head, body;
+        FileBody file;
+    };
+    struct Entry {
+        /// The path of the file, which is also the key in the index.
+        std::string path{};
+        /// The headers and body of a 200 response.
+        std::string response{};
+        std::size_t head_size{0};
+        std::string etag{}, last_modified{};
+    };
+    using Lru = std::list<Entry>;
+
+    bool lookup(std::string_view path, const Conditions& cond, Reply& reply);
+    /// Returns true if the conditional request matches the validators, in which case the reply is
+    /// set to 304 Not Modified.
+    bool not_modified(const Conditions& cond, std::string_view etag,
+                      std::string_view last_modified, Reply& reply);
+    void insert(Entry&& entry);
+    void erase(Lru::iterator it) noexcept;
+    void on_file_event(const Path& path, int wd, std::uint32_t mask);
+
+    const std::string root_;
+    const StaticFilesOptions opts_;
+    Inotify inotify_;
+    FileWatcher watcher_;
+    StaticFilesStats stats_;
+    /// Most recently used first.
+    Lru lru_;
+    std::unordered_map<std::string_view, Lru::iterator> index_;
+    std::size_t used_{0};
+    /// Scratch space for the file path and for the headers of uncached responses.
+    std::string path_, head_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_STATICFILES_HPP
@@ -0,0 +1,272 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StaticFiles.hpp"
+
+#include "App.hpp"
+#include "Conn.hpp"
+#include "ResponseWriter.hpp"
+#include "Stream.hpp"
+
+#include <toolbox/net/IoSock.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct Req {
+    Method method() const noexcept { return method_; }
+    string_view path() const noexcept { return path_; }
+    const auto& headers() const noexcept { return headers_; }
+    Method method_{Method::Get};
+    string_view path_;
+    vector<pair<string_view, string_view>> headers_{};
+};
+
+/// A temporary root directory, which is removed with its contents.
+struct Root {
+    Root()
+    {
+        auto tmpl = (filesystem::temp_directory_path() / "toolbox-XXXXXX").native();
+        path = mkdtemp(tmpl.data());
+        filesystem::create_directory(path / "sub");
+        write("small.txt", "hello");
+        write("sub/index.html", "<p>hi</p>");
+        big.resize(200 << 10);
+        for (size_t i{0}; i < big.size(); ++i) {
+            big[i] = static_cast<char>('a' + i % 26);
+        }
+        write("big.bin", big);
+    }
+    ~Root() { filesystem::remove_all(path); }
+    void write(const char* name, string_view data) const
+    {
+        ofstream os{path / name, ios::binary | ios::trunc};
+        os << data;
+    }
+    filesystem::path path;
+    string big;
+};
+
+/// Returns the response, or an empty string if the request was not served.
+template <typename StreamT = http::OStream>
+string serve(StaticFiles& files, const Req& req)
+{
+    Buffer buf;
+    StreamT os{buf};
+    if (!files.serve(req, os)) {
+        return {};
+    }
+    return string{buf.str()};
+}
+
+string_view header(string_view resp, string_view field)
+{
+    const auto pos = resp.find("\r\n"s.append(field) + ": ");
+    if (pos == string_view::npos) {
+        return {};
+    }
+    const auto begin = pos + field.size() + 4;
+    return resp.substr(begin, resp.find("\r\n", begin) - begin);
+}
+
+string_view body(string_view resp)
+{
+    return resp.substr(resp.find("\r\n\r\n") + 4);
+}
+
+class TestApp final : public App {
+  public:
+    explicit TestApp(StaticFiles& files)
+    : files_{files}
+    {
+    }
+
+  protected:
+    void do_on_http_connect(CyclTime /*now*/, const Endpoint& /*ep*/) override {}
+    void do_on_http_disconnect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    void do_on_http_error(CyclTime /*now*/, const Endpoint& /*ep*/, const std::exception& /*e*/,
+                          http::OStream& /*os*/) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime /*now*/, const Endpoint& /*ep*/, const Request& req,
+                            http::OStream& os) override
+    {
+        if (!files_.serve(req, os)) {
+            os.reset(Status::NotFound, TextPlain);
+            os << "not found";
+            os.commit();
+        }
+    }
+    void do_on_http_timeout(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+
+  private:
+    StaticFiles& files_;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(StaticFilesSuite)
+
+BOOST_AUTO_TEST_CASE(StaticFilesServeCase)
+{
+    Root root;
+    Reactor r;
+    StaticFiles files{r, root.path};
+
+    const auto resp = serve(files, {.path_ = "/small.txt"});
+    BOOST_TEST_REQUIRE(!resp.empty());
+    BOOST_TEST(resp.starts_with("HTTP/1.1 200 OK\r\n"));
+    BOOST_TEST(header(resp, "Content-Type") == "text/plain");
+    BOOST_TEST(header(resp, "Content-Length") == "5");
+    BOOST_TEST(header(resp, "ETag").starts_with('"'));
+    BOOST_TEST(header(resp, "Last-Modified").ends_with(" GMT"));
+    BOOST_TEST(body(resp) == "hello");
+    BOOST_TEST(files.stats().misses == 1U);
+    BOOST_TEST(files.size() == 1U);
+
+    // The second request is a hit, and both streams produce the same response.
+    BOOST_TEST(serve(files, {.path_ = "/small.txt"}) == resp);
+    BOOST_TEST(serve<ResponseWriter>(files, {.path_ = "/small.txt"}) == resp);
+    BOOST_TEST(files.stats().hits == 2U);
+
+    const auto head = serve(files, {.method_ = Method::Head, .path_ = "/small.txt"});
+    BOOST_TEST_REQUIRE(!head.empty());
+    BOOST_TEST(header(head, "Content-Length") == "5");
+    BOOST_TEST(body(head).empty());
+
+    const auto index = serve(files, {.path_ = "/sub/"});
+    BOOST_TEST_REQUIRE(!index.empty());
+    BOOST_TEST(header(index, "Content-Type") == "text/html");
+    BOOST_TEST(body(index) == "<p>hi</p>");
+
+    BOOST_TEST(serve(files, {.path_ = "/missing.txt"}).empty());
+    BOOST_TEST(serve(files, {.path_ = "/sub"}).empty());
+    BOOST_TEST(serve(files, {.path_ = "/sub/../small.txt"}).empty());
+    BOOST_TEST(serve(files, {.path_ = "/.."}).empty());
+    BOOST_TEST(serve(files, {.path_ = "small.txt"}).empty());
+    BOOST_TEST(serve(files, {.method_ = Method::Post, .path_ = "/small.txt"}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(StaticFilesNotModifiedCase)
+{
+    Root root;
+    Reactor r;
+    StaticFiles files{r, root.path};
+
+    for (const auto* path : {"/small.txt", "/big.bin"}) {
+        const auto resp = serve(files, {.path_ = path});
+        BOOST_TEST_REQUIRE(!resp.empty());
+        const auto etag = header(resp, "ETag");
+        const auto last_modified = header(resp, "Last-Modified");
+        const auto expected = "HTTP/1.1 304 Not Modified\r\nETag: "s.append(etag)
+                                  .append("\r\nLast-Modified: ")
+                                  .append(last_modified)
+                                  .append("\r\n\r\n");
+
+        BOOST_TEST(serve(files, {.path_ = path, .headers_ = {{"If-None-Match", etag}}})
+                   == expected);
+        BOOST_TEST(
+            serve(files, {.path_ = path, .headers_ = {{"if-modified-since", last_modified}}})
+            == expected);
+        // If-None-Match takes precedence.
+        const auto other = serve(files, {.path_ = path,
+                                         .headers_ = {{"If-None-Match", "\"other\""},
+                                                      {"If-Modified-Since", last_modified}}});
+        BOOST_TEST_REQUIRE(!other.empty());
+        BOOST_TEST(other.starts_with("HTTP/1.1 200 OK\r\n"));
+    }
+    BOOST_TEST(files.stats().not_modified == 4U);
+}
+
+BOOST_AUTO_TEST_CASE(StaticFilesInvalidateCase)
+{
+    Root root;
+    Reactor r;
+    StaticFiles files{r, root.path};
+
+    BOOST_TEST(body(serve(files, {.path_ = "/small.txt"})) == "hello");
+    root.write("small.txt", "changed");
+    r.poll(CyclTime::now(), 0ms);
+    BOOST_TEST(files.stats().invalidations == 1U);
+    BOOST_TEST(files.size() == 0U);
+    BOOST_TEST(body(serve(files, {.path_ = "/small.txt"})) == "changed");
+
+    // A file that is replaced by a rename is also invalidated.
+    root.write("new.txt", "renamed");
+    filesystem::rename(root.path / "new.txt", root.path / "small.txt");
+    r.poll(CyclTime::now(), 0ms);
+    BOOST_TEST(files.size() == 0U);
+    BOOST_TEST(body(serve(files, {.path_ = "/small.txt"})) == "renamed");
+}
+
+BOOST_AUTO_TEST_CASE(StaticFilesEvictCase)
+{
+    Root root;
+    root.write("other.txt", "world");
+    Reactor r;
+    StaticFiles files{r, root.path, {.capacity = 256}};
+
+    serve(files, {.path_ = "/small.txt"});
+    serve(files, {.path_ = "/other.txt"});
+    // Only one response fits in the cache, so the least recently used is evicted.
+    BOOST_TEST(files.size() == 1U);
+    BOOST_TEST(files.used() <= 256U);
+    serve(files, {.path_ = "/other.txt"});
+    BOOST_TEST(files.stats().hits == 1U);
+    serve(files, {.path_ = "/small.txt"});
+    BOOST_TEST(files.stats().misses == 3U);
+}
+
+BOOST_AUTO_TEST_CASE(StaticFilesSendfileCase)
+{
+    Root root;
+    Reactor r;
+    StaticFiles files{r, root.path};
+    TestApp app{files};
+
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.first.set_non_block();
+    socks.second.set_non_block();
+    new Conn{CyclTime::now(), r, std::move(socks.second), StreamEndpoint{}, app};
+
+    // The pipelined request is answered after the file has been sent.
+    constexpr auto Reqs = "GET /big.bin HTTP/1.1\r\n\r\nGET /small.txt HTTP/1.1\r\n\r\n"sv;
+    os::write(socks.first.get(), Reqs.data(), Reqs.size());
+    string out;
+    for (int i{0}; i < 10'000 && !out.ends_with("\r\n\r\nhello"); ++i) {
+        r.poll(CyclTime::now(), 0ms);
+        char buf[4096];
+        error_code ec;
+        for (ssize_t n; (n = os::read(socks.first.get(), buf, sizeof(buf), ec)) > 0;) {
+            out.append(buf, n);
+        }
+    }
+    BOOST_TEST(files.stats().sendfiles == 1U);
+    BOOST_TEST(header(out, "Content-Type") == "application/octet-stream");
+    BOOST_TEST(header(out, "Content-Length") == to_string(root.big.size()));
+    const auto rest = body(out);
+    BOOST_TEST_REQUIRE(rest.size() > root.big.size());
+    BOOST_TEST((rest.substr(0, root.big.size()) == root.big));
+    BOOST_TEST(rest.substr(root.big.size()).starts_with("HTTP/1.1 200 OK\r\n"));
+    BOOST_TEST(out.ends_with("\r\n\r\nhello"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -19,6 +19,37 @@
 namespace toolbox {
 inline namespace http {
 using namespace std;
+namespace {
+
+/// Writes the status line and headers, and returns the Content-Length offset, or zero if there is
+/// no content or the response is chunked.
+template <typename StreamBufT>
+streamsize put_headers(ostream& os, const StreamBufT& buf, Status status, const char* content_type,
+                       NoCache no_cache, bool chunked = false)
+{
+    streamsize cloff{0};
+    os << "HTTP/1.1 " << status << ' ' << enum_string(status);
+    if (no_cache == NoCache::Yes) {
+        os << "\r\nCache-Control: no-cache";
+    }
+    if (chunked) {
+        if (content_type) {
+            os << "\r\nContent-Type: " << content_type;
+        }
+        os << "\r\nTransfer-Encoding: chunked";
+    } else if (content_type) {
+        // Status-Line = HTTP-Version SP Status-Code SP Reason-Phrase CRLF. Use 10 space
+        // place-holder for content length. RFC2616 states that field value MAY be preceded by any
+        // amount of LWS, though a single SP is preferred.
+        os << "\r\nContent-Type: " << content_type //
+           << "\r\nContent-Length:          0";
+        cloff = buf.pcount();
+    }
+    os << "\r\n\r\n";
+    return cloff;
+}
+
+} // namespace
 
 void StreamBuf::set_content_length(std::streamsize pos, std::streamsize len) noexcept
 {
@@ -65,22 +96,75 @@ void OStream::reset(Status status, const char* content_type, NoCache no_cache)
 {
     buf_.reset();
     *this << reset_state;
+    cloff_ = put_headers(*this, buf_, status, content_type, no_cache);
+    hcount_ = buf_.pcount();
+    producer_ = nullptr;
+    file_ = {};
+}
+
+void OStream::reset(Status status, const char* content_type, BodyProducer& producer,
+                    NoCache no_cache)
+{
+    buf_.reset();
+    *this << reset_state;
+    cloff_ = put_headers(*this, buf_, status, content_type, no_cache, true);
+    hcount_ = buf_.pcount();
+    producer_ = &producer;
+    file_ = {};
+}
 
-    *this << "HTTP/1.1 " << status << ' ' << enum_string(status);
-    if (no_cache == NoCache::Yes) {
-        *this << "\r\nCache-Control: no-cache";
+ChainStreamBuf::~ChainStreamBuf() = default;
+
+void ChainStreamBuf::set_content_length(std::streamsize pos, std::streamsize len) noexcept
+{
+    char digits[20];
+    auto* it = end(digits);
+    do {
+        --it;
+        *it = '0' + len % 10;
+        len /= 10;
+    } while (len > 0);
+    // The place-holder may straddle a segment boundary.
+    size_t offset = pos - (end(digits) - it);
+    while (it != end(digits)) {
+        const auto buf = buf_.prepared(offset);
+        const auto n = min<size_t>(end(digits) - it, buffer_size(buf));
+        memcpy(buf.data(), it, n);
+        it += n;
+        offset += n;
     }
-    if (content_type) {
-        // Status-Line = HTTP-Version SP Status-Code SP Reason-Phrase CRLF. Use 10 space
-        // place-holder for content length. RFC2616 states that field value MAY be preceded by any
-        // amount of LWS, though a single SP is preferred.
-        *this << "\r\nContent-Type: " << content_type //
-              << "\r\nContent-Length:          0";
-        cloff_ = buf_.pcount();
-    } else {
-        cloff_ = 0;
+}
+
+ChainStreamBuf::int_type ChainStreamBuf::overflow(int_type c) noexcept
+{
+    pcount_ += pptr() - pbase();
+    // Reserve space beyond the bytes already written and continue in the next segment.
+    buf_.reserve(pcount_ + 1);
+    const auto buf = buf_.prepared(pcount_);
+    auto* const base = static_cast<char*>(buf.data());
+    setp(base, base + buffer_size(buf));
+    if (c != traits_type::eof()) {
+        *pptr() = c;
+        pbump(1);
     }
-    *this << "\r\n\r\n";
+    return c;
+}
+
+ChainOStream::~ChainOStream() = default;
+
+void ChainOStream::commit() noexcept
+{
+    if (cloff_ > 0) {
+        buf_.set_content_length(cloff_, buf_.pcount() - hcount_);
+    }
+    buf_.commit();
+}
+
+void ChainOStream::reset(Status status, const char* content_type, NoCache no_cache)
+{
+    buf_.reset();
+    *this << reset_state;
+    cloff_ = put_headers(*this, buf_, status, content_type, no_cache);
     hcount_ = buf_.pcount();
 }
 
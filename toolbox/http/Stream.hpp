@@ -17,10 +17,14 @@
 #ifndef TOOLBOX_HTTP_STREAM_HPP
 #define TOOLBOX_HTTP_STREAM_HPP
 
+#include <toolbox/http/Producer.hpp>
 #include <toolbox/http/Types.hpp>
 #include <toolbox/io/Buffer.hpp>
+#include <toolbox/io/BufferChain.hpp>
 #include <toolbox/util/Stream.hpp>
 
+#include <utility>
+
 namespace toolbox {
 inline namespace http {
 
@@ -89,6 +93,16 @@ class TOOLBOX_API OStream final : public std::ostream {
         cloff_ = hcount_ = 0;
     }
     void reset(Status status, const char* content_type, NoCache no_cache = NoCache::Yes);
+    /// Writes the status line and headers for a chunked response, whose body is pulled from the
+    /// producer once the headers have been committed. Nothing else may be written to the stream.
+    void reset(Status status, const char* content_type, BodyProducer& producer,
+               NoCache no_cache = NoCache::Yes);
+    /// Returns the producer of the last chunked response, if any, and releases it from the stream.
+    BodyProducer* release_producer() noexcept { return std::exchange(producer_, nullptr); }
+    /// Sends the file after the committed response, whose headers describe the file.
+    void attach(FileBody&& body) noexcept { file_ = std::move(body); }
+    /// Returns the file attached to the last response, if any, and releases it from the stream.
+    FileBody release_file() noexcept { return std::exchange(file_, {}); }
 
   private:
     StreamBuf buf_;
@@ -96,6 +110,84 @@ class TOOLBOX_API OStream final : public std::ostream {
     std::streamsize cloff_{0};
     /// Header size.
     std::streamsize hcount_{0};
+    BodyProducer* producer_{nullptr};
+    FileBody file_;
+};
+
+/// Stream buffer that writes directly into the segments of a BufferChain, so that large responses
+/// are never reallocated or copied as they grow.
+class TOOLBOX_API ChainStreamBuf final : public std::streambuf {
+  public:
+    explicit ChainStreamBuf(BufferChain& buf) noexcept
+    : buf_{buf}
+    {
+    }
+    ~ChainStreamBuf() override;
+
+    // Copy.
+    ChainStreamBuf(const ChainStreamBuf&) = delete;
+    ChainStreamBuf& operator=(const ChainStreamBuf&) = delete;
+
+    // Move.
+    ChainStreamBuf(ChainStreamBuf&&) = delete;
+    ChainStreamBuf& operator=(ChainStreamBuf&&) = delete;
+
+    std::streamsize pcount() const noexcept { return pcount_ + (pptr() - pbase()); }
+    void commit() noexcept
+    {
+        buf_.commit(pcount());
+        reset();
+    }
+    void reset() noexcept
+    {
+        setp(nullptr, nullptr);
+        pcount_ = 0;
+    }
+    void set_content_length(std::streamsize pos, std::streamsize len) noexcept;
+
+  protected:
+    int_type overflow(int_type c) noexcept override;
+
+  private:
+    BufferChain& buf_;
+    /// Number of bytes written to previous segments.
+    std::streamsize pcount_{0};
+};
+
+/// Equivalent of OStream for responses that are written to a BufferChain.
+class TOOLBOX_API ChainOStream final : public std::ostream {
+  public:
+    explicit ChainOStream(BufferChain& buf) noexcept
+    : std::ostream{nullptr}
+    , buf_{buf}
+    {
+        rdbuf(&buf_);
+    }
+    ~ChainOStream() override;
+
+    // Copy.
+    ChainOStream(const ChainOStream&) = delete;
+    ChainOStream& operator=(const ChainOStream&) = delete;
+
+    // Move.
+    ChainOStream(ChainOStream&&) = delete;
+    ChainOStream& operator=(ChainOStream&&) = delete;
+
+    void commit() noexcept;
+    void reset() noexcept
+    {
+        buf_.reset();
+        *this << reset_state;
+        cloff_ = hcount_ = 0;
+    }
+    void reset(Status status, const char* content_type, NoCache no_cache = NoCache::Yes);
+
+  private:
+    ChainStreamBuf buf_;
+    /// Content-Length offset.
+    std::streamsize cloff_{0};
+    /// Header size.
+    std::streamsize hcount_{0};
 };
 
 } // namespace http
@@ -0,0 +1,66 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Stream.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+string read_all(const BufferChain& buf)
+{
+    string s(buf.size(), '\0');
+    buf.copy(0, s.data(), s.size());
+    return s;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(StreamSuite)
+
+BOOST_AUTO_TEST_CASE(ChainOStreamCase)
+{
+    BufferPool pool;
+    string body;
+    for (int i{0}; body.size() < 3 * BufferSegmentSize; ++i) {
+        body += to_string(i) + ',';
+    }
+    const auto len = to_string(body.size());
+    string head{"HTTP/1.1 200 OK\r\n"
+                "Cache-Control: no-cache\r\n"
+                "Content-Type: text/plain\r\n"
+                "Content-Length:          0"};
+    head.replace(head.size() - len.size(), len.size(), len);
+
+    // The Content-Length place-holder is back-patched after the body has been written, so it is
+    // moved across the first segment boundary to check the patch of each possible split.
+    for (size_t edge{0}; edge <= len.size(); ++edge) {
+        BufferChain buf{pool};
+        const string filler(BufferSegmentSize + edge - head.size(), '.');
+        buf.append(filler.data(), filler.size());
+
+        ChainOStream os{buf};
+        os.reset(Status::Ok, TextPlain);
+        os << body;
+        os.commit();
+        BOOST_CHECK_EQUAL(read_all(buf), filler + head + "\r\n\r\n" + body);
+        BOOST_CHECK_EQUAL(buf.segments(), (buf.size() + BufferSegmentSize - 1) / BufferSegmentSize);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
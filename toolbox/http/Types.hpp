@@ -83,6 +83,7 @@ StreamT& operator<<(StreamT& os, Method method)
 enum class Status : int {
     Ok = HTTP_STATUS_OK,
     NoContent = HTTP_STATUS_NO_CONTENT,
+    NotModified = HTTP_STATUS_NOT_MODIFIED,
     BadRequest = HTTP_STATUS_BAD_REQUEST,
     Unauthorized = HTTP_STATUS_UNAUTHORIZED,
     Forbidden = HTTP_STATUS_FORBIDDEN,
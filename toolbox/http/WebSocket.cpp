@@ -0,0 +1,326 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "WebSocket.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace toolbox {
+inline namespace http {
+using namespace std;
+namespace {
+
+constexpr string_view WsGuid{"258EAFA5-E914-47DA-95CA-C5AB0DC85B11"};
+
+/// SHA-1 is only used to derive the accept key from the client's nonce, for which it is mandated
+/// by RFC 6455, and must not be used for anything that requires collision resistance.
+void sha1(string_view in, unsigned char (&out)[20]) noexcept
+{
+    uint32_t h[5]{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+    const auto process = [&h](const unsigned char* block) {
+        uint32_t w[80];
+        for (int i{0}; i < 16; ++i) {
+            w[i] = uint32_t{block[i * 4]} << 24 | uint32_t{block[i * 4 + 1]} << 16
+                | uint32_t{block[i * 4 + 2]} << 8 | uint32_t{block[i * 4 + 3]};
+        }
+        for (int i{16}; i < 80; ++i) {
+            w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+        }
+        auto a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+        for (int i{0}; i < 80; ++i) {
+            uint32_t f, k;
+            if (i < 20) {
+                f = (b & c) | (~b & d);
+                k = 0x5a827999;
+            } else if (i < 40) {
+                f = b ^ c ^ d;
+                k = 0x6ed9eba1;
+            } else if (i < 60) {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8f1bbcdc;
+            } else {
+                f = b ^ c ^ d;
+                k = 0xca62c1d6;
+            }
+            const auto t = rotl(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = rotl(b, 30);
+            b = a;
+            a = t;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+    };
+    const auto* p = reinterpret_cast<const unsigned char*>(in.data());
+    auto n = in.size();
+    for (; n >= 64; n -= 64, p += 64) {
+        process(p);
+    }
+    // Pad the final block with a one bit, zeros, and the length in bits.
+    unsigned char block[128]{};
+    memcpy(block, p, n);
+    block[n] = 0x80;
+    const size_t blocks{n < 56 ? 1U : 2U};
+    const uint64_t bits{in.size() * 8};
+    for (int i{0}; i < 8; ++i) {
+        block[blocks * 64 - 1 - i] = static_cast<unsigned char>(bits >> (i * 8));
+    }
+    for (size_t i{0}; i < blocks; ++i) {
+        process(block + i * 64);
+    }
+    for (int i{0}; i < 5; ++i) {
+        out[i * 4] = static_cast<unsigned char>(h[i] >> 24);
+        out[i * 4 + 1] = static_cast<unsigned char>(h[i] >> 16);
+        out[i * 4 + 2] = static_cast<unsigned char>(h[i] >> 8);
+        out[i * 4 + 3] = static_cast<unsigned char>(h[i]);
+    }
+}
+
+string base64_encode(const unsigned char* data, size_t len)
+{
+    constexpr char Chars[]{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+    string out;
+    out.reserve((len + 2) / 3 * 4);
+    size_t i{0};
+    for (; i + 3 <= len; i += 3) {
+        const uint32_t v{uint32_t{data[i]} << 16 | uint32_t{data[i + 1]} << 8 | data[i + 2]};
+        out += Chars[v >> 18];
+        out += Chars[(v >> 12) & 0x3f];
+        out += Chars[(v >> 6) & 0x3f];
+        out += Chars[v & 0x3f];
+    }
+    if (const auto rem = len - i; rem > 0) {
+        uint32_t v{uint32_t{data[i]} << 16};
+        if (rem == 2) {
+            v |= uint32_t{data[i + 1]} << 8;
+        }
+        out += Chars[v >> 18];
+        out += Chars[(v >> 12) & 0x3f];
+        out += rem == 2 ? Chars[(v >> 6) & 0x3f] : '=';
+        out += '=';
+    }
+    return out;
+}
+
+/// Returns true if the comma separated list contains the token, ignoring case.
+bool has_token(string_view list, string_view token) noexcept
+{
+    while (!list.empty()) {
+        const auto pos = list.find(',');
+        auto item = list.substr(0, pos);
+        while (!item.empty() && (item.front() == ' ' || item.front() == '\t')) {
+            item.remove_prefix(1);
+        }
+        while (!item.empty() && (item.back() == ' ' || item.back() == '\t')) {
+            item.remove_suffix(1);
+        }
+        if (detail::iequals(item, token)) {
+            return true;
+        }
+        if (pos == string_view::npos) {
+            break;
+        }
+        list.remove_prefix(pos + 1);
+    }
+    return false;
+}
+
+} // namespace
+
+string ws_accept_key(string_view key)
+{
+    string s;
+    s.reserve(key.size() + WsGuid.size());
+    s.append(key).append(WsGuid);
+    unsigned char digest[20];
+    sha1(s, digest);
+    return base64_encode(digest, sizeof(digest));
+}
+
+size_t parse_ws_header(ConstBuffer buf, WsHeader& h) noexcept
+{
+    const auto* const p = static_cast<const unsigned char*>(buf.data());
+    const auto size = buffer_size(buf);
+    if (size < 2) {
+        return 0;
+    }
+    h.fin = (p[0] & 0x80) != 0;
+    h.rsv = (p[0] >> 4) & 0x7;
+    h.opcode = static_cast<WsOpcode>(p[0] & 0xf);
+    h.masked = (p[1] & 0x80) != 0;
+    uint64_t len{p[1] & 0x7fU};
+    size_t n{2};
+    if (len == 126) {
+        if (size < 4) {
+            return 0;
+        }
+        len = uint64_t{p[2]} << 8 | p[3];
+        n = 4;
+    } else if (len == 127) {
+        if (size < 10) {
+            return 0;
+        }
+        len = 0;
+        for (int i{2}; i < 10; ++i) {
+            len = len << 8 | p[i];
+        }
+        n = 10;
+    }
+    h.len = len;
+    h.mask = 0;
+    if (h.masked) {
+        if (size < n + 4) {
+            return 0;
+        }
+        memcpy(&h.mask, p + n, 4);
+        n += 4;
+    }
+    return n;
+}
+
+size_t put_ws_header(char* buf, WsOpcode opcode, size_t len, bool fin) noexcept
+{
+    auto* const p = reinterpret_cast<unsigned char*>(buf);
+    p[0] = (fin ? 0x80 : 0x00) | static_cast<unsigned char>(opcode);
+    if (len < 126) {
+        p[1] = static_cast<unsigned char>(len);
+        return 2;
+    }
+    if (len <= 0xffff) {
+        p[1] = 126;
+        p[2] = static_cast<unsigned char>(len >> 8);
+        p[3] = static_cast<unsigned char>(len);
+        return 4;
+    }
+    p[1] = 127;
+    for (int i{0}; i < 8; ++i) {
+        p[9 - i] = static_cast<unsigned char>(static_cast<uint64_t>(len) >> (i * 8));
+    }
+    return 10;
+}
+
+void ws_mask(char* data, size_t len, uint32_t mask) noexcept
+{
+    // The key repeats every four bytes, so each wider block starts at key offset zero, and the
+    // scalar tail starts at a multiple of eight.
+    size_t i{0};
+#if defined(__AVX2__)
+    const auto m256 = _mm256_set1_epi32(static_cast<int>(mask));
+    for (; len - i >= 32; i += 32) {
+        auto* const p = reinterpret_cast<__m256i*>(data + i);
+        _mm256_storeu_si256(p, _mm256_xor_si256(_mm256_loadu_si256(p), m256));
+    }
+#endif
+#if defined(__SSE2__)
+    const auto m128 = _mm_set1_epi32(static_cast<int>(mask));
+    for (; len - i >= 16; i += 16) {
+        auto* const p = reinterpret_cast<__m128i*>(data + i);
+        _mm_storeu_si128(p, _mm_xor_si128(_mm_loadu_si128(p), m128));
+    }
+#endif
+    uint64_t m64;
+    memcpy(&m64, &mask, 4);
+    memcpy(reinterpret_cast<char*>(&m64) + 4, &mask, 4);
+    for (; len - i >= 8; i += 8) {
+        uint64_t w;
+        memcpy(&w, data + i, 8);
+        w ^= m64;
+        memcpy(data + i, &w, 8);
+    }
+    const auto* const key = reinterpret_cast<const unsigned char*>(&mask);
+    for (; i < len; ++i) {
+        data[i] = static_cast<char>(data[i] ^ key[i & 3]);
+    }
+}
+
+namespace detail {
+
+string_view ws_upgrade_key(string_view upgrade, string_view connection, string_view version,
+                           string_view key) noexcept
+{
+    // The key is a base64 encoded 16 byte nonce.
+    if (key.size() != 24 || version != "13" || !has_token(upgrade, "websocket")
+        || !has_token(connection, "upgrade")) {
+        return {};
+    }
+    return key;
+}
+
+} // namespace detail
+
+WsFrame::WsFrame(WsOpcode opcode, string_view payload, bool fin)
+{
+    char head[MaxWsHeaderSize];
+    const auto n = put_ws_header(head, opcode, payload.size(), fin);
+    buf_.reserve(n + payload.size());
+    buf_.append(head, n).append(payload);
+}
+
+WsFrame::~WsFrame() = default;
+
+WebSocket::~WebSocket() = default;
+
+void WebSocket::send(string_view msg, WsOpcode opcode)
+{
+    char head[MaxWsHeaderSize];
+    const auto n = put_ws_header(head, opcode, msg.size());
+    do_send({head, n}, msg);
+}
+
+void WebSocket::ping(string_view payload)
+{
+    if (payload.size() > 125) {
+        throw invalid_argument{"control frame payload too large"};
+    }
+    char head[MaxWsHeaderSize];
+    const auto n = put_ws_header(head, WsOpcode::Ping, payload.size());
+    do_send({head, n}, payload);
+}
+
+WsHandler::~WsHandler() = default;
+
+WsGroup::~WsGroup() = default;
+
+void WsGroup::insert(WebSocket& ws) noexcept
+{
+    ws.group_hook_.unlink();
+    members_.push_back(ws);
+}
+
+void WsGroup::erase(WebSocket& ws) noexcept
+{
+    ws.group_hook_.unlink();
+}
+
+void WsGroup::broadcast(const WsFrame& frame)
+{
+    for (auto& ws : members_) {
+        ws.send(frame);
+    }
+}
+
+} // namespace http
+} // namespace toolbox
@@ -0,0 +1,298 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_HTTP_WEBSOCKET_HPP
+#define TOOLBOX_HTTP_WEBSOCKET_HPP
+
+#include <toolbox/http/SimdParser.hpp>
+#include <toolbox/http/Types.hpp>
+#include <toolbox/net/Endpoint.hpp>
+
+#include <boost/intrusive/list.hpp>
+
+#include <string>
+
+namespace toolbox {
+inline namespace http {
+
+enum class WsOpcode : std::uint8_t {
+    Continuation = 0x0,
+    Text = 0x1,
+    Binary = 0x2,
+    Close = 0x8,
+    Ping = 0x9,
+    Pong = 0xa
+};
+
+/// Close status codes from RFC 6455. Peers may send other codes, so the enumeration is not
+/// exhaustive.
+enum class WsClose : std::uint16_t {
+    Normal = 1000,
+    GoingAway = 1001,
+    ProtocolError = 1002,
+    Unsupported = 1003,
+    /// Reserved for close notifications when the peer's close frame had no status code.
+    NoStatus = 1005,
+    /// Reserved for close notifications when the connection was closed without a close frame.
+    Abnormal = 1006,
+    InvalidData = 1007,
+    PolicyViolation = 1008,
+    TooBig = 1009,
+    InternalError = 1011
+};
+
+/// The decoded header of a WebSocket frame.
+struct WsHeader {
+    bool fin{true};
+    /// The RSV1-3 bits, which must be zero unless an extension has been negotiated.
+    std::uint8_t rsv{0};
+    WsOpcode opcode{WsOpcode::Continuation};
+    bool masked{false};
+    /// The masking key, in network byte order.
+    std::uint32_t mask{0};
+    std::uint64_t len{0};
+};
+
+/// The maximum size of an unmasked frame header, i.e. one that was sent by a server.
+inline constexpr std::size_t MaxWsHeaderSize{10};
+
+inline constexpr bool is_control(WsOpcode opcode) noexcept
+{
+    return (static_cast<std::uint8_t>(opcode) & 0x8) != 0;
+}
+
+/// Returns true if the status code may be sent in a close frame. The codes 1005 and 1006 are
+/// reserved for local use, and codes below 3000 are otherwise reserved for the protocol.
+inline constexpr bool is_valid_close(std::uint16_t code) noexcept
+{
+    return (code >= 1000 && code <= 1003) || (code >= 1007 && code <= 1011)
+        || (code >= 3000 && code <= 4999);
+}
+
+/// Returns the Sec-WebSocket-Accept value for the client's Sec-WebSocket-Key.
+TOOLBOX_API std::string ws_accept_key(std::string_view key);
+
+/// Decodes a frame header. Returns the size of the header, or zero if the buffer does not yet
+/// contain a complete header.
+TOOLBOX_API std::size_t parse_ws_header(ConstBuffer buf, WsHeader& h) noexcept;
+
+/// Encodes an unmasked frame header into the buffer, which must have room for MaxWsHeaderSize
+/// bytes. Returns the size of the header.
+TOOLBOX_API std::size_t put_ws_header(char* buf, WsOpcode opcode, std::size_t len,
+                                      bool fin = true) noexcept;
+
+/// Applies the masking key, in network byte order, to the payload. The payload is processed in
+/// vector registers or machine words where possible, and masking twice restores the payload.
+TOOLBOX_API void ws_mask(char* data, std::size_t len, std::uint32_t mask) noexcept;
+
+namespace detail {
+/// Returns the client's key if the header values describe a valid WebSocket upgrade, or an empty
+/// view otherwise.
+TOOLBOX_API std::string_view ws_upgrade_key(std::string_view upgrade, std::string_view connection,
+                                            std::string_view version,
+                                            std::string_view key) noexcept;
+} // namespace detail
+
+/// Returns the Sec-WebSocket-Key if the request is a valid WebSocket upgrade request, or an empty
+/// view otherwise. The RequestT type may be Request or RequestView.
+template <typename RequestT>
+std::string_view ws_upgrade_key(const RequestT& req) noexcept
+{
+    if (req.method() != Method::Get) {
+        return {};
+    }
+    std::string_view upgrade, connection, version, key;
+    for (const auto& [field, value] : req.headers()) {
+        if (detail::iequals(field, "Upgrade")) {
+            upgrade = value;
+        } else if (detail::iequals(field, "Connection")) {
+            connection = value;
+        } else if (detail::iequals(field, "Sec-WebSocket-Version")) {
+            version = value;
+        } else if (detail::iequals(field, "Sec-WebSocket-Key")) {
+            key = value;
+        }
+    }
+    return detail::ws_upgrade_key(upgrade, connection, version, key);
+}
+
+/// A complete frame that is encoded once, and may then be sent to any number of connections
+/// without being encoded again.
+class TOOLBOX_API WsFrame {
+  public:
+    WsFrame(WsOpcode opcode, std::string_view payload, bool fin = true);
+    ~WsFrame();
+
+    // Copy.
+    WsFrame(const WsFrame&) = default;
+    WsFrame& operator=(const WsFrame&) = default;
+
+    // Move.
+    WsFrame(WsFrame&&) noexcept = default;
+    WsFrame& operator=(WsFrame&&) noexcept = default;
+
+    /// Returns the encoded frame, including the header.
+    std::string_view data() const noexcept { return buf_; }
+
+  private:
+    std::string buf_;
+};
+
+/// The server side of an upgraded WebSocket connection, which is passed to the WsHandler.
+///
+/// Frames are queued on the connection, and are written to the socket at the end of the current
+/// Reactor cycle, so that all of the frames sent to a connection in one cycle are written together.
+/// A peer that does not read its frames would otherwise cause its queue to grow without limit, so
+/// a send that would take the queue beyond the high-water mark closes the connection with
+/// WsClose::PolicyViolation, and the frame is discarded.
+class TOOLBOX_API WebSocket {
+    friend class WsGroup;
+    // Automatically unlink when object is destroyed.
+    using AutoUnlinkOption = boost::intrusive::link_mode<boost::intrusive::auto_unlink>;
+
+  public:
+    using Endpoint = StreamEndpoint;
+
+    /// The maximum size of a message received from the peer. Larger messages, including those
+    /// assembled from fragments, close the connection with WsClose::TooBig.
+    static constexpr std::size_t MaxMessageSize{1 << 20};
+    /// The default high-water mark for queued output.
+    static constexpr std::size_t DefaultMaxQueued{4 << 20};
+
+    // Copy.
+    WebSocket(const WebSocket&) = delete;
+    WebSocket& operator=(const WebSocket&) = delete;
+
+    // Move.
+    WebSocket(WebSocket&&) = delete;
+    WebSocket& operator=(WebSocket&&) = delete;
+
+    const Endpoint& endpoint() const noexcept { return do_endpoint(); }
+    /// Returns the number of bytes that are queued on the connection and not yet written.
+    std::size_t queued() const noexcept { return do_queued(); }
+    /// Returns the high-water mark for queued output.
+    std::size_t max_queued() const noexcept { return max_queued_; }
+    void set_max_queued(std::size_t max_queued) noexcept { max_queued_ = max_queued; }
+
+    /// Sends a message as a single frame. The opcode should be Text or Binary.
+    void send(std::string_view msg, WsOpcode opcode = WsOpcode::Text);
+    /// Sends a pre-encoded frame.
+    void send(const WsFrame& frame) { do_send(frame.data(), {}); }
+    void ping(std::string_view payload = {});
+    /// Sends a close frame, and closes the connection once the frame has been written. Further
+    /// sends are discarded.
+    void close(WsClose code = WsClose::Normal, std::string_view reason = {})
+    {
+        do_close(code, reason);
+    }
+
+  protected:
+    WebSocket() noexcept = default;
+    ~WebSocket();
+
+    virtual const Endpoint& do_endpoint() const noexcept = 0;
+    virtual std::size_t do_queued() const noexcept = 0;
+    /// Queues the header and payload, which are written without modification, or closes the
+    /// connection if the queue would exceed the high-water mark.
+    virtual void do_send(std::string_view head, std::string_view payload) = 0;
+    virtual void do_close(WsClose code, std::string_view reason) = 0;
+
+  private:
+    std::size_t max_queued_{DefaultMaxQueued};
+    boost::intrusive::list_member_hook<AutoUnlinkOption> group_hook_;
+};
+
+/// Handler interface for upgraded WebSocket connections.
+class TOOLBOX_API WsHandler {
+  public:
+    WsHandler() noexcept = default;
+    virtual ~WsHandler();
+
+    // Copy.
+    constexpr WsHandler(const WsHandler&) noexcept = default;
+    WsHandler& operator=(const WsHandler&) noexcept = default;
+
+    // Move.
+    constexpr WsHandler(WsHandler&&) noexcept = default;
+    WsHandler& operator=(WsHandler&&) noexcept = default;
+
+    void on_ws_open(CyclTime now, WebSocket& ws) { do_on_ws_open(now, ws); }
+    /// Called with each complete message, after any fragments have been reassembled. The message
+    /// is only valid for the duration of the callback.
+    void on_ws_message(CyclTime now, WebSocket& ws, WsOpcode opcode, std::string_view msg)
+    {
+        do_on_ws_message(now, ws, opcode, msg);
+    }
+    /// Called once when the connection closes for any reason, after which the WebSocket must not
+    /// be used.
+    void on_ws_close(CyclTime now, WebSocket& ws, WsClose code) noexcept
+    {
+        do_on_ws_close(now, ws, code);
+    }
+
+  protected:
+    virtual void do_on_ws_open(CyclTime now, WebSocket& ws) = 0;
+    virtual void do_on_ws_message(CyclTime now, WebSocket& ws, WsOpcode opcode,
+                                  std::string_view msg)
+        = 0;
+    virtual void do_on_ws_close(CyclTime now, WebSocket& ws, WsClose code) noexcept = 0;
+};
+
+/// A set of connections that receive the same messages, such as the subscribers to a price stream.
+/// Each broadcast message is encoded once, and the encoded frame is then copied to each member's
+/// output buffer. A connection is a member of at most one group, and it leaves the group when it is
+/// destroyed, so members need not be removed explicitly.
+class TOOLBOX_API WsGroup {
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<false>;
+    using MemberHookOption
+        = boost::intrusive::member_hook<WebSocket, decltype(WebSocket::group_hook_),
+                                        &WebSocket::group_hook_>;
+    using List = boost::intrusive::list<WebSocket, ConstantTimeSizeOption, MemberHookOption>;
+
+  public:
+    WsGroup() = default;
+    ~WsGroup();
+
+    // Copy.
+    WsGroup(const WsGroup&) = delete;
+    WsGroup& operator=(const WsGroup&) = delete;
+
+    // Move.
+    WsGroup(WsGroup&&) noexcept = default;
+    WsGroup& operator=(WsGroup&&) noexcept = default;
+
+    bool empty() const noexcept { return members_.empty(); }
+    /// Returns the number of members, in linear time.
+    std::size_t size() const noexcept { return members_.size(); }
+
+    /// Inserts the connection, which leaves its current group, if any.
+    void insert(WebSocket& ws) noexcept;
+    /// Removes the connection from its group.
+    void erase(WebSocket& ws) noexcept;
+
+    void broadcast(const WsFrame& frame);
+    void broadcast(std::string_view msg, WsOpcode opcode = WsOpcode::Text)
+    {
+        broadcast(WsFrame{opcode, msg});
+    }
+
+  private:
+    List members_;
+};
+
+} // namespace http
+} // namespace toolbox
+
+#endif // TOOLBOX_HTTP_WEBSOCKET_HPP
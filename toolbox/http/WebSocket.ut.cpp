@@ -0,0 +1,509 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "WebSocket.hpp"
+
+#include <toolbox/http/App.hpp>
+#include <toolbox/http/Conn.hpp>
+#include <toolbox/net/IoSock.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct Req {
+    Method method() const noexcept { return method_; }
+    const auto& headers() const noexcept { return headers_; }
+    Method method_{Method::Get};
+    vector<pair<string_view, string_view>> headers_;
+};
+
+constexpr auto UpgradeRequest =                       //
+    "GET /prices HTTP/1.1\r\n"                        //
+    "Host: localhost\r\n"                             //
+    "Upgrade: websocket\r\n"                          //
+    "Connection: keep-alive, Upgrade\r\n"             //
+    "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n" //
+    "Sec-WebSocket-Version: 13\r\n"                   //
+    "\r\n"sv;
+
+/// Encodes a masked frame, as a client would.
+string client_frame(WsOpcode opcode, string_view payload, bool fin = true)
+{
+    char head[MaxWsHeaderSize];
+    const auto n = put_ws_header(head, opcode, payload.size(), fin);
+    head[1] = static_cast<char>(head[1] | 0x80);
+    const char key[]{'\x12', '\x34', '\x56', '\x78'};
+    string frame{head, n};
+    frame.append(key, 4);
+    string masked{payload};
+    uint32_t mask;
+    memcpy(&mask, key, 4);
+    ws_mask(masked.data(), masked.size(), mask);
+    return frame + masked;
+}
+
+/// Records the WebSocket events, echoes messages, and closes the connection when asked to.
+class Handler final : public WsHandler {
+  public:
+    vector<string> events;
+    WsGroup group;
+    WebSocket* last{nullptr};
+
+  protected:
+    void do_on_ws_open(CyclTime /*now*/, WebSocket& ws) override
+    {
+        events.emplace_back("open");
+        group.insert(ws);
+        last = &ws;
+    }
+    void do_on_ws_message(CyclTime /*now*/, WebSocket& ws, WsOpcode opcode,
+                          string_view msg) override
+    {
+        events.emplace_back((opcode == WsOpcode::Text ? "text:"s : "binary:"s) + string{msg});
+        if (msg == "close") {
+            ws.close(WsClose::GoingAway, "bye");
+        } else {
+            ws.send(msg, opcode);
+        }
+    }
+    // Closed connections leave the group without being erased.
+    void do_on_ws_close(CyclTime /*now*/, WebSocket& ws, WsClose code) noexcept override
+    {
+        events.emplace_back("close:" + to_string(static_cast<int>(code)));
+        if (last == &ws) {
+            last = nullptr;
+        }
+    }
+};
+
+template <typename RequestT>
+class TestApp final : public BasicApp<RequestT> {
+    using typename BasicApp<RequestT>::Endpoint;
+
+  public:
+    explicit TestApp(WsHandler* handler)
+    : handler_{handler}
+    {
+    }
+    int messages{0};
+
+  protected:
+    void do_on_http_connect(CyclTime /*now*/, const Endpoint& /*ep*/) override {}
+    void do_on_http_disconnect(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    void do_on_http_error(CyclTime /*now*/, const Endpoint& /*ep*/, const std::exception& /*e*/,
+                          http::OStream& /*os*/) noexcept override
+    {
+    }
+    void do_on_http_message(CyclTime /*now*/, const Endpoint& /*ep*/, const RequestT& /*req*/,
+                            http::OStream& os) override
+    {
+        ++messages;
+        os.reset(Status::NotFound, TextPlain);
+        os << "no";
+        os.commit();
+    }
+    void do_on_http_timeout(CyclTime /*now*/, const Endpoint& /*ep*/) noexcept override {}
+    WsHandler* do_on_ws_upgrade(CyclTime /*now*/, const Endpoint& /*ep*/,
+                                const RequestT& /*req*/) override
+    {
+        return handler_;
+    }
+
+  private:
+    WsHandler* handler_;
+};
+
+/// The client end of a connection to a BasicConn over a socket pair.
+template <typename RequestT, template <typename> class ParserT = BasicParser>
+class Peer {
+  public:
+    Peer(Reactor& r, BasicApp<RequestT>& app)
+    : r_{r}
+    {
+        auto socks = socketpair(UnixStreamProtocol{});
+        socks.first.set_non_block();
+        socks.second.set_non_block();
+        sock_ = std::move(socks.first);
+        new BasicConn<RequestT, BasicApp<RequestT>, ParserT>{
+            CyclTime::now(), r, std::move(socks.second), StreamEndpoint{}, app};
+    }
+    ~Peer() { close(); }
+    void close()
+    {
+        if (sock_) {
+            sock_.close();
+            r_.poll(CyclTime::now(), 0ms);
+        }
+    }
+    void write(string_view sv)
+    {
+        os::write(sock_.get(), sv.data(), sv.size());
+        poll();
+    }
+    /// Runs the reactor, including the end of cycle hooks that flush output.
+    void poll()
+    {
+        for (int i{0}; i < 3; ++i) {
+            r_.poll(CyclTime::now(), 0ms);
+        }
+    }
+    /// Returns all of the data that is available to read, or EOF if the peer has closed.
+    string read()
+    {
+        string out;
+        char buf[4096];
+        for (;;) {
+            error_code ec;
+            const auto n = os::read(sock_.get(), buf, sizeof(buf), ec);
+            if (ec) {
+                break;
+            }
+            if (n == 0) {
+                out += "EOF";
+                break;
+            }
+            out.append(buf, n);
+        }
+        return out;
+    }
+
+  private:
+    Reactor& r_;
+    IoSock sock_;
+};
+
+/// Decodes the server frames in the string as "opcode:payload" strings.
+vector<string> decode(string_view sv)
+{
+    vector<string> frames;
+    for (;;) {
+        WsHeader h;
+        const auto n = parse_ws_header({sv.data(), sv.size()}, h);
+        if (n == 0 || sv.size() < n + h.len) {
+            break;
+        }
+        BOOST_CHECK(!h.masked);
+        const auto payload = sv.substr(n, h.len);
+        if (h.opcode == WsOpcode::Close && payload.size() >= 2) {
+            const auto* const p = reinterpret_cast<const unsigned char*>(payload.data());
+            frames.push_back("8:" + to_string(p[0] << 8 | p[1]) + string{payload.substr(2)});
+        } else {
+            frames.push_back(to_string(static_cast<int>(h.opcode)) + ':' + string{payload});
+        }
+        sv.remove_prefix(n + h.len);
+    }
+    if (!sv.empty()) {
+        frames.emplace_back(sv);
+    }
+    return frames;
+}
+
+template <typename RequestT, template <typename> class ParserT = BasicParser>
+void check_echo()
+{
+    Reactor r{1024};
+    Handler handler;
+    TestApp<RequestT> app{&handler};
+    Peer<RequestT, ParserT> peer{r, app};
+
+    // The first frame arrives with the upgrade request.
+    peer.write(string{UpgradeRequest} + client_frame(WsOpcode::Text, "hello"));
+    const auto resp = peer.read();
+    BOOST_CHECK(resp.starts_with("HTTP/1.1 101 Switching Protocols\r\n"));
+    BOOST_CHECK(resp.find("Sec-WebSocket-Accept: s3pPLMBiTxaQ9kYGzzhZRbK+xOo=\r\n")
+                != string::npos);
+    const auto pos = resp.find("\r\n\r\n");
+    BOOST_REQUIRE(pos != string::npos);
+    const vector<string> echo{"1:hello"};
+    const auto frames = decode(string_view{resp}.substr(pos + 4));
+    BOOST_CHECK_EQUAL_COLLECTIONS(frames.begin(), frames.end(), echo.begin(), echo.end());
+
+    // A fragmented message with an interleaved ping.
+    peer.write(client_frame(WsOpcode::Binary, "abc", false) + client_frame(WsOpcode::Ping, "p")
+               + client_frame(WsOpcode::Continuation, "def", false)
+               + client_frame(WsOpcode::Continuation, "ghi"));
+    const vector<string> expected{"10:p", "2:abcdefghi"};
+    const auto frames2 = decode(peer.read());
+    BOOST_CHECK_EQUAL_COLLECTIONS(frames2.begin(), frames2.end(), expected.begin(),
+                                  expected.end());
+
+    // The peer initiates the close handshake.
+    peer.write(client_frame(WsOpcode::Close, "\x03\xe8"));
+    const vector<string> closed{"8:1000", "EOF"};
+    const auto frames3 = decode(peer.read());
+    BOOST_CHECK_EQUAL_COLLECTIONS(frames3.begin(), frames3.end(), closed.begin(), closed.end());
+
+    const vector<string> events{"open", "text:hello", "binary:abcdefghi", "close:1000"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(handler.events.begin(), handler.events.end(), events.begin(),
+                                  events.end());
+    BOOST_CHECK_EQUAL(app.messages, 0);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(WebSocketSuite)
+
+BOOST_AUTO_TEST_CASE(WsAcceptKeyCase)
+{
+    // The example from RFC 6455.
+    BOOST_CHECK_EQUAL(ws_accept_key("dGhlIHNhbXBsZSBub25jZQ=="), "s3pPLMBiTxaQ9kYGzzhZRbK+xOo=");
+}
+
+BOOST_AUTO_TEST_CASE(WsHeaderCase)
+{
+    for (const size_t len : {0UL, 1UL, 125UL, 126UL, 65535UL, 65536UL, 1UL << 32}) {
+        char buf[MaxWsHeaderSize];
+        const auto n = put_ws_header(buf, WsOpcode::Binary, len, false);
+        BOOST_CHECK_EQUAL(n, len < 126 ? 2U : len <= 65535 ? 4U : 10U);
+        WsHeader h;
+        BOOST_CHECK_EQUAL(parse_ws_header({buf, n}, h), n);
+        BOOST_CHECK(!h.fin);
+        BOOST_CHECK_EQUAL(h.rsv, 0);
+        BOOST_CHECK(h.opcode == WsOpcode::Binary);
+        BOOST_CHECK(!h.masked);
+        BOOST_CHECK_EQUAL(h.len, len);
+        // Incomplete headers are not decoded.
+        BOOST_CHECK_EQUAL(parse_ws_header({buf, n - 1}, h), 0U);
+    }
+    const auto frame = client_frame(WsOpcode::Text, "hello");
+    WsHeader h;
+    BOOST_CHECK_EQUAL(parse_ws_header({frame.data(), frame.size()}, h), 6U);
+    BOOST_CHECK(h.fin);
+    BOOST_CHECK(h.masked);
+    BOOST_CHECK(h.opcode == WsOpcode::Text);
+    BOOST_CHECK_EQUAL(h.len, 5U);
+    BOOST_CHECK_EQUAL(parse_ws_header({frame.data(), 5}, h), 0U);
+
+    const WsFrame f{WsOpcode::Text, "hello"};
+    BOOST_CHECK_EQUAL(f.data(), "\x81\x05hello"sv);
+}
+
+BOOST_AUTO_TEST_CASE(WsMaskCase)
+{
+    const unsigned char key[]{0xa1, 0xb2, 0xc3, 0xd4};
+    uint32_t mask;
+    memcpy(&mask, key, 4);
+    // Cover the vector, word and byte paths at every alignment.
+    for (size_t off{0}; off < 8; ++off) {
+        for (size_t len{0}; len < 100; ++len) {
+            string data(off + len, '\0');
+            for (size_t i{0}; i < data.size(); ++i) {
+                data[i] = static_cast<char>(i * 7);
+            }
+            const auto orig = data;
+            ws_mask(data.data() + off, len, mask);
+            bool ok{true};
+            for (size_t i{0}; i < len; ++i) {
+                ok &= data[off + i] == static_cast<char>(orig[off + i] ^ key[i % 4]);
+            }
+            BOOST_CHECK(ok);
+            BOOST_CHECK_EQUAL(data.substr(0, off), orig.substr(0, off));
+            ws_mask(data.data() + off, len, mask);
+            BOOST_CHECK_EQUAL(data, orig);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(WsUpgradeKeyCase)
+{
+    constexpr auto Key = "dGhlIHNhbXBsZSBub25jZQ=="sv;
+    Req req;
+    req.headers_ = {{"upgrade", "WebSocket"},
+                    {"Connection", "keep-alive, Upgrade"},
+                    {"Sec-WebSocket-Version", "13"},
+                    {"sec-websocket-key", Key}};
+    BOOST_CHECK_EQUAL(ws_upgrade_key(req), Key);
+
+    req.method_ = Method::Post;
+    BOOST_CHECK(ws_upgrade_key(req).empty());
+    req.method_ = Method::Get;
+
+    req.headers_[1].second = "keep-alive";
+    BOOST_CHECK(ws_upgrade_key(req).empty());
+    req.headers_[1].second = "Upgrade";
+    req.headers_[2].second = "8";
+    BOOST_CHECK(ws_upgrade_key(req).empty());
+    req.headers_[2].second = "13";
+    req.headers_[3].second = "short";
+    BOOST_CHECK(ws_upgrade_key(req).empty());
+}
+
+BOOST_AUTO_TEST_CASE(WsEchoCase)
+{
+    check_echo<Request>();
+}
+
+BOOST_AUTO_TEST_CASE(WsEchoViewSimdCase)
+{
+    check_echo<RequestView, BasicSimdParser>();
+}
+
+BOOST_AUTO_TEST_CASE(WsCloseCase)
+{
+    Reactor r{1024};
+    Handler handler;
+    TestApp<Request> app{&handler};
+    Peer<Request> peer{r, app};
+    peer.write(UpgradeRequest);
+    peer.read();
+
+    // The handler initiates the close, and the remaining input is discarded.
+    peer.write(client_frame(WsOpcode::Text, "close") + client_frame(WsOpcode::Text, "ignored"));
+    const vector<string> expected{"8:1001bye", "EOF"};
+    const auto frames = decode(peer.read());
+    BOOST_CHECK_EQUAL_COLLECTIONS(frames.begin(), frames.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(handler.events.back(), "close:1001");
+}
+
+BOOST_AUTO_TEST_CASE(WsCloseCodeCase)
+{
+    BOOST_TEST(is_valid_close(1000));
+    BOOST_TEST(is_valid_close(1003));
+    BOOST_TEST(!is_valid_close(1004));
+    BOOST_TEST(!is_valid_close(1005));
+    BOOST_TEST(!is_valid_close(1006));
+    BOOST_TEST(is_valid_close(1007));
+    BOOST_TEST(is_valid_close(1011));
+    BOOST_TEST(!is_valid_close(1012));
+    BOOST_TEST(!is_valid_close(2999));
+    BOOST_TEST(is_valid_close(3000));
+    BOOST_TEST(is_valid_close(4999));
+    BOOST_TEST(!is_valid_close(5000));
+
+    // An application status code is echoed.
+    Reactor r{1024};
+    Handler handler;
+    TestApp<Request> app{&handler};
+    Peer<Request> peer{r, app};
+    peer.write(UpgradeRequest);
+    peer.read();
+    peer.write(client_frame(WsOpcode::Close, "\x0f\xa0"));
+    const vector<string> expected{"8:4000", "EOF"};
+    const auto frames = decode(peer.read());
+    BOOST_CHECK_EQUAL_COLLECTIONS(frames.begin(), frames.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(WsProtocolErrorCase)
+{
+    const string frames[]{// Unmasked.
+                          string{"\x81\x01x"},
+                          // Reserved bits.
+                          client_frame(WsOpcode::Text, "x").replace(0, 1, "\xc1"),
+                          // Continuation without a message.
+                          client_frame(WsOpcode::Continuation, "x"),
+                          // Fragmented control frame.
+                          client_frame(WsOpcode::Ping, "x", false),
+                          // Unknown opcode.
+                          client_frame(static_cast<WsOpcode>(3), "x"),
+                          // New message while a fragmented message is in progress.
+                          client_frame(WsOpcode::Text, "x", false)
+                              + client_frame(WsOpcode::Text, "y"),
+                          // Close with a status code that is reserved for local use.
+                          client_frame(WsOpcode::Close, "\x03\xed"),
+                          // Close with a status code that is not defined.
+                          client_frame(WsOpcode::Close, "\x03\xec"),
+                          // Close with a status code outside the registered ranges.
+                          client_frame(WsOpcode::Close, "\x13\x88")};
+    for (const auto& frame : frames) {
+        Reactor r{1024};
+        Handler handler;
+        TestApp<Request> app{&handler};
+        Peer<Request> peer{r, app};
+        peer.write(UpgradeRequest);
+        peer.read();
+        peer.write(frame);
+        const vector<string> expected{"8:1002", "EOF"};
+        const auto actual = decode(peer.read());
+        BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(),
+                                      expected.end());
+        BOOST_CHECK_EQUAL(handler.events.back(), "close:1002");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(WsBroadcastCase)
+{
+    Reactor r{1024};
+    Handler handler;
+    TestApp<Request> app{&handler};
+    Peer<Request> peer1{r, app};
+    Peer<Request> peer2{r, app};
+    peer1.write(UpgradeRequest);
+    peer2.write(UpgradeRequest);
+    peer1.read();
+    peer2.read();
+    BOOST_CHECK_EQUAL(handler.group.size(), 2U);
+
+    // Frames sent in the same cycle are written together.
+    handler.group.broadcast("EURUSD 1.0875");
+    handler.group.broadcast(WsFrame{WsOpcode::Binary, "GBPUSD"});
+    peer1.poll();
+    const vector<string> expected{"1:EURUSD 1.0875", "2:GBPUSD"};
+    for (auto* const peer : {&peer1, &peer2}) {
+        const auto frames = decode(peer->read());
+        BOOST_CHECK_EQUAL_COLLECTIONS(frames.begin(), frames.end(), expected.begin(),
+                                      expected.end());
+    }
+
+    // Closed connections leave the group.
+    peer1.close();
+    BOOST_CHECK_EQUAL(handler.group.size(), 1U);
+    BOOST_CHECK_EQUAL(handler.events.back(), "close:1006");
+}
+
+BOOST_AUTO_TEST_CASE(WsSlowConsumerCase)
+{
+    Reactor r{1024};
+    Handler handler;
+    TestApp<Request> app{&handler};
+    Peer<Request> peer{r, app};
+    peer.write(UpgradeRequest);
+    peer.read();
+    BOOST_REQUIRE(handler.last);
+
+    auto& ws = *handler.last;
+    BOOST_CHECK_EQUAL(ws.max_queued(), WebSocket::DefaultMaxQueued);
+    ws.set_max_queued(64);
+    const string msg(40, 'x');
+    ws.send(msg);
+    BOOST_CHECK_EQUAL(ws.queued(), 2 + msg.size());
+
+    // The frame that would exceed the high-water mark is discarded, and the connection is closed.
+    handler.group.broadcast(msg);
+    const vector<string> expected{"1:" + msg, "8:1008slow consumer", "EOF"};
+    peer.poll();
+    const auto frames = decode(peer.read());
+    BOOST_CHECK_EQUAL_COLLECTIONS(frames.begin(), frames.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(handler.events.back(), "close:1008");
+    BOOST_CHECK(handler.group.empty());
+}
+
+BOOST_AUTO_TEST_CASE(WsDeclinedCase)
+{
+    // The request is handled as a normal HTTP request if the App declines the upgrade.
+    Reactor r{1024};
+    TestApp<Request> app{nullptr};
+    Peer<Request> peer{r, app};
+    peer.write(UpgradeRequest);
+    BOOST_CHECK(peer.read().starts_with("HTTP/1.1 404"));
+    BOOST_CHECK_EQUAL(app.messages, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,8 @@
 #define TOOLBOX_IO_HPP
 
 #include "io/Buffer.hpp"
+#include "io/BufferCache.hpp"
+#include "io/BufferChain.hpp"
 #include "io/Disposer.hpp"
 #include "io/Epoll.hpp"
 #include "io/Event.hpp"
@@ -25,7 +27,10 @@
 #include "io/File.hpp"
 #include "io/Handle.hpp"
 #include "io/Hook.hpp"
+#include "io/IdleReaper.hpp"
 #include "io/Inotify.hpp"
+#include "io/MirroredBuffer.hpp"
+#include "io/Mmap.hpp"
 #include "io/Reactor.hpp"
 #include "io/Runner.hpp"
 #include "io/Stream.hpp"
@@ -73,6 +73,9 @@ class TOOLBOX_API Buffer {
     /// Returns number of bytes available for read.
     std::size_t size() const noexcept { return wpos_ - rpos_; }
 
+    /// Returns the size of the allocated storage.
+    std::size_t capacity() const noexcept { return buf_.capacity(); }
+
     /// Clear buffer.
     void clear() noexcept { rpos_ = wpos_ = 0; }
 
@@ -96,7 +99,17 @@ class TOOLBOX_API Buffer {
     /// Reserve storage.
     void reserve(std::size_t capacity) { buf_.reserve(capacity); }
 
+    /// Exchanges the contents and storage of the buffers.
+    void swap(Buffer& rhs) noexcept
+    {
+        std::swap(rpos_, rhs.rpos_);
+        std::swap(wpos_, rhs.wpos_);
+        buf_.swap(rhs.buf_);
+    }
+
     char* wptr() noexcept { return buf_.data() + wpos_; }
+    /// Returns a pointer to the available data, which may be modified in place.
+    char* rptr() noexcept { return buf_.data() + rpos_; }
 
   private:
     const char* rptr() const noexcept { return buf_.data() + rpos_; }
@@ -0,0 +1,48 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BufferCache.hpp"
+
+namespace toolbox {
+inline namespace io {
+using namespace std;
+
+BufferCache::BufferCache(size_t max_capacity, size_t max_size)
+: max_capacity_{max_capacity}
+, max_size_{max_size}
+{
+    // Reserve up-front, so that release() never allocates.
+    bufs_.reserve(max_size_);
+}
+
+BufferCache::~BufferCache() = default;
+
+void BufferCache::release(Buffer& buf) noexcept
+{
+    const auto capacity = buf.capacity();
+    if (capacity == 0) {
+        return;
+    }
+    buf.clear();
+    if (capacity > max_capacity_ || bufs_.size() == max_size_) {
+        buf = Buffer{};
+        return;
+    }
+    bufs_.emplace_back();
+    bufs_.back().swap(buf);
+}
+
+} // namespace io
+} // namespace toolbox
@@ -0,0 +1,68 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_IO_BUFFERCACHE_HPP
+#define TOOLBOX_IO_BUFFERCACHE_HPP
+
+#include <toolbox/io/Buffer.hpp>
+
+#include <vector>
+
+namespace toolbox {
+inline namespace io {
+
+/// Cache of buffer storage that is shared by a set of connections, so that idle connections do not
+/// hold buffer storage. A connection releases a buffer's storage to the cache when the buffer has
+/// been drained, and acquires cached storage before it next reads or writes. Unlike BufferPool, the
+/// cache recycles the storage of ordinary Buffers, so connections need not change buffer type.
+///
+/// Storage that has grown beyond the maximum capacity is freed instead of being cached, so that a
+/// single large message does not pin a peak-sized buffer for the lifetime of the connection.
+class TOOLBOX_API BufferCache {
+  public:
+    explicit BufferCache(std::size_t max_capacity = 16 << 10, std::size_t max_size = 1024);
+    ~BufferCache();
+
+    // Copy.
+    BufferCache(const BufferCache&) = delete;
+    BufferCache& operator=(const BufferCache&) = delete;
+
+    // Move.
+    BufferCache(BufferCache&&) = delete;
+    BufferCache& operator=(BufferCache&&) = delete;
+
+    /// Returns the number of cached buffers.
+    std::size_t size() const noexcept { return bufs_.size(); }
+
+    /// Gives cached storage to the buffer, if the buffer has no storage of its own.
+    void acquire(Buffer& buf) noexcept
+    {
+        if (buf.capacity() == 0 && !bufs_.empty()) {
+            buf.swap(bufs_.back());
+            bufs_.pop_back();
+        }
+    }
+    /// Takes the storage of an empty buffer, which is left without storage.
+    void release(Buffer& buf) noexcept;
+
+  private:
+    const std::size_t max_capacity_, max_size_;
+    std::vector<Buffer> bufs_;
+};
+
+} // namespace io
+} // namespace toolbox
+
+#endif // TOOLBOX_IO_BUFFERCACHE_HPP
@@ -0,0 +1,92 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BufferCache.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+void write(Buffer& buf, const char* s)
+{
+    const auto len = strlen(s);
+    memcpy(buf.prepare(len).data(), s, len);
+    buf.commit(len);
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(BufferCacheSuite)
+
+BOOST_AUTO_TEST_CASE(BufferCacheReuseCase)
+{
+    BufferCache cache;
+    Buffer buf;
+    // Nothing to acquire from an empty cache.
+    cache.acquire(buf);
+    BOOST_CHECK_EQUAL(buf.capacity(), 0U);
+
+    write(buf, "foo");
+    const auto* const data = buf.rptr();
+    buf.consume(3);
+    cache.release(buf);
+    BOOST_CHECK_EQUAL(buf.capacity(), 0U);
+    BOOST_CHECK_EQUAL(cache.size(), 1U);
+
+    // Buffers without storage are not cached.
+    cache.release(buf);
+    BOOST_CHECK_EQUAL(cache.size(), 1U);
+
+    Buffer other;
+    cache.acquire(other);
+    BOOST_CHECK_EQUAL(cache.size(), 0U);
+    BOOST_CHECK(other.empty());
+    BOOST_CHECK_GT(other.capacity(), 0U);
+    write(other, "bar");
+    BOOST_CHECK_EQUAL(other.rptr(), data);
+}
+
+BOOST_AUTO_TEST_CASE(BufferCacheLimitCase)
+{
+    BufferCache cache{1024, 1};
+    Buffer buf;
+    buf.reserve(2048);
+    cache.release(buf);
+    // Oversized storage is freed.
+    BOOST_CHECK_EQUAL(buf.capacity(), 0U);
+    BOOST_CHECK_EQUAL(cache.size(), 0U);
+
+    Buffer a, b;
+    a.reserve(512);
+    b.reserve(512);
+    cache.release(a);
+    cache.release(b);
+    // The cache is full.
+    BOOST_CHECK_EQUAL(cache.size(), 1U);
+    BOOST_CHECK_EQUAL(b.capacity(), 0U);
+
+    // A buffer with storage of its own is left alone.
+    Buffer c;
+    c.reserve(256);
+    cache.acquire(c);
+    BOOST_CHECK_EQUAL(cache.size(), 1U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,284 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BufferChain.hpp"
+
+#include <cstring>
+
+namespace toolbox {
+inline namespace io {
+using namespace std;
+namespace {
+// Number of segments allocated each time the pool is exhausted.
+constexpr size_t SlabSize = 16;
+} // namespace
+
+BufferSegment* BufferPool::allocate()
+{
+    BufferSegment* seg;
+
+    if (free_) {
+
+        // Pop next free segment from stack.
+        seg = free_;
+        free_ = free_->next;
+        --available_;
+
+    } else {
+
+        // Add new slab of segments to stack.
+        SlabPtr slab{new BufferSegment[SlabSize]};
+        seg = &slab[0];
+
+        for (size_t i{1}; i < SlabSize; ++i) {
+            slab[i].next = free_;
+            free_ = &slab[i];
+        }
+        available_ += SlabSize - 1;
+        slabs_.push_back(std::move(slab));
+    }
+
+    seg->next = nullptr;
+    return seg;
+}
+
+BufferChain::BufferChain(BufferChain&& rhs) noexcept
+: pool_{rhs.pool_}
+, head_{rhs.head_}
+, wseg_{rhs.wseg_}
+, tail_{rhs.tail_}
+, rpos_{rhs.rpos_}
+, wpos_{rhs.wpos_}
+, size_{rhs.size_}
+{
+    rhs.head_ = rhs.wseg_ = rhs.tail_ = nullptr;
+    rhs.rpos_ = rhs.wpos_ = rhs.size_ = 0;
+}
+
+BufferChain& BufferChain::operator=(BufferChain&& rhs) noexcept
+{
+    clear();
+    swap(pool_, rhs.pool_);
+    swap(head_, rhs.head_);
+    swap(wseg_, rhs.wseg_);
+    swap(tail_, rhs.tail_);
+    swap(rpos_, rhs.rpos_);
+    swap(wpos_, rhs.wpos_);
+    swap(size_, rhs.size_);
+    return *this;
+}
+
+size_t BufferChain::segments() const noexcept
+{
+    size_t n{0};
+    for (const auto* seg = head_; seg; seg = seg->next) {
+        ++n;
+    }
+    return n;
+}
+
+ConstBuffer BufferChain::segment(size_t offset) const noexcept
+{
+    if (offset >= size_) {
+        return {};
+    }
+    const auto* seg = head_;
+    auto pos = rpos_ + offset;
+    while (pos >= readable(seg)) {
+        pos -= readable(seg);
+        seg = seg->next;
+    }
+    return {seg->data + pos, readable(seg) - pos};
+}
+
+size_t BufferChain::data(span<iovec> iov) const noexcept
+{
+    if (size_ == 0) {
+        return 0;
+    }
+    size_t n{0};
+    auto pos = rpos_;
+    for (auto* seg = head_; n < iov.size(); seg = seg->next, pos = 0) {
+        if (const auto len = readable(seg) - pos; len > 0) {
+            iov[n++] = {seg->data + pos, len};
+        }
+        if (seg == wseg_) {
+            break;
+        }
+    }
+    return n;
+}
+
+size_t BufferChain::copy(size_t offset, char* buf, size_t len) const noexcept
+{
+    if (offset >= size_) {
+        return 0;
+    }
+    len = min(len, size_ - offset);
+
+    const auto* seg = head_;
+    auto pos = rpos_ + offset;
+    while (pos >= readable(seg)) {
+        pos -= readable(seg);
+        seg = seg->next;
+    }
+    size_t copied{0};
+    while (copied < len) {
+        const auto n = min(len - copied, readable(seg) - pos);
+        memcpy(buf + copied, seg->data + pos, n);
+        copied += n;
+        seg = seg->next;
+        pos = 0;
+    }
+    return copied;
+}
+
+void BufferChain::clear() noexcept
+{
+    release(head_);
+    head_ = wseg_ = tail_ = nullptr;
+    rpos_ = wpos_ = size_ = 0;
+}
+
+void BufferChain::commit(size_t count) noexcept
+{
+    while (count > 0) {
+        // The write position is advanced lazily to the next reserved segment, so that a full
+        // segment at the end of the chain remains the write segment until more space is reserved.
+        if (wpos_ == BufferSegmentSize) {
+            assert(wseg_->next);
+            wseg_ = wseg_->next;
+            wpos_ = 0;
+        }
+        const auto n = min(count, BufferSegmentSize - wpos_);
+        wpos_ += n;
+        size_ += n;
+        count -= n;
+    }
+}
+
+void BufferChain::consume(size_t count) noexcept
+{
+    if (count == 0) {
+        return;
+    }
+    assert(count <= size_);
+    size_ -= count;
+
+    while (count > 0) {
+        const auto n = min(count, readable(head_) - rpos_);
+        rpos_ += n;
+        count -= n;
+        // Return fully consumed segments to the pool.
+        if (rpos_ == BufferSegmentSize && head_ != wseg_) {
+            auto* const next = head_->next;
+            pool_->deallocate(head_);
+            head_ = next;
+            rpos_ = 0;
+        }
+    }
+
+    if (size_ == 0) {
+        // Rewind to the start of the head segment and return any reserved segments to the pool, so
+        // that an idle chain holds at most one segment.
+        wseg_ = tail_ = head_;
+        rpos_ = wpos_ = 0;
+        release(head_->next);
+        head_->next = nullptr;
+    }
+}
+
+void BufferChain::reserve(size_t size)
+{
+    if (!head_) {
+        head_ = wseg_ = tail_ = pool_->allocate();
+        rpos_ = wpos_ = 0;
+    }
+    auto avail = BufferSegmentSize - wpos_;
+    for (const auto* seg = wseg_->next; seg; seg = seg->next) {
+        avail += BufferSegmentSize;
+    }
+    while (avail < size) {
+        auto* const seg = pool_->allocate();
+        tail_->next = seg;
+        tail_ = seg;
+        avail += BufferSegmentSize;
+    }
+}
+
+size_t BufferChain::prepare(size_t size, span<iovec> iov)
+{
+    if (size == 0) {
+        return 0;
+    }
+    reserve(size);
+
+    size_t n{0};
+    auto* seg = wseg_;
+    auto pos = wpos_;
+    while (size > 0 && n < iov.size()) {
+        if (pos == BufferSegmentSize) {
+            seg = seg->next;
+            pos = 0;
+        }
+        const auto len = min(size, BufferSegmentSize - pos);
+        iov[n++] = {seg->data + pos, len};
+        size -= len;
+        pos = BufferSegmentSize;
+    }
+    return n;
+}
+
+MutableBuffer BufferChain::prepared(size_t offset) noexcept
+{
+    if (!wseg_) {
+        return {};
+    }
+    auto* seg = wseg_;
+    auto pos = wpos_ + offset;
+    while (pos >= BufferSegmentSize) {
+        seg = seg->next;
+        if (!seg) {
+            return {};
+        }
+        pos -= BufferSegmentSize;
+    }
+    return {seg->data + pos, BufferSegmentSize - pos};
+}
+
+void BufferChain::append(const char* data, size_t size)
+{
+    reserve(size);
+    size_t offset{0};
+    while (offset < size) {
+        const auto buf = prepared(offset);
+        const auto n = min(size - offset, buffer_size(buf));
+        memcpy(buf.data(), data + offset, n);
+        offset += n;
+    }
+    commit(size);
+}
+
+void BufferChain::release(BufferSegment* seg) noexcept
+{
+    while (seg) {
+        auto* const next = seg->next;
+        pool_->deallocate(seg);
+        seg = next;
+    }
+}
+
+} // namespace io
+} // namespace toolbox
@@ -0,0 +1,164 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_IO_BUFFERCHAIN_HPP
+#define TOOLBOX_IO_BUFFERCHAIN_HPP
+
+#include <toolbox/io/Buffer.hpp>
+
+#include <cassert>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <sys/uio.h>
+
+namespace toolbox {
+inline namespace io {
+
+/// Size of the data area in each BufferChain segment.
+constexpr std::size_t BufferSegmentSize{4096};
+
+/// Maximum number of segments submitted to a single readv() or writev() call.
+constexpr std::size_t MaxBufferIov{64};
+
+struct BufferSegment {
+    /// Singly-linked list of segments, either in a chain or in the pool's free-list.
+    BufferSegment* next;
+    char data[BufferSegmentSize];
+};
+
+/// Pool of fixed-size buffer segments. The pool is not thread-safe, and is typically owned by a
+/// Reactor thread and shared by all BufferChains on that thread.
+class TOOLBOX_API BufferPool {
+    using SlabPtr = std::unique_ptr<BufferSegment[]>;
+
+  public:
+    BufferPool() = default;
+    ~BufferPool() = default;
+
+    // Copy.
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    // Move.
+    BufferPool(BufferPool&&) = delete;
+    BufferPool& operator=(BufferPool&&) = delete;
+
+    /// Returns the number of segments in the free-list.
+    std::size_t available() const noexcept { return available_; }
+
+    BufferSegment* allocate();
+    void deallocate(BufferSegment* seg) noexcept
+    {
+        assert(seg);
+        seg->next = free_;
+        free_ = seg;
+        ++available_;
+    }
+
+  private:
+    std::vector<SlabPtr> slabs_;
+    /// Head of free-list.
+    BufferSegment* free_{nullptr};
+    std::size_t available_{0};
+};
+
+/// A buffer composed of fixed-size segments drawn from a BufferPool.
+/// Unlike Buffer, the chain never reallocates or moves data that has already been written, so large
+/// messages are not copied when the buffer grows or when the front of the buffer is consumed.
+class TOOLBOX_API BufferChain {
+  public:
+    explicit BufferChain(BufferPool& pool) noexcept
+    : pool_{&pool}
+    {
+    }
+    ~BufferChain() { release(head_); }
+
+    // Copy.
+    BufferChain(const BufferChain&) = delete;
+    BufferChain& operator=(const BufferChain&) = delete;
+
+    // Move.
+    BufferChain(BufferChain&& rhs) noexcept;
+    BufferChain& operator=(BufferChain&& rhs) noexcept;
+
+    /// Returns true if read buffer is empty.
+    bool empty() const noexcept { return size_ == 0U; }
+
+    /// Returns number of bytes available for read.
+    std::size_t size() const noexcept { return size_; }
+
+    /// Returns the number of segments currently held by the chain.
+    std::size_t segments() const noexcept;
+
+    /// Returns the first contiguous block of available data.
+    ConstBuffer front() const noexcept { return segment(0); }
+
+    /// Returns the contiguous block of available data starting at offset.
+    ConstBuffer segment(std::size_t offset) const noexcept;
+
+    /// Populates the iovec array with the available data and returns the number of entries used.
+    std::size_t data(std::span<iovec> iov) const noexcept;
+
+    /// Copies up to len bytes of available data, starting at offset, into buf.
+    /// Returns the number of bytes copied.
+    std::size_t copy(std::size_t offset, char* buf, std::size_t len) const noexcept;
+
+    /// Clear buffer and return all segments to the pool.
+    void clear() noexcept;
+
+    /// Move characters from the write sequence to the read sequence.
+    void commit(std::size_t count) noexcept;
+
+    /// Remove characters from the read sequence.
+    void consume(std::size_t count) noexcept;
+
+    /// Ensure that at least size bytes are available for writing.
+    void reserve(std::size_t size);
+
+    /// Reserves size bytes for writing and populates the iovec array with the write sequence.
+    /// Returns the number of entries used.
+    std::size_t prepare(std::size_t size, std::span<iovec> iov);
+
+    /// Returns the contiguous block of reserved write space starting at offset from the write
+    /// position, or an empty buffer if the offset lies beyond the reserved space.
+    MutableBuffer prepared(std::size_t offset) noexcept;
+
+    /// Appends data to the read sequence.
+    void append(const char* data, std::size_t size);
+
+  private:
+    /// Returns the number of readable bytes in the segment.
+    std::size_t readable(const BufferSegment* seg) const noexcept
+    {
+        return seg == wseg_ ? wpos_ : BufferSegmentSize;
+    }
+    void release(BufferSegment* seg) noexcept;
+
+    BufferPool* pool_;
+    /// Head of the chain, from which data is read.
+    BufferSegment* head_{nullptr};
+    /// Segment containing the write position. Segments following this one are reserved.
+    BufferSegment* wseg_{nullptr};
+    /// Last segment in the chain.
+    BufferSegment* tail_{nullptr};
+    std::size_t rpos_{}, wpos_{}, size_{};
+};
+
+} // namespace io
+} // namespace toolbox
+
+#endif // TOOLBOX_IO_BUFFERCHAIN_HPP
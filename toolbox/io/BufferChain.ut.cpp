@@ -0,0 +1,127 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BufferChain.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+string read(BufferChain& buf)
+{
+    string s(buf.size(), '\0');
+    buf.copy(0, s.data(), s.size());
+    buf.consume(s.size());
+    return s;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(BufferChainSuite)
+
+BOOST_AUTO_TEST_CASE(ReadWriteCase)
+{
+    BufferPool pool;
+    BufferChain buf{pool};
+    BOOST_CHECK(buf.empty());
+    BOOST_CHECK_EQUAL(buf.size(), 0U);
+    BOOST_CHECK_EQUAL(buffer_size(buf.front()), 0U);
+
+    buf.append("foo", 3);
+    BOOST_CHECK(!buf.empty());
+    BOOST_CHECK_EQUAL(buf.size(), 3U);
+    BOOST_CHECK_EQUAL(buf.segments(), 1U);
+
+    buf.append("bar", 3);
+    BOOST_CHECK_EQUAL(buf.size(), 6U);
+    BOOST_CHECK_EQUAL(memcmp(static_cast<const char*>(buf.front().data()), "foobar", 6), 0);
+
+    buf.consume(4);
+    BOOST_CHECK_EQUAL(buf.size(), 2U);
+    BOOST_CHECK_EQUAL(read(buf), "ar");
+    BOOST_CHECK(buf.empty());
+    // An empty chain retains a single segment.
+    BOOST_CHECK_EQUAL(buf.segments(), 1U);
+}
+
+BOOST_AUTO_TEST_CASE(SegmentsCase)
+{
+    BufferPool pool;
+    BufferChain buf{pool};
+
+    string data(3 * BufferSegmentSize + 100, '\0');
+    for (size_t i{0}; i < data.size(); ++i) {
+        data[i] = 'a' + i % 26;
+    }
+    buf.append(data.data(), data.size());
+    BOOST_CHECK_EQUAL(buf.size(), data.size());
+    BOOST_CHECK_EQUAL(buf.segments(), 4U);
+    BOOST_CHECK_EQUAL(buffer_size(buf.front()), BufferSegmentSize);
+    BOOST_CHECK_EQUAL(buffer_size(buf.segment(BufferSegmentSize + 10)), BufferSegmentSize - 10);
+
+    iovec iov[MaxBufferIov];
+    BOOST_CHECK_EQUAL(buf.data(iov), 4U);
+    BOOST_CHECK_EQUAL(iov[3].iov_len, 100U);
+
+    // Consuming the first segment returns it to the pool.
+    const auto avail = pool.available();
+    buf.consume(BufferSegmentSize + 1);
+    BOOST_CHECK_EQUAL(buf.segments(), 3U);
+    BOOST_CHECK_EQUAL(pool.available(), avail + 1);
+
+    char tmp[8];
+    BOOST_CHECK_EQUAL(buf.copy(BufferSegmentSize - 5, tmp, sizeof(tmp)), sizeof(tmp));
+    BOOST_CHECK_EQUAL(string_view(tmp, sizeof(tmp)),
+                      string_view(data).substr(2 * BufferSegmentSize - 4, sizeof(tmp)));
+
+    BOOST_CHECK_EQUAL(read(buf), data.substr(BufferSegmentSize + 1));
+    BOOST_CHECK_EQUAL(buf.segments(), 1U);
+
+    buf.clear();
+    BOOST_CHECK_EQUAL(buf.segments(), 0U);
+    BOOST_CHECK_EQUAL(pool.available(), 16U);
+}
+
+BOOST_AUTO_TEST_CASE(PrepareCase)
+{
+    BufferPool pool;
+    BufferChain buf{pool};
+    buf.append("foo", 3);
+
+    iovec iov[MaxBufferIov];
+    const auto n = buf.prepare(2 * BufferSegmentSize, iov);
+    BOOST_CHECK_EQUAL(n, 3U);
+    BOOST_CHECK_EQUAL(iov[0].iov_len, BufferSegmentSize - 3);
+    BOOST_CHECK_EQUAL(iov[1].iov_len, BufferSegmentSize);
+    BOOST_CHECK_EQUAL(iov[2].iov_len, 3U);
+    BOOST_CHECK_EQUAL(buf.size(), 3U);
+
+    memset(iov[0].iov_base, 'x', iov[0].iov_len);
+    memcpy(iov[1].iov_base, "bar", 3);
+    buf.commit(iov[0].iov_len + 3);
+    BOOST_CHECK_EQUAL(buf.size(), BufferSegmentSize + 3);
+    BOOST_CHECK_EQUAL(buf.segments(), 3U);
+
+    const auto s = read(buf);
+    BOOST_CHECK_EQUAL(s.substr(0, 4), "foox");
+    BOOST_CHECK_EQUAL(s.substr(s.size() - 4), "xbar");
+    // Reserved segments are released once the chain has been drained.
+    BOOST_CHECK_EQUAL(buf.segments(), 1U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -24,7 +24,10 @@
 
 #include <fcntl.h>
 #include <stdio.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 
 namespace toolbox {
 namespace os {
@@ -123,6 +126,52 @@ inline std::pair<FileHandle, FileHandle> pipe2(int flags)
     return {FileHandle{pipefd[0]}, FileHandle{pipefd[1]}};
 }
 
+/// Move data between two file descriptors, one of which must be a pipe, without copying between
+/// kernel address space and user address space.
+inline ssize_t splice(int fd_in, int fd_out, std::size_t len, unsigned flags,
+                      std::error_code& ec) noexcept
+{
+    const auto ret = ::splice(fd_in, nullptr, fd_out, nullptr, len, flags);
+    if (ret < 0) {
+        ec = make_error(errno);
+    }
+    return ret;
+}
+
+/// Move data between two file descriptors, one of which must be a pipe, without copying between
+/// kernel address space and user address space.
+inline std::size_t splice(int fd_in, int fd_out, std::size_t len, unsigned flags)
+{
+    const auto ret = ::splice(fd_in, nullptr, fd_out, nullptr, len, flags);
+    if (ret < 0) {
+        throw std::system_error{make_error(errno), "splice"};
+    }
+    return ret;
+}
+
+/// Transfer data from a file to another file descriptor, such as a socket, without copying between
+/// kernel address space and user address space. The offset is advanced by the bytes transferred.
+inline ssize_t sendfile(int fd_out, int fd_in, off_t& offset, std::size_t len,
+                        std::error_code& ec) noexcept
+{
+    const auto ret = ::sendfile(fd_out, fd_in, &offset, len);
+    if (ret < 0) {
+        ec = make_error(errno);
+    }
+    return ret;
+}
+
+/// Transfer data from a file to another file descriptor, such as a socket, without copying between
+/// kernel address space and user address space. The offset is advanced by the bytes transferred.
+inline std::size_t sendfile(int fd_out, int fd_in, off_t& offset, std::size_t len)
+{
+    const auto ret = ::sendfile(fd_out, fd_in, &offset, len);
+    if (ret < 0) {
+        throw std::system_error{make_error(errno), "sendfile"};
+    }
+    return ret;
+}
+
 /// Get file status.
 inline void fstat(int fd, struct stat& statbuf, std::error_code& ec) noexcept
 {
@@ -223,6 +272,46 @@ inline std::size_t write(int fd, ConstBuffer buf)
     return write(fd, static_cast<const void*>(buf.data()), buffer_size(buf));
 }
 
+/// Read from a file descriptor into multiple buffers.
+inline ssize_t readv(int fd, const iovec* iov, int iovcnt, std::error_code& ec) noexcept
+{
+    const auto ret = ::readv(fd, iov, iovcnt);
+    if (ret < 0) {
+        ec = make_error(errno);
+    }
+    return ret;
+}
+
+/// Read from a file descriptor into multiple buffers.
+inline std::size_t readv(int fd, const iovec* iov, int iovcnt)
+{
+    const auto ret = ::readv(fd, iov, iovcnt);
+    if (ret < 0) {
+        throw std::system_error{make_error(errno), "readv"};
+    }
+    return ret;
+}
+
+/// Write to a file descriptor from multiple buffers.
+inline ssize_t writev(int fd, const iovec* iov, int iovcnt, std::error_code& ec) noexcept
+{
+    const auto ret = ::writev(fd, iov, iovcnt);
+    if (ret < 0) {
+        ec = make_error(errno);
+    }
+    return ret;
+}
+
+/// Write to a file descriptor from multiple buffers.
+inline std::size_t writev(int fd, const iovec* iov, int iovcnt)
+{
+    const auto ret = ::writev(fd, iov, iovcnt);
+    if (ret < 0) {
+        throw std::system_error{make_error(errno), "writev"};
+    }
+    return ret;
+}
+
 /// File control.
 inline int fcntl(int fd, int cmd, std::error_code& ec) noexcept
 {
@@ -265,6 +354,28 @@ inline int fcntl(int fd, int cmd, ArgT arg)
     return ret;
 }
 
+/// Device control.
+template <typename ArgT>
+inline int ioctl(int fd, unsigned long request, ArgT arg, std::error_code& ec) noexcept
+{
+    const auto ret = ::ioctl(fd, request, arg);
+    if (ret < 0) {
+        ec = make_error(errno);
+    }
+    return ret;
+}
+
+/// Device control.
+template <typename ArgT>
+inline int ioctl(int fd, unsigned long request, ArgT arg)
+{
+    const auto ret = ::ioctl(fd, request, arg);
+    if (ret < 0) {
+        throw std::system_error{make_error(errno), "ioctl"};
+    }
+    return ret;
+}
+
 } // namespace os
 inline namespace io {
 
@@ -0,0 +1,65 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "IdleReaper.hpp"
+
+namespace toolbox {
+inline namespace io {
+using namespace std;
+
+IdleReaper::IdleReaper(CyclTime now, Reactor& r, Duration timeout)
+: timeout_{timeout}
+// The live entries expire within the timeout rounded up, plus one second for the unswept bucket.
+, buckets_(static_cast<size_t>(chrono::ceil<Seconds>(timeout).count()) + 2)
+{
+    tmr_ = r.timer(chrono::floor<Seconds>(now.mono_time()) + 1s, 1s, Priority::Low,
+                   bind<&IdleReaper::on_timer>(this));
+}
+
+IdleReaper::~IdleReaper() = default;
+
+void IdleReaper::expire(CyclTime now)
+{
+    const auto sec = chrono::floor<Seconds>(now.mono_time()).time_since_epoch().count();
+    const auto n = static_cast<int64_t>(buckets_.size());
+    // Each bucket is swept at most once, even if the timer has been delayed for longer than the
+    // ring.
+    for (auto s = max(swept_ + 1, sec - n + 1); s <= sec; ++s) {
+        auto& bucket = buckets_[static_cast<size_t>(s % n)];
+        // Detach the bucket, because the slots may touch or destroy other entries.
+        List expired;
+        expired.splice(expired.end(), bucket);
+        try {
+            while (!expired.empty()) {
+                auto& entry = expired.front();
+                expired.pop_front();
+                if (entry.expiry > sec) {
+                    // A later generation that shares the bucket, because the timer was delayed.
+                    bucket.push_back(entry);
+                } else {
+                    entry.slot(now);
+                }
+            }
+        } catch (...) {
+            bucket.splice(bucket.end(), expired);
+            swept_ = s - 1;
+            throw;
+        }
+    }
+    swept_ = max(swept_, sec);
+}
+
+} // namespace io
+} // namespace toolbox
@@ -0,0 +1,99 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_IO_IDLEREAPER_HPP
+#define TOOLBOX_IO_IDLEREAPER_HPP
+
+#include <toolbox/io/Reactor.hpp>
+
+#include <boost/intrusive/list.hpp>
+
+#include <vector>
+
+namespace toolbox {
+inline namespace io {
+
+/// An entry in an IdleReaper, which is typically a member of a connection. The entry is unlinked
+/// from the reaper automatically when it is destroyed.
+struct IdleEntry
+: boost::intrusive::list_base_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
+    using Slot = BasicSlot<void(CyclTime)>;
+    explicit IdleEntry(Slot slot) noexcept
+    : slot{slot}
+    {
+    }
+    IdleEntry() = default;
+    Slot slot;
+    /// The second of the monotonic clock in which the entry expires, which is set by the reaper.
+    std::int64_t expiry{0};
+};
+
+/// Expires idle entries with a single periodic timer, instead of a timer per entry.
+///
+/// Entries are kept in a ring of buckets, one per second of expiry, so touching an entry is an O(1)
+/// move between buckets, and is free when the entry is touched again within the same second. The
+/// timer sweeps the expired buckets once a second, so entries expire at the start of the first
+/// whole second after the timeout has elapsed, as they would with a per-entry timer whose expiry is
+/// rounded up to the second.
+class TOOLBOX_API IdleReaper {
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<false>;
+    using List = boost::intrusive::list<IdleEntry, ConstantTimeSizeOption>;
+
+  public:
+    IdleReaper(CyclTime now, Reactor& r, Duration timeout);
+    ~IdleReaper();
+
+    // Copy.
+    IdleReaper(const IdleReaper&) = delete;
+    IdleReaper& operator=(const IdleReaper&) = delete;
+
+    // Move.
+    IdleReaper(IdleReaper&&) = delete;
+    IdleReaper& operator=(IdleReaper&&) = delete;
+
+    Duration timeout() const noexcept { return timeout_; }
+
+    /// Records activity on the entry, which expires once the timeout has elapsed without further
+    /// activity.
+    void touch(MonoTime now, IdleEntry& entry) noexcept
+    {
+        using namespace std::chrono;
+        const auto expiry
+            = std::max(ceil<Seconds>(now + timeout_).time_since_epoch().count(), swept_ + 1);
+        if (entry.is_linked() && entry.expiry == expiry) {
+            return;
+        }
+        entry.unlink();
+        entry.expiry = expiry;
+        buckets_[static_cast<std::size_t>(expiry) % buckets_.size()].push_back(entry);
+    }
+    /// Unlinks each expired entry and invokes its slot, which may touch the entry again. This is
+    /// called by the reaper's timer once a second.
+    void expire(CyclTime now);
+
+  private:
+    void on_timer(CyclTime now, Timer& /*tmr*/) { expire(now); }
+
+    const Duration timeout_;
+    std::vector<List> buckets_;
+    /// The last second that has been swept.
+    std::int64_t swept_{0};
+    Timer tmr_;
+};
+
+} // namespace io
+} // namespace toolbox
+
+#endif // TOOLBOX_IO_IDLEREAPER_HPP
@@ -0,0 +1,125 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "IdleReaper.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct Counter {
+    void operator()(CyclTime /*now*/) { ++count; }
+    int count{0};
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(IdleReaperSuite)
+
+BOOST_AUTO_TEST_CASE(IdleReaperExpireCase)
+{
+    Reactor r{1024};
+    IdleReaper reaper{CyclTime::now(), r, 5s};
+    BOOST_CHECK_EQUAL(reaper.timeout(), 5s);
+
+    Counter c1, c2, c3;
+    IdleEntry e1{bind(&c1)}, e2{bind(&c2)}, e3{bind(&c3)};
+    const auto now = CyclTime::now().mono_time();
+    // The first entry was last active before the timeout.
+    reaper.touch(now - 10s, e1);
+    reaper.touch(now, e2);
+    // Activity after the timeout keeps the entry alive.
+    reaper.touch(now - 10s, e3);
+    reaper.touch(now, e3);
+    BOOST_CHECK(e1.is_linked());
+
+    reaper.expire(CyclTime::now());
+    BOOST_CHECK_EQUAL(c1.count, 1);
+    BOOST_CHECK(!e1.is_linked());
+    BOOST_CHECK_EQUAL(c2.count, 0);
+    BOOST_CHECK(e2.is_linked());
+    BOOST_CHECK_EQUAL(c3.count, 0);
+    BOOST_CHECK(e3.is_linked());
+
+    // Expired entries are only reported once.
+    reaper.expire(CyclTime::now());
+    BOOST_CHECK_EQUAL(c1.count, 1);
+
+    // An entry that is touched after an expired bucket has been swept is swept on the next pass.
+    reaper.touch(now - 10s, e1);
+    BOOST_CHECK(e1.is_linked());
+    reaper.expire(CyclTime::now());
+    BOOST_CHECK_EQUAL(c1.count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(IdleReaperAutoUnlinkCase)
+{
+    Reactor r{1024};
+    IdleReaper reaper{CyclTime::now(), r, 5s};
+    Counter c;
+    {
+        IdleEntry e{bind(&c)};
+        reaper.touch(CyclTime::now().mono_time() - 10s, e);
+    }
+    reaper.expire(CyclTime::now());
+    BOOST_CHECK_EQUAL(c.count, 0);
+}
+
+BOOST_AUTO_TEST_CASE(IdleReaperRetouchCase)
+{
+    Reactor r{1024};
+    IdleReaper reaper{CyclTime::now(), r, 5s};
+
+    // The slot may touch the entry again, as a connection does when it probes a silent peer.
+    struct Probe {
+        void operator()(CyclTime now)
+        {
+            ++count;
+            reaper->touch(now.mono_time(), *entry);
+        }
+        IdleReaper* reaper{nullptr};
+        IdleEntry* entry{nullptr};
+        int count{0};
+    } p{.reaper = &reaper};
+    IdleEntry e{bind(&p)};
+    p.entry = &e;
+
+    reaper.touch(CyclTime::now().mono_time() - 10s, e);
+    reaper.expire(CyclTime::now());
+    BOOST_CHECK_EQUAL(p.count, 1);
+    BOOST_CHECK(e.is_linked());
+    reaper.expire(CyclTime::now());
+    BOOST_CHECK_EQUAL(p.count, 1);
+}
+
+BOOST_AUTO_TEST_CASE(IdleReaperTimerCase)
+{
+    Reactor r{1024};
+    IdleReaper reaper{CyclTime::now(), r, 5s};
+    Counter c;
+    IdleEntry e{bind(&c)};
+    reaper.touch(CyclTime::now().mono_time() - 10s, e);
+    // The periodic timer sweeps the buckets within a second.
+    const auto end = MonoClock::now() + 3s;
+    while (c.count == 0 && MonoClock::now() < end) {
+        r.poll(CyclTime::now(), 100ms);
+    }
+    BOOST_CHECK_EQUAL(c.count, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
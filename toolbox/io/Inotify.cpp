@@ -30,8 +30,10 @@ void FileWatcher::watch(const Path& path, Slot slot, std::uint32_t mask)
     auto new_wh{inotify_->add_watch(path.c_str(), mask)};
     auto& watch{path_index_[path]};
     if (watch.wh == new_wh) {
-        // Update entries for existing watch descriptor.
+        // Update entries for existing watch descriptor. The new handle refers to the same watch,
+        // so it must be released without removing the watch.
         watch.slot = slot;
+        new_wh.release();
         return;
     }
     wd_index_[new_wh.get().wd] = &watch;
@@ -41,6 +43,18 @@ void FileWatcher::watch(const Path& path, Slot slot, std::uint32_t mask)
     watch = Watch{.path = path, .slot = slot, .wh = std::move(new_wh)};
 }
 
+void FileWatcher::unwatch(const Path& path) noexcept
+{
+    const auto it{path_index_.find(path)};
+    if (it == path_index_.end()) {
+        return;
+    }
+    // Remove all descriptors that refer to the watch, including any left by a rebind.
+    std::erase_if(wd_index_, [&watch = it->second](const auto& kv) { return kv.second == &watch; });
+    // The handle's destructor removes the watch from the inotify instance.
+    path_index_.erase(it);
+}
+
 void FileWatcher::on_inotify(CyclTime /*now*/, int fd, unsigned events)
 {
     if (events & (EpollIn | EpollHup)) {
@@ -59,7 +73,10 @@ void FileWatcher::on_inotify(CyclTime /*now*/, int fd, unsigned events)
             inotify_event* event{reinterpret_cast<inotify_event*>(&buf[i])};
             const auto it{wd_index_.find(event->wd)};
             if (it != wd_index_.end()) {
-                it->second->slot(it->second->path, event->wd, event->mask);
+                // The slot may unwatch the path, so copy the watch's state before invoking it.
+                const auto slot{it->second->slot};
+                const auto path{it->second->path};
+                slot(path, event->wd, event->mask);
             }
             i += sizeof(struct inotify_event) + event->len;
         }
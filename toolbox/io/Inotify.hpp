@@ -151,6 +151,8 @@ class TOOLBOX_API FileWatcher {
     FileWatcher& operator=(FileWatcher&&) noexcept = default;
 
     void watch(const Path& path, Slot slot, std::uint32_t mask = IN_ALL_EVENTS);
+    /// Remove the watch for path, if any. This function may be called from a watch slot.
+    void unwatch(const Path& path) noexcept;
 
   private:
     struct Watch {
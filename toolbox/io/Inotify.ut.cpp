@@ -0,0 +1,77 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Inotify.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct Events {
+    void on_event(const FileWatcher::Path& path, int /*wd*/, uint32_t /*mask*/)
+    {
+        ++count;
+        if (watcher) {
+            watcher->unwatch(path);
+        }
+    }
+    FileWatcher* watcher{nullptr};
+    int count{0};
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(InotifySuite)
+
+BOOST_AUTO_TEST_CASE(FileWatcherUnwatchCase)
+{
+    auto tmpl = (filesystem::temp_directory_path() / "toolbox-XXXXXX").native();
+    const filesystem::path dir{mkdtemp(tmpl.data())};
+    const auto path = dir / "file.txt";
+    ofstream{path} << "foo";
+
+    Reactor r;
+    Inotify inotify;
+    FileWatcher watcher{r, inotify};
+    Events events;
+
+    watcher.watch(path, bind<&Events::on_event>(&events), IN_MODIFY);
+    ofstream{path, ios::app} << "bar";
+    r.poll(CyclTime::now(), 0ms);
+    BOOST_TEST(events.count == 1);
+
+    // No events are delivered once the watch has been removed.
+    watcher.unwatch(path);
+    ofstream{path, ios::app} << "baz";
+    r.poll(CyclTime::now(), 0ms);
+    BOOST_TEST(events.count == 1);
+
+    // The watch can be removed from its own slot, even when further events are pending.
+    watcher.watch(path, bind<&Events::on_event>(&events), IN_MODIFY);
+    events.watcher = &watcher;
+    ofstream{path, ios::app} << "qux";
+    ofstream{path, ios::app} << "quux";
+    r.poll(CyclTime::now(), 0ms);
+    BOOST_TEST(events.count == 2);
+
+    filesystem::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,95 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MirroredBuffer.hpp"
+
+#include <toolbox/io/File.hpp>
+
+#include <cstring>
+
+#include <unistd.h>
+
+namespace toolbox {
+inline namespace io {
+using namespace std;
+namespace {
+
+size_t ceil_page_size(size_t size) noexcept
+{
+    // The mirror must start on a page boundary, so use the runtime page size rather than the
+    // compile-time assumption in sys/Limits.hpp.
+    static const size_t page_size = sysconf(_SC_PAGESIZE);
+    return (size + page_size - 1) / page_size * page_size;
+}
+
+MmapPtr map_mirrored(size_t size)
+{
+    const auto fd = os::memfd_create("toolbox-mirrored-buffer", MFD_CLOEXEC);
+    os::ftruncate(fd.get(), size);
+
+    // Reserve a contiguous region of address space for both mappings.
+    auto mem = os::mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    auto* const base = static_cast<char*>(mem.get());
+
+    // The shared mappings replace the reserved pages and are unmapped along with the reservation,
+    // so ownership is released here.
+    os::mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd.get(), 0).release();
+    os::mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd.get(), 0)
+        .release();
+    return mem;
+}
+
+} // namespace
+
+MirroredBuffer::MirroredBuffer(MirroredBuffer&& rhs) noexcept
+: mem_{std::move(rhs.mem_)}
+, capacity_{rhs.capacity_}
+, rpos_{rhs.rpos_}
+, wpos_{rhs.wpos_}
+{
+    rhs.capacity_ = rhs.rpos_ = rhs.wpos_ = 0;
+}
+
+MirroredBuffer& MirroredBuffer::operator=(MirroredBuffer&& rhs) noexcept
+{
+    mem_ = std::move(rhs.mem_);
+    capacity_ = rhs.capacity_;
+    rpos_ = rhs.rpos_;
+    wpos_ = rhs.wpos_;
+    rhs.capacity_ = rhs.rpos_ = rhs.wpos_ = 0;
+    return *this;
+}
+
+void MirroredBuffer::reserve(size_t capacity)
+{
+    if (capacity <= capacity_) {
+        return;
+    }
+    capacity = ceil_page_size(capacity);
+    auto mem = map_mirrored(capacity);
+
+    // Move unread portion to front of new ring.
+    const auto n = size();
+    if (n > 0) {
+        memcpy(mem.get(), rptr(), n);
+    }
+    mem_ = std::move(mem);
+    capacity_ = capacity;
+    rpos_ = 0;
+    wpos_ = n;
+}
+
+} // namespace io
+} // namespace toolbox
@@ -0,0 +1,125 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_IO_MIRROREDBUFFER_HPP
+#define TOOLBOX_IO_MIRROREDBUFFER_HPP
+
+#include <toolbox/io/Buffer.hpp>
+#include <toolbox/io/Mmap.hpp>
+
+namespace toolbox {
+inline namespace io {
+
+/// A ring buffer whose storage is mapped twice into adjacent regions of virtual memory, so that the
+/// read and write sequences are always contiguous, even when they wrap around the end of the ring.
+/// The interface mirrors that of Buffer, but consuming from the front of the buffer never moves
+/// data. The capacity is rounded up to a multiple of the page size, and storage is allocated
+/// lazily.
+class TOOLBOX_API MirroredBuffer {
+  public:
+    explicit MirroredBuffer(std::size_t capacity) { reserve(capacity); }
+    MirroredBuffer() = default;
+    ~MirroredBuffer() = default;
+
+    // Copy.
+    MirroredBuffer(const MirroredBuffer&) = delete;
+    MirroredBuffer& operator=(const MirroredBuffer&) = delete;
+
+    // Move.
+    MirroredBuffer(MirroredBuffer&& rhs) noexcept;
+    MirroredBuffer& operator=(MirroredBuffer&& rhs) noexcept;
+
+    /// Returns available data as a buffer.
+    ConstBuffer data() const noexcept { return {rptr(), size()}; }
+
+    /// Returns slice of available data as a buffer.
+    ConstBuffer data(std::size_t limit) const noexcept { return {rptr(), std::min(limit, size())}; }
+
+    /// Returns available data as a string view.
+    std::string_view str() const noexcept { return {rptr(), size()}; }
+
+    /// Returns slice of available data at the front of the buffer.
+    std::string_view front(std::size_t size) const noexcept
+    {
+        const auto limit = this->size();
+        return {rptr(), std::min(size, limit)};
+    }
+    /// Returns slice of available data at the back of the buffer.
+    std::string_view back(std::size_t size) const noexcept
+    {
+        const auto limit = this->size();
+        size = std::min(size, limit);
+        return {rptr() + limit - size, size};
+    }
+
+    /// Returns true if read buffer is empty.
+    bool empty() const noexcept { return size() == 0U; };
+
+    /// Returns number of bytes available for read.
+    std::size_t size() const noexcept { return wpos_ - rpos_; }
+
+    /// Returns the size of the ring.
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /// Clear buffer.
+    void clear() noexcept { rpos_ = wpos_ = 0; }
+
+    /// Move characters from the write sequence to the read sequence.
+    void commit(std::size_t count) noexcept { wpos_ += count; }
+
+    /// Remove characters from the read sequence.
+    void consume(std::size_t count) noexcept
+    {
+        rpos_ += count;
+        if (rpos_ == wpos_) {
+            rpos_ = wpos_ = 0;
+        } else if (rpos_ >= capacity_) {
+            // Both positions lie in the mirror, so wrap them back into the first mapping.
+            rpos_ -= capacity_;
+            wpos_ -= capacity_;
+        }
+    }
+
+    /// Returns write buffer of at least size bytes.
+    MutableBuffer prepare(std::size_t size)
+    {
+        if (size > available()) {
+            // More buffer space required.
+            reserve(std::max(this->size() + size, capacity_ * 2));
+        }
+        return {wptr(), size};
+    }
+
+    /// Reserve storage. Unread data is copied into the new ring if the buffer grows.
+    void reserve(std::size_t capacity);
+
+    char* wptr() noexcept { return base() + wpos_; }
+
+  private:
+    char* base() const noexcept { return static_cast<char*>(mem_.get()); }
+    const char* rptr() const noexcept { return base() + rpos_; }
+    std::size_t available() const noexcept { return capacity_ - size(); }
+
+    MmapPtr mem_;
+    std::size_t capacity_{};
+    /// The read position is always within the first mapping, and the write position is never more
+    /// than capacity_ bytes ahead of it.
+    std::size_t rpos_{}, wpos_{};
+};
+
+} // namespace io
+} // namespace toolbox
+
+#endif // TOOLBOX_IO_MIRROREDBUFFER_HPP
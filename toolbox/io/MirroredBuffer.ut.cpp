@@ -0,0 +1,122 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "MirroredBuffer.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+void write(MirroredBuffer& buf, string_view data)
+{
+    const auto out = buf.prepare(data.size());
+    memcpy(static_cast<char*>(out.data()), data.data(), data.size());
+    buf.commit(data.size());
+}
+
+string read(MirroredBuffer& buf, std::size_t limit)
+{
+    const auto in = buf.data(limit);
+    const string s{static_cast<const char*>(in.data()), buffer_size(in)};
+    buf.consume(buffer_size(in));
+    return s;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MirroredBufferSuite)
+
+BOOST_AUTO_TEST_CASE(ReadWriteCase)
+{
+    MirroredBuffer buf;
+    BOOST_CHECK(buf.empty());
+    BOOST_CHECK_EQUAL(buf.size(), 0U);
+    BOOST_CHECK_EQUAL(buf.capacity(), 0U);
+    BOOST_CHECK_EQUAL(buffer_size(buf.data()), 0U);
+
+    write(buf, "foo");
+    BOOST_CHECK(!buf.empty());
+    BOOST_CHECK_EQUAL(buf.size(), 3U);
+    BOOST_CHECK_GT(buf.capacity(), 0U);
+    BOOST_CHECK_EQUAL(buf.str(), "foo");
+
+    write(buf, "bar");
+    BOOST_CHECK_EQUAL(buf.str(), "foobar");
+    BOOST_CHECK_EQUAL(buf.front(2), "fo");
+    BOOST_CHECK_EQUAL(buf.back(2), "ar");
+
+    BOOST_CHECK_EQUAL(read(buf, 4), "foob");
+    BOOST_CHECK_EQUAL(buf.str(), "ar");
+    BOOST_CHECK_EQUAL(read(buf, 2), "ar");
+    BOOST_CHECK(buf.empty());
+}
+
+BOOST_AUTO_TEST_CASE(WrapCase)
+{
+    MirroredBuffer buf{1};
+    const auto cap = buf.capacity();
+    BOOST_CHECK_EQUAL(cap % 4096, 0U);
+
+    // Advance the read position to near the end of the ring.
+    write(buf, string(cap - 3, 'x'));
+    write(buf, "ab");
+    BOOST_CHECK_EQUAL(read(buf, cap - 3).size(), cap - 3);
+    BOOST_CHECK_EQUAL(buf.str(), "ab");
+
+    // The write sequence spans the end of the ring, but remains contiguous.
+    write(buf, "cdefgh");
+    BOOST_CHECK_EQUAL(buf.capacity(), cap);
+    BOOST_CHECK_EQUAL(buf.str(), "abcdefgh");
+
+    // Consuming past the end of the first mapping wraps the read position.
+    BOOST_CHECK_EQUAL(read(buf, 4), "abcd");
+    BOOST_CHECK_EQUAL(buf.str(), "efgh");
+
+    // The full capacity is usable without growing.
+    write(buf, string(cap - 4, 'y'));
+    BOOST_CHECK_EQUAL(buf.capacity(), cap);
+    BOOST_CHECK_EQUAL(buf.size(), cap);
+    BOOST_CHECK_EQUAL(buf.front(5), "efghy");
+    BOOST_CHECK_EQUAL(buf.back(1), "y");
+}
+
+BOOST_AUTO_TEST_CASE(GrowCase)
+{
+    MirroredBuffer buf{1};
+    const auto cap = buf.capacity();
+
+    write(buf, string(cap - 2, 'x'));
+    BOOST_CHECK_EQUAL(read(buf, cap - 2).size(), cap - 2);
+    write(buf, string(cap - 2, 'x'));
+    BOOST_CHECK_EQUAL(read(buf, cap - 3).size(), cap - 3);
+    write(buf, "foo");
+    BOOST_CHECK_EQUAL(buf.str(), "xfoo");
+
+    // Growing copies unread data to the start of the new ring.
+    write(buf, string(cap, 'z'));
+    BOOST_CHECK_GT(buf.capacity(), cap);
+    BOOST_CHECK_EQUAL(buf.size(), cap + 4);
+    BOOST_CHECK_EQUAL(buf.front(5), "xfooz");
+
+    MirroredBuffer other{std::move(buf)};
+    BOOST_CHECK_EQUAL(buf.capacity(), 0U);
+    BOOST_CHECK(buf.empty());
+    BOOST_CHECK_EQUAL(other.size(), cap + 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,136 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_IO_MMAP_HPP
+#define TOOLBOX_IO_MMAP_HPP
+
+#include <toolbox/io/Handle.hpp>
+#include <toolbox/sys/Error.hpp>
+
+#include <memory>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+
+namespace toolbox {
+inline namespace io {
+
+/// Unmaps a memory region of fixed size.
+class MmapDeleter {
+  public:
+    MmapDeleter(std::size_t size = 0) noexcept // NOLINT(hicpp-explicit-conversions)
+    : size_{size}
+    {
+    }
+    std::size_t size() const noexcept { return size_; }
+    void operator()(void* addr) const noexcept
+    {
+        if (addr) {
+            ::munmap(addr, size_);
+        }
+    }
+
+  private:
+    std::size_t size_;
+};
+
+using MmapPtr = std::unique_ptr<void, MmapDeleter>;
+
+} // namespace io
+
+namespace os {
+
+/// Map files or devices into memory.
+inline MmapPtr mmap(void* addr, std::size_t len, int prot, int flags, int fd, off_t off,
+                    std::error_code& ec) noexcept
+{
+    void* const ret{::mmap(addr, len, prot, flags, fd, off)};
+    if (ret == MAP_FAILED) {
+        ec = make_error(errno);
+        return {};
+    }
+    return {ret, len};
+}
+
+/// Map files or devices into memory.
+inline MmapPtr mmap(void* addr, std::size_t len, int prot, int flags, int fd, off_t off)
+{
+    void* const ret{::mmap(addr, len, prot, flags, fd, off)};
+    if (ret == MAP_FAILED) {
+        throw std::system_error{make_error(errno), "mmap"};
+    }
+    return {ret, len};
+}
+
+/// Create an anonymous file.
+inline FileHandle memfd_create(const char* name, unsigned flags, std::error_code& ec) noexcept
+{
+    const auto fd = ::memfd_create(name, flags);
+    if (fd < 0) {
+        ec = make_error(errno);
+    }
+    return fd;
+}
+
+/// Create an anonymous file.
+inline FileHandle memfd_create(const char* name, unsigned flags)
+{
+    const auto fd = ::memfd_create(name, flags);
+    if (fd < 0) {
+        throw std::system_error{make_error(errno), "memfd_create"};
+    }
+    return fd;
+}
+
+/// Create or open a POSIX shared memory object.
+inline FileHandle shm_open(const char* name, int oflag, mode_t mode, std::error_code& ec) noexcept
+{
+    const auto fd = ::shm_open(name, oflag, mode);
+    if (fd < 0) {
+        ec = make_error(errno);
+    }
+    return fd;
+}
+
+/// Create or open a POSIX shared memory object.
+inline FileHandle shm_open(const char* name, int oflag, mode_t mode)
+{
+    const auto fd = ::shm_open(name, oflag, mode);
+    if (fd < 0) {
+        throw std::system_error{make_error(errno), "shm_open"};
+    }
+    return fd;
+}
+
+/// Remove a POSIX shared memory object.
+inline void shm_unlink(const char* name, std::error_code& ec) noexcept
+{
+    if (::shm_unlink(name) < 0) {
+        ec = make_error(errno);
+    }
+}
+
+/// Remove a POSIX shared memory object.
+inline void shm_unlink(const char* name)
+{
+    if (::shm_unlink(name) < 0) {
+        throw std::system_error{make_error(errno), "shm_unlink"};
+    }
+}
+
+} // namespace os
+} // namespace toolbox
+
+#endif // TOOLBOX_IO_MMAP_HPP
@@ -0,0 +1,43 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_IO_REACTOR_UT_HPP
+#define TOOLBOX_IO_REACTOR_UT_HPP
+
+#include <toolbox/io/Reactor.hpp>
+
+namespace toolbox {
+inline namespace io {
+
+/// Polls the reactor until the predicate is satisfied, and returns false if it is not satisfied
+/// within a few seconds. This is a utility for unit tests that exchange data over real sockets.
+template <typename PredT>
+bool poll_until(Reactor& r, PredT pred)
+{
+    using namespace std::literals::chrono_literals;
+    const auto deadline = MonoClock::now() + 5s;
+    while (!pred()) {
+        if (MonoClock::now() > deadline) {
+            return false;
+        }
+        r.poll(CyclTime::now(), 1ms);
+    }
+    return true;
+}
+
+} // namespace io
+} // namespace toolbox
+
+#endif // TOOLBOX_IO_REACTOR_UT_HPP
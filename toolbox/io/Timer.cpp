@@ -18,6 +18,7 @@
 
 #include <toolbox/sys/Log.hpp>
 
+#include <algorithm>
 #include <string>
 
 namespace toolbox {
@@ -66,7 +67,11 @@ Timer TimerQueue::insert(MonoTime expiry, Duration interval, TimerSlot slot)
 {
     assert(slot);
 
-    heap_.reserve(heap_.size() + 1);
+    // Reserve before allocating, so that the push cannot fail. Growth is geometric, because
+    // reserving one more element would reallocate the heap on every insert.
+    if (heap_.size() == heap_.capacity()) {
+        heap_.reserve(max<size_t>(heap_.size() * 2, 64));
+    }
     const auto tmr{allocate(expiry, interval, slot)};
 
     // Cannot fail.
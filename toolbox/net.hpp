@@ -17,20 +17,34 @@
 #ifndef TOOLBOX_NET_HPP
 #define TOOLBOX_NET_HPP
 
+#include "net/AtomicTokenBucket.hpp"
 #include "net/DgramSock.hpp"
 #include "net/Endian.hpp"
 #include "net/Endpoint.hpp"
 #include "net/Error.hpp"
+#include "net/FeedArbiter.hpp"
 #include "net/Frame.hpp"
+#include "net/FrameClnt.hpp"
+#include "net/FrameConn.hpp"
+#include "net/FrameServ.hpp"
 #include "net/IoSock.hpp"
 #include "net/IpAddr.hpp"
 #include "net/McastSock.hpp"
+#include "net/Pcap.hpp"
 #include "net/Protocol.hpp"
 #include "net/RateLimit.hpp"
+#include "net/RateLimiterTable.hpp"
 #include "net/Resolver.hpp"
+#include "net/RxQueue.hpp"
+#include "net/ScmRights.hpp"
+#include "net/ShmRing.hpp"
 #include "net/Socket.hpp"
+#include "net/SocketProfile.hpp"
+#include "net/SpliceProxy.hpp"
 #include "net/StreamAcceptor.hpp"
+#include "net/StreamConnPool.hpp"
 #include "net/StreamConnector.hpp"
 #include "net/StreamSock.hpp"
+#include "net/TcpInfo.hpp"
 
 #endif // TOOLBOX_NET_HPP
@@ -0,0 +1,103 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AtomicTokenBucket.hpp"
+
+#include <algorithm>
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+// Upper bound on the number of pause instructions between retries.
+constexpr int MaxSpins{64};
+
+inline void cpu_relax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+} // namespace
+
+AtomicTokenBucket::AtomicTokenBucket(size_t limit, Duration interval, Fairness fairness)
+: gcra_{limit, interval}
+, fairness_{fairness}
+{
+}
+
+AtomicTokenBucket::~AtomicTokenBucket() = default;
+
+size_t AtomicTokenBucket::available(MonoTime now) const noexcept
+{
+    return gcra_.available(now.time_since_epoch().count(), tat_.load(memory_order_relaxed));
+}
+
+bool AtomicTokenBucket::try_acquire(MonoTime now, size_t n) noexcept
+{
+    if (n == 0) {
+        return true;
+    }
+    const auto t = now.time_since_epoch().count();
+    auto tat = tat_.load(memory_order_relaxed);
+    int spins{1};
+    for (;;) {
+        auto next = tat;
+        if (!gcra_.try_acquire(t, next, n)) {
+            return false;
+        }
+        if (update(tat, next, spins)) {
+            return true;
+        }
+    }
+}
+
+size_t AtomicTokenBucket::try_acquire_some(MonoTime now, size_t n) noexcept
+{
+    const auto t = now.time_since_epoch().count();
+    auto tat = tat_.load(memory_order_relaxed);
+    int spins{1};
+    for (;;) {
+        const auto grant = min(gcra_.available(t, tat), n);
+        auto next = tat;
+        if (grant == 0 || !gcra_.try_acquire(t, next, grant)) {
+            return 0;
+        }
+        if (update(tat, next, spins)) {
+            return grant;
+        }
+    }
+}
+
+bool AtomicTokenBucket::update(int64_t& tat, int64_t next, int& spins) noexcept
+{
+    // The bucket does not guard any other memory, so relaxed ordering is sufficient.
+    if (tat_.compare_exchange_weak(tat, next, memory_order_relaxed)) {
+        return true;
+    }
+    if (fairness_ == Fairness::Backoff) {
+        for (int i{0}; i < spins; ++i) {
+            cpu_relax();
+        }
+        spins = min(spins * 2, MaxSpins);
+        tat = tat_.load(memory_order_relaxed);
+    }
+    return false;
+}
+
+} // namespace net
+} // namespace toolbox
@@ -0,0 +1,101 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_ATOMICTOKENBUCKET_HPP
+#define TOOLBOX_NET_ATOMICTOKENBUCKET_HPP
+
+#include <toolbox/net/RateLimit.hpp>
+#include <toolbox/sys/Limits.hpp>
+
+#include <atomic>
+
+namespace toolbox {
+inline namespace net {
+
+/// Behaviour of an AtomicTokenBucket when a thread loses a race to update the bucket.
+enum class Fairness : int {
+    /// Retry immediately. This gives the highest throughput when contention is low, but threads on
+    /// the same core complex as the cache line tend to win more often.
+    Greedy,
+    /// Pause for an exponentially increasing number of cycles before retrying. This reduces the
+    /// cache line traffic under heavy contention, and spreads the tokens more evenly across
+    /// threads.
+    Backoff
+};
+
+/// A token bucket that may be shared by many threads, for example to enforce a single message rate
+/// limit imposed by an exchange across several Reactor threads.
+///
+/// The bucket holds up to limit tokens, and is refilled continuously at limit tokens per interval.
+/// The state is a single atomic nanosecond timestamp, the theoretical arrival time of the Generic
+/// Cell Rate Algorithm, which is updated with compare-and-swap, so the bucket is lock-free: an
+/// update only fails repeatedly while other threads are succeeding, although a single update may
+/// fail spuriously.
+class TOOLBOX_API AtomicTokenBucket {
+  public:
+    AtomicTokenBucket(std::size_t limit, Duration interval, Fairness fairness = Fairness::Greedy);
+    explicit AtomicTokenBucket(RateLimit rl, Fairness fairness = Fairness::Greedy)
+    : AtomicTokenBucket{rl.limit(), rl.interval(), fairness}
+    {
+    }
+    ~AtomicTokenBucket();
+
+    // Copy.
+    AtomicTokenBucket(const AtomicTokenBucket&) = delete;
+    AtomicTokenBucket& operator=(const AtomicTokenBucket&) = delete;
+
+    // Move.
+    AtomicTokenBucket(AtomicTokenBucket&&) = delete;
+    AtomicTokenBucket& operator=(AtomicTokenBucket&&) = delete;
+
+    std::size_t limit() const noexcept { return gcra_.limit(); }
+    /// Returns the time taken to refill a single token.
+    Duration emission_interval() const noexcept { return gcra_.emission_interval(); }
+    Fairness fairness() const noexcept { return fairness_; }
+
+    /// Returns the number of tokens that are currently held by the bucket.
+    std::size_t available(MonoTime now) const noexcept;
+
+    /// Takes n tokens from the bucket and returns true, or returns false, without taking any
+    /// tokens, if the bucket does not hold n tokens.
+    bool try_acquire(MonoTime now, std::size_t n = 1) noexcept;
+    bool try_acquire(std::size_t n = 1) noexcept { return try_acquire(MonoClock::now(), n); }
+
+    /// Takes up to n tokens from the bucket and returns the number taken. Partial grants prevent a
+    /// thread that needs a large batch from being starved by threads that take single tokens.
+    std::size_t try_acquire_some(MonoTime now, std::size_t n) noexcept;
+    std::size_t try_acquire_some(std::size_t n) noexcept
+    {
+        return try_acquire_some(MonoClock::now(), n);
+    }
+
+    /// Refills the bucket. This function must not be called concurrently with try_acquire().
+    void reset() noexcept { tat_.store(0, std::memory_order_relaxed); }
+
+  private:
+    bool update(std::int64_t& tat, std::int64_t next, int& spins) noexcept;
+
+    const Gcra gcra_;
+    const Fairness fairness_;
+    /// Theoretical arrival time, on its own cache line to avoid false sharing with neighbours.
+    alignas(CacheLineSize) std::atomic<std::int64_t> tat_{0};
+};
+
+static_assert(std::atomic<std::int64_t>::is_always_lock_free);
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_ATOMICTOKENBUCKET_HPP
@@ -0,0 +1,88 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AtomicTokenBucket.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(AtomicTokenBucketSuite)
+
+BOOST_AUTO_TEST_CASE(TryAcquireCase)
+{
+    const auto t = MonoClock::now();
+
+    AtomicTokenBucket tb{RateLimit{4, 1s}};
+    BOOST_CHECK_EQUAL(tb.limit(), 4);
+    BOOST_CHECK_EQUAL(tb.emission_interval().count(), 250'000'000);
+    BOOST_CHECK_EQUAL(tb.available(t), 4);
+
+    BOOST_CHECK(tb.try_acquire(t, 3));
+    BOOST_CHECK(!tb.try_acquire(t, 2));
+    BOOST_CHECK(tb.try_acquire(t));
+    BOOST_CHECK(!tb.try_acquire(t));
+    BOOST_CHECK_EQUAL(tb.available(t), 0);
+    // Nothing is taken for zero tokens.
+    BOOST_CHECK(tb.try_acquire(t, 0));
+    BOOST_CHECK_EQUAL(tb.try_acquire_some(t, 0), 0);
+
+    // Refilled at a constant rate.
+    BOOST_CHECK_EQUAL(tb.available(t + 500ms), 2);
+    BOOST_CHECK_EQUAL(tb.try_acquire_some(t + 500ms, 3), 2);
+    BOOST_CHECK_EQUAL(tb.try_acquire_some(t + 500ms, 3), 0);
+
+    // Never more than the limit.
+    BOOST_CHECK_EQUAL(tb.available(t + 10s), 4);
+    BOOST_CHECK(!tb.try_acquire(t + 10s, 5));
+    BOOST_CHECK_EQUAL(tb.try_acquire_some(t + 10s, 5), 4);
+
+    tb.reset();
+    BOOST_CHECK_EQUAL(tb.available(t + 500ms), 4);
+}
+
+BOOST_AUTO_TEST_CASE(ContentionCase)
+{
+    constexpr int Threads{4};
+    constexpr int Attempts{10'000};
+    const auto t = MonoClock::now();
+
+    for (const auto fairness : {Fairness::Greedy, Fairness::Backoff}) {
+        AtomicTokenBucket tb{1000, 1s, fairness};
+        vector<int> granted(Threads);
+        {
+            vector<jthread> threads;
+            for (int i{0}; i < Threads; ++i) {
+                threads.emplace_back([&tb, &granted, i, t]() {
+                    for (int j{0}; j < Attempts; ++j) {
+                        granted[i] += tb.try_acquire(t) ? 1 : 0;
+                    }
+                });
+            }
+        }
+        int total{0};
+        for (const auto n : granted) {
+            total += n;
+        }
+        // The clock is frozen, so exactly one bucket's worth of tokens is granted.
+        BOOST_CHECK_EQUAL(total, 1000);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -46,6 +46,19 @@ struct DgramSock : IoSock {
         os::getsockname(get(), ep, ec);
     }
     void get_sock_name(Endpoint& ep) { os::getsockname(get(), ep); }
+    int get_inq(std::error_code& ec) const noexcept { return get_sock_inq(get(), ec); }
+    int get_inq() const { return get_sock_inq(get()); }
+    void get_meminfo(SkMemInfo& meminfo, std::error_code& ec) const noexcept
+    {
+        get_so_meminfo(get(), meminfo, ec);
+    }
+    void get_meminfo(SkMemInfo& meminfo) const { get_so_meminfo(get(), meminfo); }
+
+    void set_rxq_ovfl(bool enabled, std::error_code& ec) noexcept
+    {
+        set_so_rxq_ovfl(get(), enabled, ec);
+    }
+    void set_rxq_ovfl(bool enabled) { set_so_rxq_ovfl(get(), enabled); }
     void bind(const Endpoint& ep, std::error_code& ec) noexcept { os::bind(get(), ep, ec); }
     void bind(const Endpoint& ep) { os::bind(get(), ep); }
     void connect(const Endpoint& ep, std::error_code& ec) noexcept
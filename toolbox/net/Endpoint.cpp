@@ -18,18 +18,20 @@
 
 #include <toolbox/util/String.hpp>
 
+#include <arpa/inet.h>
+
 using namespace std;
 
 namespace toolbox {
 inline namespace net {
 namespace {
 
-pair<string, string> split_ip_addr(const string& addr, char delim)
+pair<string_view, string_view> split_ip_addr(string_view addr, char delim) noexcept
 {
     // Reverse find for compatibility with ipv6 address notation.
     const auto pos = addr.find_last_of(delim);
-    string node, service;
-    if (pos == string::npos) {
+    string_view node, service;
+    if (pos == string_view::npos) {
         node = addr;
     } else {
         node = addr.substr(0, pos);
@@ -42,11 +44,11 @@ pair<string, string> split_ip_addr(const string& addr, char delim)
     return {node, service};
 }
 
-pair<string, string> split_uri(string_view uri)
+pair<string_view, string_view> split_uri(string_view uri) noexcept
 {
     const auto pos = uri.find("://");
-    string scheme, addr;
-    if (pos == string::npos) {
+    string_view scheme, addr;
+    if (pos == string_view::npos) {
         addr = uri;
     } else {
         scheme = uri.substr(0, pos);
@@ -54,12 +56,12 @@ pair<string, string> split_uri(string_view uri)
     }
     return {scheme, addr};
 }
-} // namespace
 
-AddrInfoPtr parse_endpoint(string_view uri, int type)
+/// Returns the address family and protocol for the URI scheme. AF_UNIX is returned for Unix domain
+/// addresses.
+pair<int, int> parse_scheme(string_view uri, string_view scheme, int type)
 {
     int family{-1}, protocol{0};
-    const auto [scheme, addr] = split_uri(uri);
     if (scheme.empty()) {
         family = AF_UNSPEC;
     } else if (scheme == "ip4") {
@@ -87,14 +89,127 @@ AddrInfoPtr parse_endpoint(string_view uri, int type)
             protocol = IPPROTO_UDP;
         }
     } else if (scheme == "unix") {
-        return get_unix_addrinfo(addr, type);
+        family = AF_UNIX;
     }
     if (family < 0) {
         throw invalid_argument{make_string("invalid uri: ", uri)};
     }
-    auto [node, service] = split_ip_addr(addr, ':');
-    return os::getaddrinfo(!node.empty() ? node.c_str() : nullptr,
-                           !service.empty() ? service.c_str() : nullptr, family, type, protocol);
+    return {family, protocol};
+}
+
+/// Parse a numeric port. An empty service is equivalent to port zero.
+bool parse_port(string_view service, in_port_t& port) noexcept
+{
+    if (service.empty()) {
+        port = 0;
+        return true;
+    }
+    if (service.size() > 5) {
+        return false;
+    }
+    unsigned n{0};
+    for (const auto c : service) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        n = n * 10 + (c - '0');
+    }
+    if (n > numeric_limits<in_port_t>::max()) {
+        return false;
+    }
+    port = n;
+    return true;
+}
+
+template <typename EndpointT>
+optional<EndpointT> parse_numeric_endpoint(string_view uri, int type)
+{
+    const auto [scheme, addr] = split_uri(uri);
+    const auto [family, protocol] = parse_scheme(uri, scheme, type);
+    if (family == AF_UNIX) {
+        sockaddr_un sun;
+        const auto len = make_unix_addr(addr, sun);
+        return EndpointT{&sun, len, 0};
+    }
+    const auto [node, service] = split_ip_addr(addr, ':');
+    in_port_t port;
+    if (!parse_port(service, port)) {
+        return nullopt;
+    }
+    // Like getaddrinfo(), use the default protocol for the socket type when the scheme does not
+    // specify one.
+    const int ip_protocol{type == SOCK_STREAM ? IPPROTO_TCP : IPPROTO_UDP};
+    if (node.empty()) {
+        // Wildcard address suitable for bind()ing. Let getaddrinfo() choose the family if it was
+        // not specified.
+        if (family == AF_INET) {
+            sockaddr_in sin{};
+            sin.sin_family = AF_INET;
+            sin.sin_port = htons(port);
+            sin.sin_addr.s_addr = htonl(INADDR_ANY);
+            return EndpointT{&sin, sizeof(sin), ip_protocol};
+        }
+        if (family == AF_INET6) {
+            sockaddr_in6 sin6{};
+            sin6.sin6_family = AF_INET6;
+            sin6.sin6_port = htons(port);
+            sin6.sin6_addr = in6addr_any;
+            return EndpointT{&sin6, sizeof(sin6), ip_protocol};
+        }
+        return nullopt;
+    }
+    // The node must be null terminated for inet_pton().
+    char buf[INET6_ADDRSTRLEN];
+    if (node.size() >= sizeof(buf)) {
+        return nullopt;
+    }
+    node.copy(buf, node.size());
+    buf[node.size()] = '\0';
+
+    if (family != AF_INET6) {
+        sockaddr_in sin{};
+        if (inet_pton(AF_INET, buf, &sin.sin_addr) == 1) {
+            sin.sin_family = AF_INET;
+            sin.sin_port = htons(port);
+            return EndpointT{&sin, sizeof(sin), ip_protocol};
+        }
+    }
+    if (family != AF_INET) {
+        sockaddr_in6 sin6{};
+        if (inet_pton(AF_INET6, buf, &sin6.sin6_addr) == 1) {
+            sin6.sin6_family = AF_INET6;
+            sin6.sin6_port = htons(port);
+            return EndpointT{&sin6, sizeof(sin6), ip_protocol};
+        }
+    }
+    // Hostname or scoped address.
+    return nullopt;
+}
+
+} // namespace
+
+AddrInfoPtr parse_endpoint(string_view uri, int type)
+{
+    const auto [scheme, addr] = split_uri(uri);
+    const auto [family, protocol] = parse_scheme(uri, scheme, type);
+    if (family == AF_UNIX) {
+        return get_unix_addrinfo(addr, type);
+    }
+    const auto [node, service] = split_ip_addr(addr, ':');
+    const string node_str{node}, service_str{service};
+    return os::getaddrinfo(!node.empty() ? node_str.c_str() : nullptr,
+                           !service.empty() ? service_str.c_str() : nullptr, family, type,
+                           protocol);
+}
+
+optional<DgramEndpoint> parse_numeric_dgram_endpoint(string_view uri)
+{
+    return parse_numeric_endpoint<DgramEndpoint>(uri, SOCK_DGRAM);
+}
+
+optional<StreamEndpoint> parse_numeric_stream_endpoint(string_view uri)
+{
+    return parse_numeric_endpoint<StreamEndpoint>(uri, SOCK_STREAM);
 }
 
 istream& operator>>(istream& is, DgramEndpoint& ep)
@@ -25,6 +25,11 @@
 #include <boost/asio/generic/basic_endpoint.hpp>
 #include <boost/asio/ip/basic_endpoint.hpp>
 #include <boost/asio/local/basic_endpoint.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <cstring>
+#include <optional>
+#include <string_view>
 
 namespace toolbox {
 inline namespace net {
@@ -47,16 +52,130 @@ using UnixEndpoint = boost::asio::local::basic_endpoint<ProtocolT>;
 using UnixDgramEndpoint = UnixEndpoint<UnixDgramProtocol>;
 using UnixStreamEndpoint = UnixEndpoint<UnixStreamProtocol>;
 
+namespace detail {
+/// Returns true if the socket addresses have the same family and address, ignoring the port and,
+/// for IPv6, the flow information and scope ID.
+inline bool equal_sock_addr(const sockaddr* lhs, std::size_t lhs_len, const sockaddr* rhs,
+                            std::size_t rhs_len) noexcept
+{
+    if (lhs->sa_family != rhs->sa_family) {
+        return false;
+    }
+    switch (lhs->sa_family) {
+    case AF_INET:
+        return reinterpret_cast<const sockaddr_in*>(lhs)->sin_addr.s_addr
+            == reinterpret_cast<const sockaddr_in*>(rhs)->sin_addr.s_addr;
+    case AF_INET6:
+        return std::memcmp(&reinterpret_cast<const sockaddr_in6*>(lhs)->sin6_addr,
+                           &reinterpret_cast<const sockaddr_in6*>(rhs)->sin6_addr,
+                           sizeof(in6_addr))
+            == 0;
+    }
+    return lhs_len == rhs_len && std::memcmp(lhs, rhs, lhs_len) == 0;
+}
+
+/// Hashes the family and address of a socket address, and the port if WithPortV is true. Other
+/// fields, such as padding, are ignored. Addresses that are not IP addresses are hashed as bytes.
+template <bool WithPortV>
+std::size_t hash_sock_addr(const sockaddr* addr, std::size_t len) noexcept
+{
+    std::size_t h{0};
+    switch (addr->sa_family) {
+    case AF_INET: {
+        const auto* in = reinterpret_cast<const sockaddr_in*>(addr);
+        boost::hash_combine(h, in->sin_family);
+        boost::hash_combine(h, in->sin_addr.s_addr);
+        if constexpr (WithPortV) {
+            boost::hash_combine(h, in->sin_port);
+        }
+        break;
+    }
+    case AF_INET6: {
+        const auto* in6 = reinterpret_cast<const sockaddr_in6*>(addr);
+        const auto* bytes = in6->sin6_addr.s6_addr;
+        boost::hash_combine(h, in6->sin6_family);
+        boost::hash_range(h, bytes, bytes + sizeof(in6->sin6_addr.s6_addr));
+        if constexpr (WithPortV) {
+            boost::hash_combine(h, in6->sin6_port);
+        }
+        break;
+    }
+    default: {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(addr);
+        boost::hash_range(h, bytes, bytes + len);
+    }
+    }
+    return h;
+}
+} // detail namespace
+
+/// Hashes the family, address and port of an endpoint, so that endpoints may be used as keys in
+/// unordered containers, where they compare equal if their socket addresses are identical.
+template <typename ProtocolT>
+struct BasicEndpointHash {
+    std::size_t operator()(const BasicEndpoint<ProtocolT>& ep) const noexcept
+    {
+        return detail::hash_sock_addr<true>(ep.data(), ep.size());
+    }
+};
+
+/// Hashes the family and address of an endpoint, but not the port, so that all connections from
+/// the same host map to the same key. Use with BasicEndpointAddrEqual.
+template <typename ProtocolT>
+struct BasicEndpointAddrHash {
+    std::size_t operator()(const BasicEndpoint<ProtocolT>& ep) const noexcept
+    {
+        return detail::hash_sock_addr<false>(ep.data(), ep.size());
+    }
+};
+
+/// Compares the family and address of two endpoints, but not the port.
+template <typename ProtocolT>
+struct BasicEndpointAddrEqual {
+    bool operator()(const BasicEndpoint<ProtocolT>& lhs,
+                    const BasicEndpoint<ProtocolT>& rhs) const noexcept
+    {
+        return detail::equal_sock_addr(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    }
+};
+
+using DgramEndpointHash = BasicEndpointHash<DgramProtocol>;
+using StreamEndpointHash = BasicEndpointHash<StreamProtocol>;
+using DgramEndpointAddrHash = BasicEndpointAddrHash<DgramProtocol>;
+using StreamEndpointAddrHash = BasicEndpointAddrHash<StreamProtocol>;
+using DgramEndpointAddrEqual = BasicEndpointAddrEqual<DgramProtocol>;
+using StreamEndpointAddrEqual = BasicEndpointAddrEqual<StreamProtocol>;
+
 TOOLBOX_API AddrInfoPtr parse_endpoint(std::string_view uri, int type);
 
+/// Parse an endpoint URI whose address is a numeric IPv4 or IPv6 address, or a Unix domain path,
+/// without calling getaddrinfo(). Returns std::nullopt if the URI contains a hostname or service
+/// name that must be resolved. Throws std::invalid_argument if the URI scheme is invalid.
+TOOLBOX_API std::optional<DgramEndpoint> parse_numeric_dgram_endpoint(std::string_view uri);
+
+/// Parse an endpoint URI whose address is a numeric IPv4 or IPv6 address, or a Unix domain path,
+/// without calling getaddrinfo(). Returns std::nullopt if the URI contains a hostname or service
+/// name that must be resolved. Throws std::invalid_argument if the URI scheme is invalid.
+TOOLBOX_API std::optional<StreamEndpoint> parse_numeric_stream_endpoint(std::string_view uri);
+
+/// Parse an endpoint URI. Numeric addresses are parsed directly, and getaddrinfo() is only used to
+/// resolve hostnames and service names.
 inline DgramEndpoint parse_dgram_endpoint(std::string_view uri)
 {
+    if (auto ep = parse_numeric_dgram_endpoint(uri)) {
+        return *ep;
+    }
     const auto ai = parse_endpoint(uri, SOCK_DGRAM);
     return {ai->ai_addr, ai->ai_addrlen, ai->ai_protocol};
 }
 
+/// Parse an endpoint URI. Numeric addresses are parsed directly, and getaddrinfo() is only used to
+/// resolve hostnames and service names.
 inline StreamEndpoint parse_stream_endpoint(std::string_view uri)
 {
+    if (auto ep = parse_numeric_stream_endpoint(uri)) {
+        return *ep;
+    }
     const auto ai = parse_endpoint(uri, SOCK_STREAM);
     return {ai->ai_addr, ai->ai_addrlen, ai->ai_protocol};
 }
@@ -188,6 +188,67 @@ BOOST_AUTO_TEST_CASE(ParseStreamBindCase)
     BOOST_CHECK_EQUAL(to_string(ep), "tcp4://0.0.0.0:80");
 }
 
+BOOST_AUTO_TEST_CASE(ParseNumericCase)
+{
+    auto ep = parse_numeric_stream_endpoint("tcp4://1.2.3.4:7777");
+    BOOST_TEST_REQUIRE(ep.has_value());
+    BOOST_CHECK_EQUAL(ep->protocol().family(), AF_INET);
+    BOOST_CHECK_EQUAL(ep->protocol().protocol(), IPPROTO_TCP);
+    BOOST_CHECK_EQUAL(to_string(*ep), "tcp4://1.2.3.4:7777");
+
+    ep = parse_numeric_stream_endpoint("[fe80::c8bf:7d86:cbdc:bda9]:443");
+    BOOST_TEST_REQUIRE(ep.has_value());
+    BOOST_CHECK_EQUAL(to_string(*ep), "tcp6://[fe80::c8bf:7d86:cbdc:bda9]:443");
+
+    ep = parse_numeric_stream_endpoint("tcp6://:80");
+    BOOST_TEST_REQUIRE(ep.has_value());
+    BOOST_CHECK_EQUAL(to_string(*ep), "tcp6://[::]:80");
+
+    const auto dep = parse_numeric_dgram_endpoint("unix://|12345");
+    BOOST_TEST_REQUIRE(dep.has_value());
+    BOOST_CHECK_EQUAL(to_string(*dep), "unix://|12345");
+
+    // Hostnames, service names and unspecified wildcards are left to getaddrinfo().
+    BOOST_CHECK(!parse_numeric_stream_endpoint("localhost:80"));
+    BOOST_CHECK(!parse_numeric_stream_endpoint("tcp4://1.2.3.4:http"));
+    BOOST_CHECK(!parse_numeric_stream_endpoint("tcp4://1.2.3.4:65536"));
+    BOOST_CHECK(!parse_numeric_stream_endpoint(":80"));
+
+    BOOST_CHECK_THROW(parse_numeric_stream_endpoint("udp4://1.2.3.4:80"), invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(ParseNumericMatchesGetAddrInfoCase)
+{
+    for (const auto* uri : {"192.168.1.3:443", "ip4://10.0.0.1:1", "tcp4://:80",
+                            "ip6://[::1]:8080", "tcp6://[fe80::1]:0", "unix:///tmp/foo.sock"}) {
+        const auto ai = parse_endpoint(uri, SOCK_STREAM);
+        const StreamEndpoint expected{ai->ai_addr, ai->ai_addrlen, ai->ai_protocol};
+        const auto ep = parse_numeric_stream_endpoint(uri);
+        BOOST_TEST_REQUIRE(ep.has_value());
+        BOOST_CHECK_EQUAL(to_string(*ep), to_string(expected));
+        BOOST_CHECK(*ep == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(EndpointHashCase)
+{
+    const auto ep1 = parse_stream_endpoint("tcp6://[::1]:8080");
+    const auto ep2 = parse_stream_endpoint("tcp6://[::1]:8081");
+    StreamEndpointHash hash;
+    StreamEndpointAddrHash addr_hash;
+    StreamEndpointAddrEqual addr_equal;
+
+    BOOST_CHECK_EQUAL(hash(ep1), hash(parse_stream_endpoint("tcp6://[::1]:8080")));
+    BOOST_CHECK_NE(hash(ep1), hash(ep2));
+    BOOST_CHECK_EQUAL(addr_hash(ep1), addr_hash(ep2));
+    BOOST_CHECK(addr_equal(ep1, ep2));
+    BOOST_CHECK(!addr_equal(ep1, parse_stream_endpoint("tcp6://[::2]:8080")));
+    BOOST_CHECK(!addr_equal(parse_stream_endpoint("tcp4://127.0.0.1:8080"),
+                            parse_stream_endpoint("tcp4://127.0.0.2:8080")));
+    BOOST_CHECK(addr_equal(parse_stream_endpoint("unix:///tmp/foo.sock"),
+                           parse_stream_endpoint("unix:///tmp/foo.sock")));
+}
+
 BOOST_AUTO_TEST_CASE(IPv4Formatting)
 {
     ipv4_os.set_storage(ipv4_os.make_storage());
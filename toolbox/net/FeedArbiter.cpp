@@ -0,0 +1,95 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FeedArbiter.hpp"
+
+#include <bit>
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+
+SeqWindow::SeqWindow(size_t size)
+: bits_(bit_ceil(max<size_t>(size, 64)) / 64)
+, mask_{bits_.size() * 64 - 1}
+{
+}
+
+bool SeqWindow::test(uint64_t seq) const noexcept
+{
+    return !empty_ && seq <= head_ && head_ - seq <= mask_ && test_bit(seq);
+}
+
+SeqStatus SeqWindow::insert(uint64_t seq) noexcept
+{
+    if (empty_) {
+        // Sequence numbers behind the first are treated as seen, so that they are not reported as
+        // lost when they leave the window.
+        fill(bits_.begin(), bits_.end(), ~uint64_t{0});
+        head_ = seq;
+        empty_ = false;
+        return SeqStatus::Next;
+    }
+    if (seq > head_) {
+        const auto next = seq == head_ + 1;
+        advance(seq);
+        return next ? SeqStatus::Next : SeqStatus::Ahead;
+    }
+    if (head_ - seq > mask_) {
+        return SeqStatus::Stale;
+    }
+    if (test_bit(seq)) {
+        return SeqStatus::Duplicate;
+    }
+    set_bit(seq);
+    --missing_;
+    return SeqStatus::Late;
+}
+
+void SeqWindow::reset() noexcept
+{
+    lost_ += missing_;
+    missing_ = 0;
+    head_ = 0;
+    empty_ = true;
+}
+
+void SeqWindow::advance(uint64_t seq) noexcept
+{
+    const auto n = seq - head_;
+    if (n > mask_) {
+        // The new window does not overlap the old one, so everything that was missing from the old
+        // window is lost, along with any skipped sequence numbers that fall between the two.
+        lost_ += missing_ + (n - size());
+        missing_ = mask_;
+        fill(bits_.begin(), bits_.end(), 0);
+    } else {
+        for (auto s = head_ + 1; s <= seq; ++s) {
+            // Each slot that is reused held the sequence number s - size(), which is lost if it was
+            // never filled.
+            if (!test_bit(s)) {
+                --missing_;
+                ++lost_;
+            }
+            clear_bit(s);
+        }
+        missing_ += n - 1;
+    }
+    set_bit(seq);
+    head_ = seq;
+}
+
+} // namespace net
+} // namespace toolbox
@@ -0,0 +1,312 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_FEEDARBITER_HPP
+#define TOOLBOX_NET_FEEDARBITER_HPP
+
+#include <toolbox/hdr/Histogram.hpp>
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/Endian.hpp>
+#include <toolbox/net/McastSock.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+namespace toolbox {
+inline namespace net {
+
+/// Result of inserting a sequence number into a SeqWindow.
+enum class SeqStatus : int {
+    /// The sequence number is the next in order, or the first seen by the window.
+    Next,
+    /// The sequence number is ahead of the next expected, so one or more sequence numbers were
+    /// skipped.
+    Ahead,
+    /// The sequence number was previously skipped, and has now been filled.
+    Late,
+    /// The sequence number has already been seen.
+    Duplicate,
+    /// The sequence number is too old to be tracked by the window.
+    Stale
+};
+
+/// Tracks the sequence numbers received within a sliding window behind the highest sequence number
+/// seen, using a single bit per sequence number.
+class TOOLBOX_API SeqWindow {
+  public:
+    /// The size is rounded up to a power of two that is at least 64.
+    explicit SeqWindow(std::size_t size = 4096);
+    ~SeqWindow() = default;
+
+    // Copy.
+    SeqWindow(const SeqWindow&) = delete;
+    SeqWindow& operator=(const SeqWindow&) = delete;
+
+    // Move.
+    SeqWindow(SeqWindow&&) noexcept = default;
+    SeqWindow& operator=(SeqWindow&&) noexcept = default;
+
+    bool empty() const noexcept { return empty_; }
+    /// Returns the number of sequence numbers tracked behind the head.
+    std::size_t size() const noexcept { return mask_ + 1; }
+    /// Returns the highest sequence number seen.
+    std::uint64_t head() const noexcept { return head_; }
+    /// Returns the number of skipped sequence numbers that are still within the window.
+    std::uint64_t missing() const noexcept { return missing_; }
+    /// Returns the number of skipped sequence numbers that left the window without being filled.
+    std::uint64_t lost() const noexcept { return lost_; }
+
+    /// Returns true if the sequence number is within the window and has been seen.
+    bool test(std::uint64_t seq) const noexcept;
+
+    /// Records the sequence number and returns its status relative to the window.
+    SeqStatus insert(std::uint64_t seq) noexcept;
+
+    /// Forgets all sequence numbers, so that the next sequence number starts a new window. This is
+    /// typically used when the feed is known to have restarted from a lower sequence number.
+    void reset() noexcept;
+
+  private:
+    bool test_bit(std::uint64_t seq) const noexcept
+    {
+        return (bits_[(seq & mask_) >> 6] >> (seq & 63)) & 1;
+    }
+    void set_bit(std::uint64_t seq) noexcept
+    {
+        bits_[(seq & mask_) >> 6] |= std::uint64_t{1} << (seq & 63);
+    }
+    void clear_bit(std::uint64_t seq) noexcept
+    {
+        bits_[(seq & mask_) >> 6] &= ~(std::uint64_t{1} << (seq & 63));
+    }
+    void advance(std::uint64_t seq) noexcept;
+
+    std::vector<std::uint64_t> bits_;
+    std::uint64_t mask_;
+    std::uint64_t head_{0};
+    std::uint64_t missing_{0};
+    std::uint64_t lost_{0};
+    bool empty_{true};
+};
+
+/// Sequence number policy for messages that carry an unsigned integer at a fixed offset.
+template <typename ValueT, std::size_t Offset = 0, std::endian Order = std::endian::big>
+    requires std::unsigned_integral<ValueT>
+struct SeqAtOffset {
+    std::optional<std::uint64_t> operator()(ConstBuffer msg) const noexcept
+    {
+        if (buffer_size(msg) < Offset + sizeof(ValueT)) {
+            return std::nullopt;
+        }
+        ValueT n;
+        std::memcpy(&n, static_cast<const char*>(msg.data()) + Offset, sizeof(n));
+        if constexpr (Order == std::endian::big) {
+            return ntoh(n);
+        } else {
+            return ltoh(n);
+        }
+    }
+};
+
+/// Counters for each line of a BasicFeedArbiter.
+struct FeedLineStats {
+    /// Number of messages received, including duplicates.
+    std::uint64_t received{0};
+    /// Number of messages delivered because they were the first copy received.
+    std::uint64_t wins{0};
+    /// Number of messages dropped because they had already been received on another line.
+    std::uint64_t duplicates{0};
+    /// Number of messages dropped because they were behind the window.
+    std::uint64_t stale{0};
+    /// Number of messages dropped because the policy could not extract a sequence number.
+    std::uint64_t invalid{0};
+};
+
+/// Arbitrates between redundant multicast lines that carry the same sequenced feed.
+///
+/// Each datagram is assumed to contain a single message, and the sequence number is extracted by
+/// the SeqPolicyT function object, which returns std::nullopt for datagrams that are not sequenced.
+/// The first copy of each message is delivered to the application, regardless of the line that it
+/// arrived on, and subsequent copies are dropped using a SeqWindow.
+///
+/// A gap is raised as soon as the arbitrated feed skips one or more sequence numbers, and a
+/// recovery is raised when a skipped message subsequently arrives on any line while it is still in
+/// the window. For each line, the arbiter records the number of messages that it won, and a
+/// histogram of the delay, in nanoseconds, between the winning copy and the copy received on the
+/// line.
+///
+/// The AppT type must provide the following member functions:
+///
+///     void on_feed_message(CyclTime now, std::size_t line, std::uint64_t seq, ConstBuffer msg);
+///     void on_feed_gap(CyclTime now, std::uint64_t seq, std::uint64_t count);
+///     void on_feed_recovery(CyclTime now, std::size_t line, std::uint64_t seq);
+///
+/// The on_feed_recovery() function is called after the late message has been passed to
+/// on_feed_message().
+///
+/// \tparam AppT The application type.
+/// \tparam SeqPolicyT The sequence number policy.
+template <typename AppT, typename SeqPolicyT>
+class BasicFeedArbiter {
+    using App = AppT;
+
+    /// Maximum number of datagrams read from each line per event, to avoid starvation.
+    static constexpr int MaxReads{16};
+    /// Maximum UDP payload size.
+    static constexpr std::size_t MaxDatagramSize{65'507};
+    /// Highest delay recorded by the delay histograms.
+    static constexpr std::int64_t MaxDelay{10'000'000'000};
+
+    struct Line {
+        McastSock sock;
+        Reactor::Handle sub;
+        FeedLineStats stats;
+        Histogram delays{1, MaxDelay, 3};
+    };
+
+  public:
+    BasicFeedArbiter(Reactor& r, App& app, std::size_t window = 4096,
+                     SeqPolicyT policy = SeqPolicyT{})
+    : reactor_{r}
+    , app_{app}
+    , policy_{std::move(policy)}
+    , window_{window}
+    , first_times_(window_.size())
+    , first_lines_(window_.size())
+    , buf_(MaxDatagramSize)
+    {
+    }
+    ~BasicFeedArbiter() = default;
+
+    // Copy.
+    BasicFeedArbiter(const BasicFeedArbiter&) = delete;
+    BasicFeedArbiter& operator=(const BasicFeedArbiter&) = delete;
+
+    // Move.
+    BasicFeedArbiter(BasicFeedArbiter&&) = delete;
+    BasicFeedArbiter& operator=(BasicFeedArbiter&&) = delete;
+
+    /// Returns the number of lines.
+    std::size_t lines() const noexcept { return lines_.size(); }
+    const FeedLineStats& stats(std::size_t line) const noexcept { return lines_[line].stats; }
+    /// Returns the histogram of delays, in nanoseconds, between the winning copy of each message
+    /// and the copy received on the line.
+    const Histogram& delays(std::size_t line) const noexcept { return lines_[line].delays; }
+    /// Returns the fraction of delivered messages that were won by the line.
+    double win_ratio(std::size_t line) const noexcept
+    {
+        return delivered_ > 0 ? static_cast<double>(lines_[line].stats.wins) / delivered_ : 0.0;
+    }
+    /// Returns the number of messages delivered to the application.
+    std::uint64_t delivered() const noexcept { return delivered_; }
+    const SeqWindow& window() const noexcept { return window_; }
+
+    /// Adds a line to the arbiter and returns its index. The socket must already be bound and
+    /// joined to the multicast group.
+    std::size_t add_line(McastSock&& sock)
+    {
+        sock.set_non_block();
+        auto& line = lines_.emplace_back();
+        line.sock = std::move(sock);
+        line.sub = reactor_.subscribe(*line.sock, EpollIn,
+                                      bind<&BasicFeedArbiter::on_io_event>(this));
+        return lines_.size() - 1;
+    }
+
+    /// Resets the window, so that the next message starts a new sequence.
+    void reset() noexcept { window_.reset(); }
+
+    /// Passes a single datagram through the arbiter, as if it had been received on the line at the
+    /// given monotonic time.
+    void arbitrate(CyclTime now, std::size_t line, MonoTime time, ConstBuffer msg)
+    {
+        auto& ln = lines_[line];
+        ++ln.stats.received;
+        const auto seq = policy_(msg);
+        if (!seq) {
+            ++ln.stats.invalid;
+            return;
+        }
+        const auto head = window_.head();
+        const auto first = window_.empty();
+        const auto status = window_.insert(*seq);
+        switch (status) {
+        case SeqStatus::Next:
+        case SeqStatus::Ahead:
+        case SeqStatus::Late:
+            ++ln.stats.wins;
+            ++delivered_;
+            first_times_[*seq & (first_times_.size() - 1)] = time;
+            first_lines_[*seq & (first_lines_.size() - 1)] = line;
+            if (status == SeqStatus::Ahead && !first) {
+                app_.on_feed_gap(now, head + 1, *seq - head - 1);
+            }
+            app_.on_feed_message(now, line, *seq, msg);
+            if (status == SeqStatus::Late) {
+                app_.on_feed_recovery(now, line, *seq);
+            }
+            break;
+        case SeqStatus::Duplicate:
+            ++ln.stats.duplicates;
+            if (first_lines_[*seq & (first_lines_.size() - 1)] != line) {
+                const auto delay = time - first_times_[*seq & (first_times_.size() - 1)];
+                ln.delays.record_value(std::clamp<std::int64_t>(delay.count(), 1, MaxDelay));
+            }
+            break;
+        case SeqStatus::Stale:
+            ++ln.stats.stale;
+            break;
+        }
+    }
+
+  private:
+    void on_io_event(CyclTime now, int fd, unsigned /*events*/)
+    {
+        std::size_t line{0};
+        while (*lines_[line].sock != fd) {
+            ++line;
+        }
+        for (int i{0}; i < MaxReads; ++i) {
+            std::error_code ec;
+            const auto size = lines_[line].sock.recv(buf_.data(), buf_.size(), 0, ec);
+            if (ec) {
+                // No data available in socket buffer.
+                if (ec == std::errc::operation_would_block) {
+                    break;
+                }
+                throw std::system_error{ec, "recv"};
+            }
+            arbitrate(now, line, MonoClock::now(), {buf_.data(), static_cast<std::size_t>(size)});
+        }
+    }
+
+    Reactor& reactor_;
+    App& app_;
+    SeqPolicyT policy_;
+    SeqWindow window_;
+    /// Arrival time and line of the first copy of each message in the window.
+    std::vector<MonoTime> first_times_;
+    std::vector<std::size_t> first_lines_;
+    std::vector<Line> lines_;
+    std::vector<char> buf_;
+    std::uint64_t delivered_{0};
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_FEEDARBITER_HPP
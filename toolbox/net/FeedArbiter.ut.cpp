@@ -0,0 +1,207 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FeedArbiter.hpp"
+
+#include <toolbox/net/Endian.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct App {
+    void on_feed_message(CyclTime /*now*/, size_t line, uint64_t seq, ConstBuffer /*msg*/)
+    {
+        ++msgs[seq];
+        lines[seq] = line;
+    }
+    void on_feed_gap(CyclTime /*now*/, uint64_t /*seq*/, uint64_t count) { gaps += count; }
+    void on_feed_recovery(CyclTime /*now*/, size_t /*line*/, uint64_t /*seq*/) { ++recoveries; }
+
+    map<uint64_t, int> msgs;
+    map<uint64_t, size_t> lines;
+    uint64_t gaps{0}, recoveries{0};
+};
+
+using FeedArbiter = BasicFeedArbiter<App, SeqAtOffset<uint64_t>>;
+
+struct Msg {
+    explicit Msg(uint64_t seq) noexcept
+    : seq{hton(seq)}
+    {
+    }
+    ConstBuffer buf() const noexcept { return {this, sizeof(*this)}; }
+    uint64_t seq;
+    char payload[8]{};
+};
+
+McastSock make_line(const IpAddr& group, unsigned ifindex, uint16_t port = 0)
+{
+    McastSock sock{UdpProtocol::v4()};
+    sock.set_reuse_addr(true);
+    sock.bind(UdpEndpoint{group, port});
+    join_group(sock.get(), group, ifindex);
+    return sock;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FeedArbiterSuite)
+
+BOOST_AUTO_TEST_CASE(SeqWindowCase)
+{
+    SeqWindow w{50};
+    BOOST_CHECK(w.empty());
+    BOOST_CHECK_EQUAL(w.size(), 64U);
+
+    BOOST_CHECK(w.insert(10) == SeqStatus::Next);
+    BOOST_CHECK(w.insert(11) == SeqStatus::Next);
+    BOOST_CHECK(w.insert(11) == SeqStatus::Duplicate);
+    BOOST_CHECK(w.insert(14) == SeqStatus::Ahead);
+    BOOST_CHECK_EQUAL(w.head(), 14U);
+    BOOST_CHECK_EQUAL(w.missing(), 2U);
+    BOOST_CHECK(!w.test(12));
+
+    BOOST_CHECK(w.insert(12) == SeqStatus::Late);
+    BOOST_CHECK(w.insert(12) == SeqStatus::Duplicate);
+    BOOST_CHECK(w.test(12));
+    BOOST_CHECK_EQUAL(w.missing(), 1U);
+
+    // Slide the window so that 13 is evicted without being filled.
+    BOOST_CHECK(w.insert(78) == SeqStatus::Ahead);
+    BOOST_CHECK_EQUAL(w.lost(), 1U);
+    BOOST_CHECK_EQUAL(w.missing(), 63U);
+    BOOST_CHECK(w.insert(14) == SeqStatus::Stale);
+    BOOST_CHECK(w.insert(15) == SeqStatus::Late);
+    BOOST_CHECK_EQUAL(w.missing(), 62U);
+
+    // Jump beyond the window.
+    BOOST_CHECK(w.insert(200) == SeqStatus::Ahead);
+    BOOST_CHECK_EQUAL(w.missing(), 63U);
+    BOOST_CHECK_EQUAL(w.lost(), 1U + 62U + 58U);
+
+    w.reset();
+    BOOST_CHECK(w.empty());
+    BOOST_CHECK(w.insert(1) == SeqStatus::Next);
+    BOOST_CHECK_EQUAL(w.missing(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(ArbitrateCase)
+{
+    Reactor r{1024};
+    App app;
+    FeedArbiter arb{r, app};
+    arb.add_line(McastSock{UdpProtocol::v4()});
+    arb.add_line(McastSock{UdpProtocol::v4()});
+
+    const auto now = CyclTime::now();
+    const auto t0 = now.mono_time();
+
+    // Line A leads line B by 1us, but drops 3 which is recovered from B.
+    for (uint64_t seq{1}; seq <= 5; ++seq) {
+        if (seq != 3) {
+            arb.arbitrate(now, 0, t0 + Nanos{seq * 10'000}, Msg{seq}.buf());
+        }
+    }
+    for (uint64_t seq{1}; seq <= 5; ++seq) {
+        arb.arbitrate(now, 1, t0 + Nanos{seq * 10'000 + 1'000}, Msg{seq}.buf());
+    }
+    // Not sequenced.
+    arb.arbitrate(now, 1, t0, {"x", 1});
+
+    BOOST_CHECK_EQUAL(app.msgs.size(), 5U);
+    BOOST_CHECK_EQUAL(app.gaps, 1U);
+    BOOST_CHECK_EQUAL(app.recoveries, 1U);
+    BOOST_CHECK_EQUAL(app.lines[3], 1U);
+    BOOST_CHECK_EQUAL(arb.delivered(), 5U);
+
+    BOOST_CHECK_EQUAL(arb.stats(0).wins, 4U);
+    BOOST_CHECK_EQUAL(arb.stats(1).wins, 1U);
+    BOOST_CHECK_EQUAL(arb.stats(1).duplicates, 4U);
+    BOOST_CHECK_EQUAL(arb.stats(1).invalid, 1U);
+    BOOST_CHECK_CLOSE(arb.win_ratio(0), 0.8, 0.001);
+
+    BOOST_CHECK_EQUAL(arb.delays(0).total_count(), 0);
+    BOOST_CHECK_EQUAL(arb.delays(1).total_count(), 4);
+    BOOST_CHECK(arb.delays(1).values_are_equivalent(arb.delays(1).max(), 1'000));
+}
+
+BOOST_AUTO_TEST_CASE(LoopbackCase)
+{
+    const auto ifindex = os::if_nametoindex("lo");
+    const auto group_a = boost::asio::ip::make_address("239.255.0.1");
+    const auto group_b = boost::asio::ip::make_address("239.255.0.2");
+
+    Reactor r{1024};
+    App app;
+    FeedArbiter arb{r, app};
+
+    auto line_a = make_line(group_a, ifindex);
+    UdpEndpoint ep_a;
+    line_a.get_sock_name(ep_a);
+    auto line_b = make_line(group_b, ifindex);
+    UdpEndpoint ep_b;
+    line_b.get_sock_name(ep_b);
+    arb.add_line(std::move(line_a));
+    arb.add_line(std::move(line_b));
+
+    McastSock pub{UdpProtocol::v4()};
+    set_ip_mcast_if(pub.get(), AF_INET, ifindex);
+    set_ip_mcast_loop(pub.get(), AF_INET, true);
+
+    // Each line drops a different subset, and both lines drop 50, 77 and 154.
+    constexpr uint64_t Count{200};
+    uint64_t expected{0}, lost{0};
+    for (uint64_t seq{1}; seq <= Count; ++seq) {
+        const Msg msg{seq};
+        const auto drop_a = seq % 7 == 0 || seq == 50;
+        const auto drop_b = seq % 11 == 0 || seq == 50;
+        if (!drop_a) {
+            pub.sendto(msg.buf(), 0, UdpEndpoint{group_a, ep_a.port()});
+        }
+        if (!drop_b) {
+            pub.sendto(msg.buf(), 0, UdpEndpoint{group_b, ep_b.port()});
+        }
+        if (!drop_a || !drop_b) {
+            ++expected;
+        } else {
+            ++lost;
+        }
+    }
+    for (int i{0}; i < 100 && app.msgs.size() < expected; ++i) {
+        r.poll(CyclTime::now(), 10ms);
+    }
+
+    BOOST_CHECK_EQUAL(app.msgs.size(), expected);
+    BOOST_CHECK(app.msgs.count(50) == 0);
+    // Each message is delivered exactly once.
+    for (const auto& [seq, n] : app.msgs) {
+        BOOST_CHECK_EQUAL(n, 1);
+    }
+    // Everything else was recovered, either from the other line or from a late read.
+    BOOST_CHECK_EQUAL(lost, 3U);
+    BOOST_CHECK_EQUAL(app.gaps - app.recoveries, lost);
+    BOOST_CHECK_EQUAL(arb.window().missing(), lost);
+    BOOST_CHECK_EQUAL(arb.stats(0).wins + arb.stats(1).wins, expected);
+    BOOST_CHECK_EQUAL(arb.stats(0).received + arb.stats(1).received,
+                      expected + arb.stats(0).duplicates + arb.stats(1).duplicates);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,9 +17,12 @@
 #ifndef TOOLBOX_NET_FRAME_HPP
 #define TOOLBOX_NET_FRAME_HPP
 
-#include <toolbox/io/Buffer.hpp>
+#include <toolbox/io/BufferChain.hpp>
 
 #include <cassert>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 
 namespace toolbox {
 inline namespace net {
@@ -102,28 +105,86 @@ inline void put_length(MutableBuffer buf, std::uint16_t len, std::endian net_byt
     put_length(static_cast<char*>(buf.data()), len, net_byte_order);
 }
 
+/// Reads a binary-encoded 4 byte integer from the input buffer.
+///
+/// \param buf The input buffer, which must be at least 4 bytes in length.
+/// \param net_byte_order Endianness used for network byte order decoding.
+/// \return the decoded 4 byte integer.
+constexpr std::uint32_t get_length32(const char* buf, std::endian net_byte_order) noexcept
+{
+    std::uint32_t len{0};
+    for (int i{0}; i < 4; ++i) {
+        len = (len << 8) | (buf[net_byte_order == std::endian::big ? i : 3 - i] & 0xff);
+    }
+    return len;
+}
+
+/// Writes a binary-encoded 4 byte integer to the output buffer.
+///
+/// \param buf The output buffer, which must be at least 4 bytes in length.
+/// \param len The length to be encoded.
+/// \param net_byte_order Endianness used for network byte order encoding.
+inline void put_length32(char* buf, std::uint32_t len, std::endian net_byte_order) noexcept
+{
+    for (int i{0}; i < 4; ++i) {
+        buf[net_byte_order == std::endian::big ? 3 - i : i] = 0xff & (len >> (i * 8));
+    }
+}
+
+/// Reads a frame length prefix of type LengthT, which must be either std::uint16_t or
+/// std::uint32_t.
+template <typename LengthT>
+constexpr std::size_t get_frame_length(const char* buf, std::endian net_byte_order) noexcept
+{
+    static_assert(std::is_same_v<LengthT, std::uint16_t> || std::is_same_v<LengthT, std::uint32_t>);
+    if constexpr (sizeof(LengthT) == sizeof(std::uint16_t)) {
+        return get_length(buf, net_byte_order);
+    } else {
+        return get_length32(buf, net_byte_order);
+    }
+}
+
+/// Writes a frame length prefix of type LengthT, which must be either std::uint16_t or
+/// std::uint32_t.
+template <typename LengthT>
+inline void put_frame_length(char* buf, LengthT len, std::endian net_byte_order) noexcept
+{
+    static_assert(std::is_same_v<LengthT, std::uint16_t> || std::is_same_v<LengthT, std::uint32_t>);
+    if constexpr (sizeof(LengthT) == sizeof(std::uint16_t)) {
+        put_length(buf, len, net_byte_order);
+    } else {
+        put_length32(buf, len, net_byte_order);
+    }
+}
+
 /// Calls the function object for each message encapsulated in a length-prefixed frame.
+/// The length prefix includes its own size, and is 2 bytes by default.
 ///
+/// \tparam LengthT The type of the length prefix, either std::uint16_t or std::uint32_t.
 /// \tparam FnT The type of the function object.
 /// \param buf The input buffer.
 /// \param fn The function object that is called for each complete message.
 /// \param net_byte_order Endianness used for network byte order decoding.
 /// \return the total number of consumed bytes.
-template <typename FnT>
+/// \throw std::invalid_argument if a length prefix is smaller than the prefix itself.
+template <typename LengthT = std::uint16_t, typename FnT>
 std::size_t parse_frame(ConstBuffer buf, FnT fn, std::endian net_byte_order)
 {
     std::size_t consumed{0};
     for (;;) {
         const auto* data = static_cast<const char*>(buf.data());
         const std::size_t size = buffer_size(buf);
-        if (size < sizeof(std::uint16_t)) {
+        if (size < sizeof(LengthT)) {
             break;
         }
-        const auto total = get_length(data, net_byte_order);
+        const auto total = get_frame_length<LengthT>(data, net_byte_order);
+        if (total < sizeof(LengthT)) {
+            throw std::invalid_argument{"invalid frame length"};
+        }
         if (size < total) {
             break;
         }
-        fn(ConstBuffer{data + sizeof(std::uint16_t), total - sizeof(std::uint16_t)});
+        fn(ConstBuffer{data + sizeof(LengthT), total - sizeof(LengthT)});
         buf = advance(buf, total);
         consumed += total;
     }
@@ -132,15 +193,57 @@ std::size_t parse_frame(ConstBuffer buf, FnT fn, std::endian net_byte_order)
 
 /// Calls the function object for each message encapsulated in a length-prefixed frame.
 ///
+/// \tparam LengthT The type of the length prefix, either std::uint16_t or std::uint32_t.
 /// \tparam FnT The type of the function object.
 /// \param buf The input buffer.
 /// \param fn The function object that is called for each complete message.
 /// \param net_byte_order Endianness used for network byte order decoding.
 /// \return the total number of consumed bytes.
-template <typename FnT>
+template <typename LengthT = std::uint16_t, typename FnT>
 std::size_t parse_frame(std::string_view buf, FnT fn, std::endian net_byte_order)
 {
-    return parse_frame(ConstBuffer{buf.data(), buf.size()}, fn, net_byte_order);
+    return parse_frame<LengthT>(ConstBuffer{buf.data(), buf.size()}, fn, net_byte_order);
+}
+
+/// Parses frames from a buffer chain without consuming them. Frames contained within a single
+/// segment are passed to the callback in place. Frames that straddle a segment boundary are first
+/// copied into a contiguous scratch buffer.
+template <typename LengthT = std::uint16_t, typename FnT>
+std::size_t parse_frame(const BufferChain& buf, FnT fn, std::endian net_byte_order)
+{
+    std::string scratch;
+    std::size_t consumed{0};
+    for (;;) {
+        const auto seg = buf.segment(consumed);
+        if (buffer_size(seg) == 0) {
+            break;
+        }
+        const auto n = parse_frame<LengthT>(seg, fn, net_byte_order);
+        consumed += n;
+        if (n == buffer_size(seg)) {
+            // Segment was fully consumed.
+            continue;
+        }
+        // The next frame is either incomplete or straddles a segment boundary.
+        const std::size_t avail{buf.size() - consumed};
+        if (avail < sizeof(LengthT)) {
+            break;
+        }
+        char len[sizeof(LengthT)];
+        buf.copy(consumed, len, sizeof(len));
+        const auto total = get_frame_length<LengthT>(len, net_byte_order);
+        if (total < sizeof(LengthT)) {
+            throw std::invalid_argument{"invalid frame length"};
+        }
+        if (avail < total) {
+            break;
+        }
+        scratch.resize(total);
+        buf.copy(consumed, scratch.data(), total);
+        fn(ConstBuffer{scratch.data() + sizeof(LengthT), total - sizeof(LengthT)});
+        consumed += total;
+    }
+    return consumed;
 }
 
 } // namespace net
@@ -97,4 +97,73 @@ BOOST_AUTO_TEST_CASE(ParseFrameCase)
                       "Baz");
 }
 
+BOOST_AUTO_TEST_CASE(ParseFrame32Case)
+{
+    char buf[4];
+    put_length32(buf, 0x01020304, endian::big);
+    BOOST_CHECK_EQUAL(string_view(buf, 4), "\001\002\003\004"sv);
+    BOOST_CHECK_EQUAL(get_length32(buf, endian::big), 0x01020304U);
+    put_length32(buf, 0x01020304, endian::little);
+    BOOST_CHECK_EQUAL(string_view(buf, 4), "\004\003\002\001"sv);
+    BOOST_CHECK_EQUAL(get_length32(buf, endian::little), 0x01020304U);
+
+    int msg_count{0};
+    string msg_data;
+    auto fn = [&](auto msg) {
+        ++msg_count;
+        msg_data.append(static_cast<const char*>(msg.data()), buffer_size(msg));
+    };
+    const auto consumed = parse_frame<uint32_t>("\000\000\000\007"
+                                                "Foo"
+                                                "\000\000\000\010"
+                                                "Ba"sv,
+                                                fn, endian::big);
+    BOOST_CHECK_EQUAL(consumed, 7U);
+    BOOST_CHECK_EQUAL(msg_count, 1);
+    BOOST_CHECK_EQUAL(msg_data, "Foo");
+
+    // A length prefix must include its own size.
+    BOOST_CHECK_THROW(parse_frame("\000\001"sv, fn, endian::big), invalid_argument);
+    BOOST_CHECK_THROW(parse_frame<uint32_t>("\000\000\000\003"sv, fn, endian::big),
+                      invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(ParseFrameChainCase)
+{
+    int msg_count{0};
+    string msg_data;
+    auto fn = [&](auto msg) {
+        ++msg_count;
+        msg_data.append(static_cast<const char*>(msg.data()), buffer_size(msg));
+    };
+
+    BufferPool pool;
+    BufferChain buf{pool};
+    // Pad the first segment so that the second frame straddles the segment boundary.
+    const string pad(BufferSegmentSize - 2 - 3, 'x');
+    char len[2];
+    put_length(len, pad.size() + 2, endian::big);
+    buf.append(len, 2);
+    buf.append(pad.data(), pad.size());
+    buf.append("\000\010"
+               "FooBar",
+               8);
+    buf.append("\000\005"
+               "Ba",
+               4);
+
+    auto consumed = parse_frame(buf, fn, endian::big);
+    BOOST_CHECK_EQUAL(consumed, BufferSegmentSize - 3 + 8);
+    BOOST_CHECK_EQUAL(msg_count, 2);
+    BOOST_CHECK_EQUAL(msg_data, pad + "FooBar");
+
+    buf.consume(consumed);
+    buf.append("z", 1);
+    msg_data.clear();
+    consumed = parse_frame(buf, fn, endian::big);
+    BOOST_CHECK_EQUAL(consumed, 5U);
+    BOOST_CHECK_EQUAL(msg_count, 3);
+    BOOST_CHECK_EQUAL(msg_data, "Baz");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
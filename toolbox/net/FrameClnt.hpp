@@ -0,0 +1,95 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_FRAMECLNT_HPP
+#define TOOLBOX_NET_FRAMECLNT_HPP
+
+#include <toolbox/net/FrameConn.hpp>
+#include <toolbox/net/StreamConnector.hpp>
+
+namespace toolbox {
+inline namespace net {
+
+/// Establishes stream connections and creates a BasicFrameConn for each. In addition to the
+/// callbacks required by BasicFrameConn, the AppT type must provide the following member function:
+///
+///     void on_frame_connect_error(CyclTime now, const std::exception& e) noexcept;
+///
+/// Only one connection attempt may be in progress at a time. Reconnection policy is left to the
+/// application.
+template <typename ConnT, typename AppT>
+class BasicFrameClnt : public StreamConnector<BasicFrameClnt<ConnT, AppT>> {
+
+    friend StreamConnector<BasicFrameClnt<ConnT, AppT>>;
+
+    using Conn = ConnT;
+    using App = AppT;
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<false>;
+    using MemberHookOption
+        = boost::intrusive::member_hook<Conn, decltype(Conn::list_hook), &Conn::list_hook>;
+    using ConnList = boost::intrusive::list<Conn, ConstantTimeSizeOption, MemberHookOption>;
+
+  public:
+    using typename StreamConnector<BasicFrameClnt<ConnT, AppT>>::Endpoint;
+
+    BasicFrameClnt(CyclTime /*now*/, Reactor& r, App& app)
+    : reactor_{r}
+    , app_{app}
+    {
+    }
+    ~BasicFrameClnt()
+    {
+        const auto now = CyclTime::current();
+        conn_list_.clear_and_dispose([now](auto* conn) { conn->dispose(now); });
+    }
+
+    // Copy.
+    BasicFrameClnt(const BasicFrameClnt&) = delete;
+    BasicFrameClnt& operator=(const BasicFrameClnt&) = delete;
+
+    // Move.
+    BasicFrameClnt(BasicFrameClnt&&) = delete;
+    BasicFrameClnt& operator=(BasicFrameClnt&&) = delete;
+
+    /// Returns true if connection was established synchronously or false if connection is pending
+    /// asynchronous completion.
+    bool connect(CyclTime now, const Endpoint& ep)
+    {
+        return StreamConnector<BasicFrameClnt<ConnT, AppT>>::connect(now, reactor_, ep);
+    }
+
+  private:
+    void on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
+    void on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& ep)
+    {
+        auto* const conn = new Conn{now, reactor_, std::move(sock), ep, pool_, app_};
+        conn_list_.push_back(*conn);
+    }
+    void on_sock_connect_error(CyclTime now, const std::exception& e)
+    {
+        app_.on_frame_connect_error(now, e);
+    }
+
+    Reactor& reactor_;
+    App& app_;
+    BufferPool pool_;
+    // List of active connections.
+    ConnList conn_list_;
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_FRAMECLNT_HPP
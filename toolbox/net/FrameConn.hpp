@@ -0,0 +1,287 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_FRAMECONN_HPP
+#define TOOLBOX_NET_FRAMECONN_HPP
+
+#include <toolbox/io/BufferChain.hpp>
+#include <toolbox/io/Disposer.hpp>
+#include <toolbox/io/MirroredBuffer.hpp>
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/Frame.hpp>
+#include <toolbox/net/IoSock.hpp>
+#include <toolbox/net/TcpInfo.hpp>
+#include <toolbox/util/Allocator.hpp>
+
+#include <boost/intrusive/list.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace toolbox {
+inline namespace net {
+
+/// A stream connection that exchanges length-prefixed frames.
+///
+/// Input is read into a MirroredBuffer, so that each message is passed to the application in place,
+/// without being copied or compacted. Output is appended to a BufferChain of segments drawn from a
+/// shared BufferPool, and is flushed with a single writev() call at the end of the Reactor cycle,
+/// regardless of how many messages were sent during the cycle.
+///
+/// The AppT type must provide the following member functions, which may be templates on the
+/// connection type:
+///
+///     void on_frame_connect(CyclTime now, Conn& conn);
+///     void on_frame_disconnect(CyclTime now, const Conn& conn) noexcept;
+///     void on_frame_error(CyclTime now, const Conn& conn, const std::exception& e) noexcept;
+///     void on_frame_message(CyclTime now, Conn& conn, ConstBuffer msg);
+///     void on_frame_timeout(CyclTime now, const Conn& conn) noexcept;
+///
+/// \tparam AppT The application type.
+/// \tparam LengthT The type of the length prefix, either std::uint16_t or std::uint32_t.
+/// \tparam MaxFrameSizeN The maximum size of an inbound frame, including the length prefix. The
+/// connection is disposed as soon as the peer announces a larger frame, so that a peer cannot
+/// exhaust memory by announcing a frame of almost 4 GiB.
+template <typename AppT, typename LengthT = std::uint16_t,
+          std::size_t MaxFrameSizeN = std::min<std::size_t>(std::numeric_limits<LengthT>::max(),
+                                                            1 << 20)>
+class BasicFrameConn
+: public Allocator
+, public BasicDisposer<BasicFrameConn<AppT, LengthT, MaxFrameSizeN>> {
+
+    friend class BasicDisposer<BasicFrameConn<AppT, LengthT, MaxFrameSizeN>>;
+
+    using App = AppT;
+    // Automatically unlink when object is destroyed.
+    using AutoUnlinkOption = boost::intrusive::link_mode<boost::intrusive::auto_unlink>;
+
+    static constexpr auto IdleTimeout = 5s;
+    static constexpr std::size_t ReadSize{4096};
+
+  public:
+    using Protocol = StreamProtocol;
+    using Endpoint = StreamEndpoint;
+
+    /// Byte order of the length prefix.
+    static constexpr auto ByteOrder = std::endian::big;
+    /// Maximum size of a message, excluding the length prefix.
+    static constexpr std::size_t MaxMessageSize{std::numeric_limits<LengthT>::max()
+                                                - sizeof(LengthT)};
+    /// Maximum size of an inbound frame, including the length prefix.
+    static constexpr std::size_t MaxFrameSize{MaxFrameSizeN};
+    static_assert(MaxFrameSize > sizeof(LengthT));
+
+    BasicFrameConn(CyclTime now, Reactor& r, IoSock&& sock, const Endpoint& ep, BufferPool& pool,
+                   App& app)
+    : reactor_{r}
+    , sock_{std::move(sock)}
+    , ep_{ep}
+    , app_{app}
+    , flush_hook_{bind<&BasicFrameConn::on_flush>(this)}
+    , out_{pool}
+    {
+        sub_ = r.subscribe(*sock_, EpollIn, bind<&BasicFrameConn::on_io_event>(this));
+        tcp_probe.set_fd(*sock_);
+        schedule_timeout(now);
+        app.on_frame_connect(now, *this);
+    }
+
+    // Copy.
+    BasicFrameConn(const BasicFrameConn&) = delete;
+    BasicFrameConn& operator=(const BasicFrameConn&) = delete;
+
+    // Move.
+    BasicFrameConn(BasicFrameConn&&) = delete;
+    BasicFrameConn& operator=(BasicFrameConn&&) = delete;
+
+    const Endpoint& endpoint() const noexcept { return ep_; }
+
+    /// Returns the number of bytes waiting to be written to the socket.
+    std::size_t pending() const noexcept { return out_.size(); }
+
+    /// Queues a message for sending. Messages are written to the socket at the end of the current
+    /// Reactor cycle, or when the socket becomes writable if the previous write was blocked.
+    void send(ConstBuffer msg)
+    {
+        const std::size_t size{buffer_size(msg)};
+        if (size > MaxMessageSize) {
+            throw std::length_error{"message too large for frame"};
+        }
+        char len[sizeof(LengthT)];
+        put_frame_length<LengthT>(len, static_cast<LengthT>(size + sizeof(LengthT)), ByteOrder);
+        out_.append(len, sizeof(len));
+        out_.append(static_cast<const char*>(msg.data()), size);
+        if (!write_blocked_ && !flush_hook_.is_linked()) {
+            reactor_.add_hook(flush_hook_);
+        }
+    }
+    void send(std::string_view msg) { send(ConstBuffer{msg.data(), msg.size()}); }
+
+    boost::intrusive::list_member_hook<AutoUnlinkOption> list_hook;
+    /// Transport metrics, which are sampled while the probe is linked into a TcpInfoSampler.
+    TcpInfoProbe tcp_probe;
+
+  protected:
+    void dispose_now(CyclTime now) noexcept
+    {
+        app_.on_frame_disconnect(now, *this); // noexcept
+        // Best effort to drain any data still pending in the write buffer before the socket is
+        // closed.
+        if (!out_.empty()) {
+            std::error_code ec;
+            sock_.writev(out_, ec); // noexcept
+        }
+        delete this;
+    }
+
+  private:
+    ~BasicFrameConn() = default;
+    void on_timeout_timer(CyclTime now, Timer& /*tmr*/)
+    {
+        auto lock = this->lock_this(now);
+        app_.on_frame_timeout(now, *this);
+        this->dispose(now);
+    }
+    void on_flush(CyclTime now)
+    {
+        // The hook is only installed while output is pending.
+        flush_hook_.unlink();
+        auto lock = this->lock_this(now);
+        try {
+            flush_output();
+        } catch (const std::exception& e) {
+            app_.on_frame_error(now, *this, e);
+            this->dispose(now);
+        }
+    }
+    void on_io_event(CyclTime now, int fd, unsigned events)
+    {
+        auto lock = this->lock_this(now);
+        try {
+            if (events & (EpollIn | EpollHup)) {
+                if (!drain_input(now, fd)) {
+                    this->dispose(now);
+                    return;
+                }
+            }
+            // Output sent while the socket was writable is flushed by the end of cycle hook.
+            if (write_blocked_ && (events & EpollOut)) {
+                flush_output();
+            }
+        } catch (const std::exception& e) {
+            app_.on_frame_error(now, *this, e);
+            this->dispose(now);
+        }
+    }
+    bool drain_input(CyclTime now, int fd)
+    {
+        // Limit the number of reads to avoid starvation.
+        for (int i{0}; i < 4; ++i) {
+            std::error_code ec;
+            const auto buf = in_.prepare(ReadSize);
+            const auto size = os::read(fd, buf, ec);
+            if (ec) {
+                // No data available in socket buffer.
+                if (ec == std::errc::operation_would_block) {
+                    break;
+                }
+                throw std::system_error{ec, "read"};
+            }
+            if (size == 0) {
+                flush_input(now);
+                return false;
+            }
+            // Commit actual bytes read.
+            in_.commit(size);
+            // Assume that the stream has been drained if we read less than the requested amount.
+            if (static_cast<size_t>(size) < buffer_size(buf)) {
+                break;
+            }
+        }
+        flush_input(now);
+        // Reset timer.
+        schedule_timeout(now);
+        return true;
+    }
+    void flush_input(CyclTime now)
+    {
+        const auto fn = [this, now](ConstBuffer msg) {
+            check_frame_length(buffer_size(msg) + sizeof(LengthT));
+            app_.on_frame_message(now, *this, msg);
+        };
+        in_.consume(parse_frame<LengthT>(in_.data(), fn, ByteOrder));
+        // Reject an oversized frame as soon as its length is known, rather than buffering it.
+        const auto rest = in_.data();
+        if (buffer_size(rest) >= sizeof(LengthT)) {
+            check_frame_length(
+                get_frame_length<LengthT>(static_cast<const char*>(rest.data()), ByteOrder));
+        }
+    }
+    static void check_frame_length(std::size_t total)
+    {
+        if (total > MaxFrameSize) {
+            throw std::length_error{"frame too large"};
+        }
+    }
+    void flush_output()
+    {
+        // Each writev() call is limited to MaxBufferIov segments, so continue until the buffer has
+        // been drained or the socket would block.
+        while (!out_.empty()) {
+            std::error_code ec;
+            sock_.writev(out_, ec);
+            if (ec) {
+                if (ec != std::errc::operation_would_block) {
+                    throw std::system_error{ec, "writev"};
+                }
+                break;
+            }
+        }
+        if (out_.empty()) {
+            if (write_blocked_) {
+                // Restore read-only state after the buffer has been drained.
+                sub_.set_events(EpollIn);
+                write_blocked_ = false;
+            }
+        } else if (!write_blocked_) {
+            // Set the state to read-write if the entire buffer could not be written.
+            sub_.set_events(EpollIn | EpollOut);
+            write_blocked_ = true;
+        }
+    }
+    void schedule_timeout(CyclTime now)
+    {
+        const auto timeout = std::chrono::ceil<Seconds>(now.mono_time() + IdleTimeout);
+        tmr_ = reactor_.timer(timeout, Priority::Low,
+                              bind<&BasicFrameConn::on_timeout_timer>(this));
+    }
+
+    Reactor& reactor_;
+    IoSock sock_;
+    Endpoint ep_;
+    App& app_;
+    Reactor::Handle sub_;
+    Timer tmr_;
+    Hook flush_hook_;
+    MirroredBuffer in_;
+    BufferChain out_;
+    bool write_blocked_{false};
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_FRAMECONN_HPP
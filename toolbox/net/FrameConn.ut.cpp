@@ -0,0 +1,176 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FrameConn.hpp"
+
+#include "FrameClnt.hpp"
+#include "FrameServ.hpp"
+
+#include <toolbox/io/Reactor.ut.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct TestApp {
+    template <typename ConnT>
+    void on_frame_connect(CyclTime /*now*/, ConnT& conn)
+    {
+        ++connects;
+        last = &conn;
+    }
+    template <typename ConnT>
+    void on_frame_disconnect(CyclTime /*now*/, const ConnT& conn) noexcept
+    {
+        ++disconnects;
+        if (last == &conn) {
+            last = nullptr;
+        }
+    }
+    template <typename ConnT>
+    void on_frame_error(CyclTime /*now*/, const ConnT& /*conn*/, const exception& /*e*/) noexcept
+    {
+        ++errors;
+    }
+    template <typename ConnT>
+    void on_frame_message(CyclTime /*now*/, ConnT& conn, ConstBuffer msg)
+    {
+        msgs.emplace_back(static_cast<const char*>(msg.data()), buffer_size(msg));
+        if (echo) {
+            conn.send(msg);
+        }
+    }
+    template <typename ConnT>
+    void on_frame_timeout(CyclTime /*now*/, const ConnT& /*conn*/) noexcept
+    {
+    }
+    void on_frame_connect_error(CyclTime /*now*/, const exception& /*e*/) noexcept { ++errors; }
+
+    bool echo{false};
+    int connects{0}, disconnects{0}, errors{0};
+    void* last{nullptr};
+    vector<string> msgs;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(FrameConnSuite)
+
+BOOST_AUTO_TEST_CASE(FrameConnBatchCase)
+{
+    using Conn = BasicFrameConn<TestApp>;
+
+    Reactor r{1024};
+    BufferPool pool;
+    TestApp app1, app2;
+
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.first.set_non_block();
+    socks.second.set_non_block();
+
+    const auto now = CyclTime::now();
+    auto* const conn1 = new Conn{now, r, std::move(socks.first), {}, pool, app1};
+    // The peer connection disposes itself when the socket is closed.
+    new Conn{now, r, std::move(socks.second), {}, pool, app2};
+    BOOST_CHECK_EQUAL(app1.connects, 1);
+    BOOST_CHECK_EQUAL(app2.connects, 1);
+
+    // Messages are buffered until the end of the Reactor cycle.
+    conn1->send("foo"sv);
+    conn1->send("bar"sv);
+    conn1->send(""sv);
+    BOOST_CHECK_EQUAL(conn1->pending(), 3 * 2 + 6U);
+
+    BOOST_CHECK(poll_until(r, [&]() { return app2.msgs.size() == 3; }));
+    BOOST_CHECK_EQUAL(conn1->pending(), 0U);
+    BOOST_CHECK_EQUAL(app2.msgs[0], "foo");
+    BOOST_CHECK_EQUAL(app2.msgs[1], "bar");
+    BOOST_CHECK_EQUAL(app2.msgs[2], "");
+
+    BOOST_CHECK_THROW(conn1->send(string(Conn::MaxMessageSize + 1, 'x')), length_error);
+
+    conn1->dispose(now);
+    BOOST_CHECK_EQUAL(app1.disconnects, 1);
+    BOOST_CHECK(poll_until(r, [&]() { return app2.disconnects == 1; }));
+    BOOST_CHECK_EQUAL(app2.errors, 0);
+}
+
+BOOST_AUTO_TEST_CASE(FrameConnMaxSizeCase)
+{
+    using Conn = BasicFrameConn<TestApp, uint32_t, 1024>;
+    BOOST_CHECK_EQUAL((BasicFrameConn<TestApp, uint32_t>::MaxFrameSize), 1U << 20);
+
+    Reactor r{1024};
+    BufferPool pool;
+    TestApp app;
+
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.second.set_non_block();
+    new Conn{CyclTime::now(), r, std::move(socks.second), {}, pool, app};
+
+    char frame[1024]{};
+    // A frame of the maximum size is accepted.
+    put_frame_length<uint32_t>(frame, sizeof(frame), Conn::ByteOrder);
+    os::write(socks.first.get(), frame, sizeof(frame));
+    BOOST_CHECK(poll_until(r, [&]() { return app.msgs.size() == 1; }));
+    BOOST_CHECK_EQUAL(app.msgs[0].size(), sizeof(frame) - 4);
+
+    // The connection is closed as soon as a larger frame is announced.
+    put_frame_length<uint32_t>(frame, 1U << 30, Conn::ByteOrder);
+    os::write(socks.first.get(), frame, 4);
+    BOOST_CHECK(poll_until(r, [&]() { return app.disconnects == 1; }));
+    BOOST_CHECK_EQUAL(app.errors, 1);
+    BOOST_CHECK_EQUAL(app.msgs.size(), 1U);
+}
+
+BOOST_AUTO_TEST_CASE(FrameServClntCase)
+{
+    using Conn = BasicFrameConn<TestApp, uint32_t>;
+    using Serv = BasicFrameServ<Conn, TestApp>;
+    using Clnt = BasicFrameClnt<Conn, TestApp>;
+
+    Reactor r{1024};
+    TestApp serv_app, clnt_app;
+    serv_app.echo = true;
+
+    const auto now = CyclTime::now();
+    Serv serv{now, r, parse_stream_endpoint("tcp4://127.0.0.1:0"), serv_app};
+    Clnt clnt{now, r, clnt_app};
+    clnt.connect(now, serv.local_endpoint());
+    BOOST_CHECK(poll_until(r, [&]() { return clnt_app.last && serv_app.last; }));
+
+    // Larger than a 2 byte length prefix can encode.
+    const string big(100000, 'x');
+    auto* const conn = static_cast<Conn*>(clnt_app.last);
+    conn->send("foo"sv);
+    conn->send(big);
+    BOOST_CHECK(poll_until(r, [&]() { return clnt_app.msgs.size() == 2; }));
+    BOOST_CHECK_EQUAL(serv_app.msgs.size(), 2U);
+    BOOST_CHECK_EQUAL(clnt_app.msgs[0], "foo");
+    BOOST_CHECK(clnt_app.msgs[1] == big);
+    BOOST_CHECK_EQUAL(serv_app.errors + clnt_app.errors, 0);
+
+    // Existing connections are sampled once TCP_INFO sampling is enabled.
+    serv.enable_tcp_info(1s);
+    BOOST_TEST_REQUIRE(serv.tcp_info());
+    BOOST_CHECK_EQUAL(serv.tcp_info()->size(), 1U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,116 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_FRAMESERV_HPP
+#define TOOLBOX_NET_FRAMESERV_HPP
+
+#include <toolbox/net/FrameConn.hpp>
+#include <toolbox/net/StreamAcceptor.hpp>
+
+namespace toolbox {
+inline namespace net {
+
+/// Accepts stream connections and creates a BasicFrameConn for each. The connections share a
+/// BufferPool for their output buffers.
+template <typename ConnT, typename AppT>
+class BasicFrameServ : public StreamAcceptor<BasicFrameServ<ConnT, AppT>> {
+
+    friend StreamAcceptor<BasicFrameServ<ConnT, AppT>>;
+
+    using Conn = ConnT;
+    using App = AppT;
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<false>;
+    using MemberHookOption
+        = boost::intrusive::member_hook<Conn, decltype(Conn::list_hook), &Conn::list_hook>;
+    using ConnList = boost::intrusive::list<Conn, ConstantTimeSizeOption, MemberHookOption>;
+
+    using typename StreamAcceptor<BasicFrameServ<ConnT, AppT>>::Endpoint;
+
+  public:
+    BasicFrameServ(CyclTime /*now*/, Reactor& r, const Endpoint& ep, App& app)
+    : StreamAcceptor<BasicFrameServ<ConnT, AppT>>{r, ep}
+    , reactor_{r}
+    , app_{app}
+    {
+    }
+    /// Adopts a listening socket that is already bound, typically one handed over by a previous
+    /// instance of the process.
+    BasicFrameServ(CyclTime /*now*/, Reactor& r, StreamSockServ&& sock, App& app)
+    : StreamAcceptor<BasicFrameServ<ConnT, AppT>>{r, std::move(sock)}
+    , reactor_{r}
+    , app_{app}
+    {
+    }
+    ~BasicFrameServ()
+    {
+        const auto now = CyclTime::current();
+        conn_list_.clear_and_dispose([now](auto* conn) { conn->dispose(now); });
+    }
+
+    // Copy.
+    BasicFrameServ(const BasicFrameServ&) = delete;
+    BasicFrameServ& operator=(const BasicFrameServ&) = delete;
+
+    // Move.
+    BasicFrameServ(BasicFrameServ&&) = delete;
+    BasicFrameServ& operator=(BasicFrameServ&&) = delete;
+
+    /// Adopts an established connection, typically one handed over by a previous instance of the
+    /// process. The connection should be handed over at a message boundary, because any data
+    /// buffered by the previous owner is lost.
+    void adopt(CyclTime now, IoSock&& sock, const Endpoint& ep)
+    {
+        on_sock_accept(now, std::move(sock), ep);
+    }
+
+    /// Returns the TCP_INFO sampler, or null if sampling has not been enabled.
+    const TcpInfoSampler* tcp_info() const noexcept { return tcp_info_.get(); }
+
+    /// Samples TCP_INFO for all current and future TCP connections on a low priority timer. The
+    /// sampler aggregates the samples into histograms for the server, and each connection's
+    /// tcp_probe holds its latest snapshot.
+    void enable_tcp_info(Duration interval)
+    {
+        tcp_info_ = std::make_unique<TcpInfoSampler>(reactor_, interval);
+        for (auto& conn : conn_list_) {
+            if (conn.endpoint().protocol().family() != AF_UNIX) {
+                tcp_info_->add(conn.tcp_probe);
+            }
+        }
+    }
+
+  private:
+    void on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
+    void on_sock_accept(CyclTime now, IoSock&& sock, const Endpoint& ep)
+    {
+        auto* const conn = new Conn{now, reactor_, std::move(sock), ep, pool_, app_};
+        conn_list_.push_back(*conn);
+        if (tcp_info_ && ep.protocol().family() != AF_UNIX) {
+            tcp_info_->add(conn->tcp_probe);
+        }
+    }
+
+    Reactor& reactor_;
+    App& app_;
+    BufferPool pool_;
+    // List of active connections.
+    ConnList conn_list_;
+    std::unique_ptr<TcpInfoSampler> tcp_info_;
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_FRAMESERV_HPP
@@ -19,6 +19,8 @@
 
 #include <toolbox/net/Socket.hpp>
 
+#include <toolbox/io/BufferChain.hpp>
+
 namespace toolbox {
 inline namespace net {
 
@@ -43,6 +45,32 @@ struct IoSock : Sock {
     }
     std::size_t read(MutableBuffer buf) { return os::read(get(), buf); }
 
+    ssize_t readv(const iovec* iov, int iovcnt, std::error_code& ec) noexcept
+    {
+        return os::readv(get(), iov, iovcnt, ec);
+    }
+    std::size_t readv(const iovec* iov, int iovcnt) { return os::readv(get(), iov, iovcnt); }
+
+    /// Scatter read of up to size bytes into the buffer chain. The bytes read are committed.
+    ssize_t readv(BufferChain& buf, std::size_t size, std::error_code& ec)
+    {
+        iovec iov[MaxBufferIov];
+        const auto n = buf.prepare(size, iov);
+        const auto ret = os::readv(get(), iov, n, ec);
+        if (ret > 0) {
+            buf.commit(ret);
+        }
+        return ret;
+    }
+    std::size_t readv(BufferChain& buf, std::size_t size)
+    {
+        iovec iov[MaxBufferIov];
+        const auto n = buf.prepare(size, iov);
+        const auto ret = os::readv(get(), iov, n);
+        buf.commit(ret);
+        return ret;
+    }
+
     ssize_t recv(void* buf, std::size_t len, int flags, std::error_code& ec) noexcept
     {
         return os::recv(get(), buf, len, flags, ec);
@@ -80,6 +108,32 @@ struct IoSock : Sock {
     }
     std::size_t write(ConstBuffer buf) { return os::write(get(), buf); }
 
+    ssize_t writev(const iovec* iov, int iovcnt, std::error_code& ec) noexcept
+    {
+        return os::writev(get(), iov, iovcnt, ec);
+    }
+    std::size_t writev(const iovec* iov, int iovcnt) { return os::writev(get(), iov, iovcnt); }
+
+    /// Gather write of the available data in the buffer chain. The bytes written are consumed.
+    ssize_t writev(BufferChain& buf, std::error_code& ec) noexcept
+    {
+        iovec iov[MaxBufferIov];
+        const auto n = buf.data(iov);
+        const auto ret = os::writev(get(), iov, n, ec);
+        if (ret > 0) {
+            buf.consume(ret);
+        }
+        return ret;
+    }
+    std::size_t writev(BufferChain& buf)
+    {
+        iovec iov[MaxBufferIov];
+        const auto n = buf.data(iov);
+        const auto ret = os::writev(get(), iov, n);
+        buf.consume(ret);
+        return ret;
+    }
+
     ssize_t send(const void* buf, std::size_t len, int flags, std::error_code& ec) noexcept
     {
         return os::send(get(), buf, len, flags, ec);
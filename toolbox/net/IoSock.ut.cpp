@@ -35,4 +35,23 @@ BOOST_AUTO_TEST_CASE(SocketPairCase)
     BOOST_CHECK_EQUAL(strcmp(buf, "foo"), 0);
 }
 
+BOOST_AUTO_TEST_CASE(BufferChainCase)
+{
+    auto socks = socketpair(UnixStreamProtocol{});
+    socks.first.set_snd_buf(1 << 18);
+    socks.second.set_rcv_buf(1 << 18);
+
+    BufferPool pool;
+    BufferChain out{pool}, in{pool};
+    const string data(2 * BufferSegmentSize + 10, 'x');
+    out.append(data.data(), data.size());
+
+    BOOST_CHECK_EQUAL(socks.first.writev(out), data.size());
+    BOOST_CHECK(out.empty());
+
+    BOOST_CHECK_EQUAL(socks.second.readv(in, 4 * BufferSegmentSize), data.size());
+    BOOST_CHECK_EQUAL(in.size(), data.size());
+    BOOST_CHECK_EQUAL(in.segments(), 4U);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,588 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Pcap.hpp"
+
+#include <toolbox/io/File.hpp>
+
+#include <cstring>
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+
+// Classic pcap magic numbers, for microsecond and nanosecond timestamps.
+constexpr uint32_t PcapMagicMicros{0xa1b2c3d4};
+constexpr uint32_t PcapMagicNanos{0xa1b23c4d};
+constexpr size_t PcapFileHeaderSize{24};
+constexpr size_t PcapRecordHeaderSize{16};
+
+// Pcap-ng block types.
+constexpr uint32_t SectionHeaderBlock{0x0a0d0d0a};
+constexpr uint32_t InterfaceDescriptionBlock{1};
+constexpr uint32_t EnhancedPacketBlock{6};
+constexpr uint32_t ByteOrderMagic{0x1a2b3c4d};
+constexpr uint16_t OptEndOfOpt{0};
+constexpr uint16_t OptIfTsResol{9};
+
+constexpr uint16_t EtherTypeIpv4{0x0800};
+constexpr uint16_t EtherTypeIpv6{0x86dd};
+constexpr uint16_t EtherTypeVlan{0x8100};
+constexpr uint16_t EtherTypeQinQ{0x88a8};
+
+constexpr size_t Ipv4HeaderSize{20};
+constexpr size_t Ipv6HeaderSize{40};
+constexpr size_t UdpHeaderSize{8};
+constexpr size_t MaxDatagram{65536};
+// Packets are buffered until the buffer exceeds this size.
+constexpr size_t FlushThreshold{1 << 16};
+
+template <typename T>
+inline T load(const char* p) noexcept
+{
+    T val;
+    memcpy(&val, p, sizeof(val));
+    return val;
+}
+
+inline uint16_t load_be16(const char* p) noexcept
+{
+    return ntohs(load<uint16_t>(p));
+}
+
+inline size_t pad4(size_t n) noexcept
+{
+    return (n + 3) & ~size_t{3};
+}
+
+// Ones' complement sum used by the IPv4 header and UDP checksums.
+uint32_t checksum_add(uint32_t sum, const void* data, size_t len) noexcept
+{
+    const auto* p = static_cast<const unsigned char*>(data);
+    for (; len > 1; p += 2, len -= 2) {
+        sum += (p[0] << 8) | p[1];
+    }
+    if (len > 0) {
+        sum += p[0] << 8;
+    }
+    return sum;
+}
+
+uint16_t checksum_fold(uint32_t sum) noexcept
+{
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return htons(~sum & 0xffff);
+}
+
+DgramEndpoint make_endpoint(const in_addr& addr, uint16_t port) noexcept
+{
+    sockaddr_in sin{};
+    sin.sin_family = AF_INET;
+    sin.sin_port = port;
+    sin.sin_addr = addr;
+    return {&sin, sizeof(sin), IPPROTO_UDP};
+}
+
+DgramEndpoint make_endpoint(const in6_addr& addr, uint16_t port) noexcept
+{
+    sockaddr_in6 sin6{};
+    sin6.sin6_family = AF_INET6;
+    sin6.sin6_port = port;
+    sin6.sin6_addr = addr;
+    return {&sin6, sizeof(sin6), IPPROTO_UDP};
+}
+
+bool decode_ip(const char* p, size_t len, PcapPacket& pkt) noexcept
+{
+    if (len < 1) {
+        return false;
+    }
+    const auto version = static_cast<unsigned char>(p[0]) >> 4;
+    if (version == 4) {
+        if (len < Ipv4HeaderSize) {
+            return false;
+        }
+        const size_t ihl = (p[0] & 0x0f) * 4;
+        // Skip fragments, because the datagram cannot be republished from a single fragment.
+        const auto frag = load_be16(p + 6);
+        if (ihl < Ipv4HeaderSize || len < ihl || p[9] != IPPROTO_UDP || (frag & 0x3fff) != 0) {
+            return false;
+        }
+        len = min<size_t>(len, load_be16(p + 2));
+        if (len < ihl + UdpHeaderSize) {
+            return false;
+        }
+        const auto* udp = p + ihl;
+        pkt.src = make_endpoint(load<in_addr>(p + 12), load<uint16_t>(udp));
+        pkt.dst = make_endpoint(load<in_addr>(p + 16), load<uint16_t>(udp + 2));
+        p = udp;
+        len -= ihl;
+    } else if (version == 6) {
+        if (len < Ipv6HeaderSize + UdpHeaderSize || p[6] != IPPROTO_UDP) {
+            return false;
+        }
+        len = min<size_t>(len, Ipv6HeaderSize + load_be16(p + 4));
+        // The payload length is zero for jumbograms, which are not supported.
+        if (len < Ipv6HeaderSize + UdpHeaderSize) {
+            return false;
+        }
+        const auto* udp = p + Ipv6HeaderSize;
+        pkt.src = make_endpoint(load<in6_addr>(p + 8), load<uint16_t>(udp));
+        pkt.dst = make_endpoint(load<in6_addr>(p + 24), load<uint16_t>(udp + 2));
+        p = udp;
+        len -= Ipv6HeaderSize;
+    } else {
+        return false;
+    }
+    const auto ulen = load_be16(p + 4);
+    if (ulen < UdpHeaderSize) {
+        return false;
+    }
+    // The payload may have been truncated by the capture's snap length.
+    pkt.data = {p + UdpHeaderSize, min<size_t>(ulen, len) - UdpHeaderSize};
+    return true;
+}
+
+bool decode_ether_type(uint16_t type, const char* p, size_t len, PcapPacket& pkt) noexcept
+{
+    if (type != EtherTypeIpv4 && type != EtherTypeIpv6) {
+        return false;
+    }
+    return decode_ip(p, len, pkt);
+}
+
+bool decode(uint16_t link_type, const char* p, size_t len, PcapPacket& pkt) noexcept
+{
+    switch (link_type) {
+    case LinkTypeEthernet: {
+        if (len < 14) {
+            return false;
+        }
+        auto type = load_be16(p + 12);
+        p += 14;
+        len -= 14;
+        while ((type == EtherTypeVlan || type == EtherTypeQinQ) && len >= 4) {
+            type = load_be16(p + 2);
+            p += 4;
+            len -= 4;
+        }
+        return decode_ether_type(type, p, len, pkt);
+    }
+    case LinkTypeLinuxSll:
+        if (len < 16) {
+            return false;
+        }
+        return decode_ether_type(load_be16(p + 14), p + 16, len - 16, pkt);
+    case LinkTypeRaw:
+    case LinkTypeIpv4:
+    case LinkTypeIpv6:
+        return decode_ip(p, len, pkt);
+    }
+    return false;
+}
+
+WallTime to_wall_time(uint64_t ts, int64_t ticks) noexcept
+{
+    const auto secs = static_cast<int64_t>(ts / ticks);
+    // The intermediate product overflows 64 bits for resolutions finer than a nanosecond.
+    const auto frac
+        = static_cast<int64_t>(static_cast<__int128>(ts % ticks) * 1'000'000'000 / ticks);
+    return WallTime{Duration{secs * 1'000'000'000 + frac}};
+}
+
+} // namespace
+
+PcapWriter::PcapWriter(const char* path)
+: PcapWriter{os::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)}
+{
+}
+
+PcapWriter::PcapWriter(FileHandle fh)
+: fh_{std::move(fh)}
+{
+    buf_.reserve(FlushThreshold + MaxDatagram + 128);
+
+    // Section Header Block, version 1.0, without options and with an unspecified section length.
+    const uint32_t shb_len{28};
+    const uint32_t shb_head[]{SectionHeaderBlock, shb_len, ByteOrderMagic};
+    const uint16_t version[]{1, 0};
+    const int64_t section_len{-1};
+    append(shb_head, sizeof(shb_head));
+    append(version, sizeof(version));
+    append(&section_len, sizeof(section_len));
+    append(&shb_len, sizeof(shb_len));
+
+    // Interface Description Block with nanosecond timestamp resolution.
+    const uint32_t idb_len{20 + 8 + 4};
+    const uint32_t idb_head[]{InterfaceDescriptionBlock, idb_len};
+    const uint16_t link[]{LinkTypeRaw, 0};
+    const uint32_t snap_len{0};
+    const uint16_t tsresol[]{OptIfTsResol, 1};
+    const unsigned char tsresol_val[4]{9, 0, 0, 0};
+    const uint16_t end_of_opt[]{OptEndOfOpt, 0};
+    append(idb_head, sizeof(idb_head));
+    append(link, sizeof(link));
+    append(&snap_len, sizeof(snap_len));
+    append(tsresol, sizeof(tsresol));
+    append(tsresol_val, sizeof(tsresol_val));
+    append(end_of_opt, sizeof(end_of_opt));
+    append(&idb_len, sizeof(idb_len));
+}
+
+PcapWriter::~PcapWriter()
+{
+    if (fh_) {
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+}
+
+PcapWriter::PcapWriter(PcapWriter&&) noexcept = default;
+
+PcapWriter& PcapWriter::operator=(PcapWriter&&) noexcept = default;
+
+void PcapWriter::write(WallTime time, const DgramEndpoint& src, const DgramEndpoint& dst,
+                       ConstBuffer data)
+{
+    const auto family = src.data()->sa_family;
+    if (family != dst.data()->sa_family || (family != AF_INET && family != AF_INET6)) {
+        throw invalid_argument{"pcap: unsupported address family"};
+    }
+    const auto n = min(buffer_size(data), MaxDatagram - Ipv6HeaderSize - UdpHeaderSize);
+    const size_t ip_len{family == AF_INET ? Ipv4HeaderSize : Ipv6HeaderSize};
+    const size_t cap_len{ip_len + UdpHeaderSize + n};
+
+    char hdr[Ipv6HeaderSize + UdpHeaderSize]{};
+    uint32_t sum{IPPROTO_UDP + static_cast<uint32_t>(UdpHeaderSize + n)};
+    if (family == AF_INET) {
+        const auto& s = reinterpret_cast<const sockaddr_in&>(*src.data());
+        const auto& d = reinterpret_cast<const sockaddr_in&>(*dst.data());
+        hdr[0] = 0x45;
+        const uint16_t tot_len{htons(static_cast<uint16_t>(cap_len))};
+        const uint16_t frag{htons(0x4000)};
+        memcpy(hdr + 2, &tot_len, 2);
+        memcpy(hdr + 6, &frag, 2);
+        hdr[8] = 64;
+        hdr[9] = IPPROTO_UDP;
+        memcpy(hdr + 12, &s.sin_addr, 4);
+        memcpy(hdr + 16, &d.sin_addr, 4);
+        const auto csum = checksum_fold(checksum_add(0, hdr, Ipv4HeaderSize));
+        memcpy(hdr + 10, &csum, 2);
+        sum = checksum_add(sum, hdr + 12, 8);
+        memcpy(hdr + ip_len, &s.sin_port, 2);
+        memcpy(hdr + ip_len + 2, &d.sin_port, 2);
+    } else {
+        const auto& s = reinterpret_cast<const sockaddr_in6&>(*src.data());
+        const auto& d = reinterpret_cast<const sockaddr_in6&>(*dst.data());
+        const uint32_t flow{htonl(0x60000000)};
+        const uint16_t payload_len{htons(static_cast<uint16_t>(UdpHeaderSize + n))};
+        memcpy(hdr, &flow, 4);
+        memcpy(hdr + 4, &payload_len, 2);
+        hdr[6] = IPPROTO_UDP;
+        hdr[7] = 64;
+        memcpy(hdr + 8, &s.sin6_addr, 16);
+        memcpy(hdr + 24, &d.sin6_addr, 16);
+        sum = checksum_add(sum, hdr + 8, 32);
+        memcpy(hdr + ip_len, &s.sin6_port, 2);
+        memcpy(hdr + ip_len + 2, &d.sin6_port, 2);
+    }
+    auto* const udp = hdr + ip_len;
+    const uint16_t udp_len{htons(static_cast<uint16_t>(UdpHeaderSize + n))};
+    memcpy(udp + 4, &udp_len, 2);
+    sum = checksum_add(sum, udp, UdpHeaderSize);
+    sum = checksum_add(sum, data.data(), n);
+    auto csum = checksum_fold(sum);
+    if (csum == 0) {
+        // Zero means that no checksum was computed.
+        csum = 0xffff;
+    }
+    memcpy(udp + 6, &csum, 2);
+
+    // Enhanced Packet Block.
+    const auto ns = static_cast<uint64_t>(time.time_since_epoch().count());
+    const auto block_len = static_cast<uint32_t>(32 + pad4(cap_len));
+    const uint32_t epb[]{EnhancedPacketBlock,
+                         block_len,
+                         0,
+                         static_cast<uint32_t>(ns >> 32),
+                         static_cast<uint32_t>(ns),
+                         static_cast<uint32_t>(cap_len),
+                         static_cast<uint32_t>(cap_len)};
+    append(epb, sizeof(epb));
+    append(hdr, ip_len + UdpHeaderSize);
+    append(data.data(), n);
+    const uint32_t pad{0};
+    append(&pad, pad4(cap_len) - cap_len);
+    append(&block_len, sizeof(block_len));
+    ++packets_;
+
+    if (buf_.size() >= FlushThreshold) {
+        flush();
+    }
+}
+
+void PcapWriter::flush()
+{
+    size_t off{0};
+    while (off < buf_.size()) {
+        off += os::write(fh_.get(), buf_.data() + off, buf_.size() - off);
+    }
+    buf_.clear();
+}
+
+void PcapWriter::append(const void* data, size_t len)
+{
+    const auto* p = static_cast<const char*>(data);
+    buf_.insert(buf_.end(), p, p + len);
+}
+
+PcapCapture::PcapCapture(Reactor& r, const Sock& sock, const DgramEndpoint& dst,
+                         PcapWriter& writer)
+: fd_{sock.get()}
+, dst_{dst}
+, writer_{writer}
+, buf_(MaxDatagram)
+{
+    set_so_timestampns(fd_, true);
+    sub_ = r.subscribe(fd_, EpollIn, bind<&PcapCapture::on_io_event>(this));
+}
+
+PcapCapture::~PcapCapture() = default;
+
+void PcapCapture::on_io_event(CyclTime now, int fd, unsigned /*events*/)
+{
+    sockaddr_storage addr;
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(timespec))];
+    // Limit the number of reads to avoid starvation. The subscription is level-triggered, so any
+    // remaining datagrams are read on the next cycle.
+    for (int i{0}; i < 4; ++i) {
+        iovec iov{buf_.data(), buf_.size()};
+        msghdr msg{};
+        msg.msg_name = &addr;
+        msg.msg_namelen = sizeof(addr);
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        error_code ec;
+        const auto n = os::recvmsg(fd, msg, MSG_DONTWAIT, ec);
+        if (ec) {
+            if (ec == errc::operation_would_block) {
+                break;
+            }
+            throw system_error{ec, "recvmsg"};
+        }
+        // Fall back to the cycle time if the kernel did not supply a timestamp.
+        WallTime time{now.wall_time()};
+        for (auto* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+                timespec ts;
+                memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                time = to_time<WallClock>(ts);
+            }
+        }
+        const DgramEndpoint src{&addr, msg.msg_namelen, IPPROTO_UDP};
+        writer_.write(time, src, dst_, {buf_.data(), static_cast<size_t>(n)});
+    }
+}
+
+PcapReader::PcapReader(const char* path)
+{
+    const auto fh = os::open(path, O_RDONLY | O_CLOEXEC);
+    const auto size = file_size(fh.get());
+    if (size < sizeof(uint32_t)) {
+        throw runtime_error{"pcap: truncated file"};
+    }
+    mem_ = os::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fh.get(), 0);
+    begin_ = static_cast<const char*>(mem_.get());
+    end_ = begin_ + size;
+
+    const auto magic = load<uint32_t>(begin_);
+    if (magic == SectionHeaderBlock) {
+        if (size < 12 || load<uint32_t>(begin_ + 8) != ByteOrderMagic) {
+            throw runtime_error{"pcap: unsupported byte order"};
+        }
+        ng_ = true;
+    } else if (magic == PcapMagicMicros || magic == PcapMagicNanos) {
+        if (size < PcapFileHeaderSize) {
+            throw runtime_error{"pcap: truncated file"};
+        }
+        const auto link_type = static_cast<uint16_t>(load<uint32_t>(begin_ + 20));
+        ifs_.push_back({link_type, magic == PcapMagicMicros ? 1'000'000 : 1'000'000'000});
+    } else {
+        throw runtime_error{"pcap: unsupported file format"};
+    }
+    rewind();
+}
+
+PcapReader::~PcapReader() = default;
+
+PcapReader::PcapReader(PcapReader&&) noexcept = default;
+
+PcapReader& PcapReader::operator=(PcapReader&&) noexcept = default;
+
+bool PcapReader::next(PcapPacket& pkt)
+{
+    return ng_ ? next_ng(pkt) : next_classic(pkt);
+}
+
+void PcapReader::rewind() noexcept
+{
+    if (ng_) {
+        // Interfaces are redefined by each section.
+        ifs_.clear();
+        pos_ = begin_;
+    } else {
+        pos_ = begin_ + PcapFileHeaderSize;
+    }
+}
+
+bool PcapReader::next_classic(PcapPacket& pkt)
+{
+    const auto& ifc = ifs_.front();
+    while (static_cast<size_t>(end_ - pos_) >= PcapRecordHeaderSize) {
+        const auto ts_sec = load<uint32_t>(pos_);
+        const auto ts_frac = load<uint32_t>(pos_ + 4);
+        const auto cap_len = load<uint32_t>(pos_ + 8);
+        const auto* data = pos_ + PcapRecordHeaderSize;
+        if (static_cast<size_t>(end_ - data) < cap_len) {
+            // Truncated by an interrupted capture.
+            break;
+        }
+        pos_ = data + cap_len;
+        if (decode(ifc.link_type, data, cap_len, pkt)) {
+            pkt.time = to_wall_time(uint64_t{ts_sec} * ifc.ticks + ts_frac, ifc.ticks);
+            return true;
+        }
+    }
+    pos_ = end_;
+    return false;
+}
+
+bool PcapReader::next_ng(PcapPacket& pkt)
+{
+    while (static_cast<size_t>(end_ - pos_) >= 12) {
+        const auto type = load<uint32_t>(pos_);
+        const auto len = load<uint32_t>(pos_ + 4);
+        if (len < 12 || len % 4 != 0 || static_cast<size_t>(end_ - pos_) < len) {
+            // Truncated by an interrupted capture.
+            break;
+        }
+        const auto* body = pos_ + 8;
+        const size_t body_len{len - 12};
+        pos_ += len;
+        switch (type) {
+        case SectionHeaderBlock:
+            if (body_len < 16 || load<uint32_t>(body) != ByteOrderMagic) {
+                throw runtime_error{"pcap: unsupported byte order"};
+            }
+            ifs_.clear();
+            break;
+        case InterfaceDescriptionBlock:
+            read_idb(body, body_len);
+            break;
+        case EnhancedPacketBlock: {
+            if (body_len < 20) {
+                break;
+            }
+            const auto if_id = load<uint32_t>(body);
+            const auto ts = (uint64_t{load<uint32_t>(body + 4)} << 32) | load<uint32_t>(body + 8);
+            const auto cap_len = min<size_t>(load<uint32_t>(body + 12), body_len - 20);
+            if (if_id >= ifs_.size()) {
+                break;
+            }
+            const auto& ifc = ifs_[if_id];
+            if (decode(ifc.link_type, body + 20, cap_len, pkt)) {
+                pkt.time = to_wall_time(ts, ifc.ticks);
+                return true;
+            }
+            break;
+        }
+        }
+    }
+    pos_ = end_;
+    return false;
+}
+
+void PcapReader::read_idb(const char* body, size_t len)
+{
+    if (len < 8) {
+        throw runtime_error{"pcap: invalid interface description block"};
+    }
+    Interface ifc{load<uint16_t>(body), 1'000'000};
+    // Options follow the fixed fields.
+    const auto* p = body + 8;
+    const auto* const end = body + len;
+    while (end - p >= 4) {
+        const auto code = load<uint16_t>(p);
+        const auto opt_len = load<uint16_t>(p + 2);
+        p += 4;
+        if (code == OptEndOfOpt || static_cast<size_t>(end - p) < opt_len) {
+            break;
+        }
+        if (code == OptIfTsResol && opt_len >= 1) {
+            const auto resol = static_cast<unsigned char>(*p);
+            const auto exp = resol & 0x7f;
+            // The most significant bit selects a power of two rather than a power of ten.
+            if (resol & 0x80) {
+                ifc.ticks = exp < 63 ? int64_t{1} << exp : 0;
+            } else {
+                ifc.ticks = 1;
+                for (int i{0}; i < exp && i < 18; ++i) {
+                    ifc.ticks *= 10;
+                }
+            }
+            if (ifc.ticks <= 0) {
+                throw runtime_error{"pcap: unsupported timestamp resolution"};
+            }
+        }
+        p += pad4(opt_len);
+    }
+    ifs_.push_back(ifc);
+}
+
+size_t pcap_replay(PcapReader& reader, const Sock& sock, double speed,
+                   const optional<DgramEndpoint>& dst)
+{
+    size_t n{0};
+    PcapPacket pkt;
+    MonoTime start{};
+    WallTime first{};
+    while (reader.next(pkt)) {
+        if (n == 0) {
+            start = MonoClock::now();
+            first = pkt.time;
+        } else if (speed > 0) {
+            const auto offset = duration_cast<Duration>(
+                chrono::duration<double, nano>((pkt.time - first).count() / speed));
+            // Sleeping would add tens of microseconds of scheduling jitter.
+            const auto due = start + offset;
+            while (MonoClock::now() < due) {
+            }
+        }
+        os::sendto(sock.get(), pkt.data, 0, dst ? *dst : pkt.dst);
+        ++n;
+    }
+    return n;
+}
+
+} // namespace net
+} // namespace toolbox
@@ -0,0 +1,170 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_PCAP_HPP
+#define TOOLBOX_NET_PCAP_HPP
+
+#include <toolbox/io/Mmap.hpp>
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/Socket.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace toolbox {
+inline namespace net {
+
+/// Link types that are understood by PcapReader.
+enum : std::uint16_t {
+    LinkTypeEthernet = 1,
+    LinkTypeRaw = 101,
+    LinkTypeLinuxSll = 113,
+    LinkTypeIpv4 = 228,
+    LinkTypeIpv6 = 229
+};
+
+/// Writes UDP datagrams to a pcap-ng file.
+///
+/// The socket API does not expose the network headers, so each datagram is written with synthetic
+/// IPv4 or IPv6 and UDP headers, using the LINKTYPE_RAW link type and nanosecond timestamps. The
+/// files can therefore be inspected with standard tools, and replayed by PcapReader.
+class TOOLBOX_API PcapWriter {
+  public:
+    /// Creates or truncates the file.
+    explicit PcapWriter(const char* path);
+    explicit PcapWriter(FileHandle fh);
+    /// Flushes buffered packets.
+    ~PcapWriter();
+
+    // Copy.
+    PcapWriter(const PcapWriter&) = delete;
+    PcapWriter& operator=(const PcapWriter&) = delete;
+
+    // Move.
+    PcapWriter(PcapWriter&&) noexcept;
+    PcapWriter& operator=(PcapWriter&&) noexcept;
+
+    /// Returns the number of packets written.
+    std::size_t packets() const noexcept { return packets_; }
+
+    /// Writes a datagram that was received at the given time. The source and destination endpoints
+    /// must belong to the same IP family.
+    void write(WallTime time, const DgramEndpoint& src, const DgramEndpoint& dst, ConstBuffer data);
+    /// Writes buffered packets to the file.
+    void flush();
+
+  private:
+    void append(const void* data, std::size_t len);
+
+    FileHandle fh_;
+    std::vector<char> buf_;
+    std::size_t packets_{0};
+};
+
+/// Records the datagrams received on a socket, with their kernel receive timestamps.
+///
+/// The capture subscribes to the socket in place of the application's handler, so it is typically
+/// used in a standalone process that joins the same multicast groups as the application.
+class TOOLBOX_API PcapCapture {
+  public:
+    /// The destination endpoint is recorded in each packet, and is typically the multicast group
+    /// and port that the socket has joined. SO_TIMESTAMPNS is enabled on the socket.
+    PcapCapture(Reactor& r, const Sock& sock, const DgramEndpoint& dst, PcapWriter& writer);
+    ~PcapCapture();
+
+    // Copy.
+    PcapCapture(const PcapCapture&) = delete;
+    PcapCapture& operator=(const PcapCapture&) = delete;
+
+    // Move.
+    PcapCapture(PcapCapture&&) = delete;
+    PcapCapture& operator=(PcapCapture&&) = delete;
+
+  private:
+    void on_io_event(CyclTime now, int fd, unsigned events);
+
+    int fd_;
+    DgramEndpoint dst_;
+    PcapWriter& writer_;
+    std::vector<char> buf_;
+    Reactor::Handle sub_;
+};
+
+/// A UDP datagram read from a capture file.
+struct PcapPacket {
+    WallTime time{};
+    DgramEndpoint src;
+    DgramEndpoint dst;
+    /// Points into the memory mapped file.
+    ConstBuffer data;
+};
+
+/// Reads UDP datagrams from a memory mapped pcap or pcap-ng file.
+///
+/// Both the classic pcap format, with microsecond or nanosecond timestamps, and the pcap-ng format
+/// are supported, in native byte order. Packets are decoded from Ethernet, Linux cooked, and raw IP
+/// link types, and packets that are not unfragmented UDP over IPv4 or IPv6 are skipped.
+class TOOLBOX_API PcapReader {
+  public:
+    explicit PcapReader(const char* path);
+    ~PcapReader();
+
+    // Copy.
+    PcapReader(const PcapReader&) = delete;
+    PcapReader& operator=(const PcapReader&) = delete;
+
+    // Move.
+    PcapReader(PcapReader&&) noexcept;
+    PcapReader& operator=(PcapReader&&) noexcept;
+
+    /// Reads the next UDP datagram, and returns false at the end of the file.
+    bool next(PcapPacket& pkt);
+    /// Returns to the first packet.
+    void rewind() noexcept;
+
+  private:
+    struct Interface {
+        std::uint16_t link_type;
+        /// Ticks per second.
+        std::int64_t ticks;
+    };
+
+    bool next_classic(PcapPacket& pkt);
+    bool next_ng(PcapPacket& pkt);
+    void read_idb(const char* body, std::size_t len);
+
+    MmapPtr mem_;
+    const char* begin_{nullptr};
+    const char* end_{nullptr};
+    const char* pos_{nullptr};
+    bool ng_{false};
+    std::vector<Interface> ifs_;
+};
+
+/// Republishes the datagrams in a capture file on a DgramSock or McastSock, with the original
+/// spacing between packets divided by the speed multiplier, or as fast as possible if the speed is
+/// zero. The pacing busy-waits on the monotonic clock, rather than sleeping, so that the spacing is
+/// accurate to within a microsecond or so, at the cost of a core.
+///
+/// The datagrams are sent to their original destination, unless a destination is specified, which
+/// is useful for redirecting a production feed to a loopback multicast group.
+TOOLBOX_API std::size_t pcap_replay(PcapReader& reader, const Sock& sock, double speed = 1.0,
+                                    const std::optional<DgramEndpoint>& dst = std::nullopt);
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_PCAP_HPP
@@ -0,0 +1,310 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "Pcap.hpp"
+
+#include <toolbox/net/DgramSock.hpp>
+#include <toolbox/net/Endian.hpp>
+#include <toolbox/net/McastSock.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct Fixture {
+    Fixture()
+    : fh{os::memfd_create("pcap", MFD_CLOEXEC)}
+    , path{"/proc/self/fd/" + to_string(fh.get())}
+    {
+    }
+    // Writes the raw bytes to the file.
+    void write(const string& data) const
+    {
+        os::ftruncate(fh.get(), 0);
+        ::lseek(fh.get(), 0, SEEK_SET);
+        os::write(fh.get(), data.data(), data.size());
+    }
+    FileHandle fh;
+    string path;
+};
+
+string payload(const PcapPacket& pkt)
+{
+    return {static_cast<const char*>(pkt.data.data()), pkt.data.size()};
+}
+
+WallTime wall_time(int64_t ns)
+{
+    return WallTime{Duration{ns}};
+}
+
+template <typename T>
+void append(string& s, T val)
+{
+    s.append(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PcapSuite)
+
+BOOST_FIXTURE_TEST_CASE(RoundTripCase, Fixture)
+{
+    const auto src4 = parse_dgram_endpoint("192.168.1.3:1234");
+    const auto dst4 = parse_dgram_endpoint("239.1.2.3:5678");
+    const auto src6 = parse_dgram_endpoint("[fe80::1]:1234");
+    const auto dst6 = parse_dgram_endpoint("[ff02::1]:5678");
+    {
+        PcapWriter w{path.c_str()};
+        w.write(wall_time(1'700'000'000'123'456'789), src4, dst4, {"foo", 3});
+        w.write(wall_time(1'700'000'000'123'457'000), src4, dst4, {"", 0});
+        w.write(wall_time(1'700'000'001'000'000'001), src6, dst6, {"hello", 5});
+        BOOST_CHECK_EQUAL(w.packets(), 3U);
+        BOOST_CHECK_THROW(w.write(wall_time(0), src4, dst6, {"x", 1}), invalid_argument);
+    }
+    PcapReader r{path.c_str()};
+    for (int i{0}; i < 2; ++i) {
+        PcapPacket pkt;
+        BOOST_CHECK(r.next(pkt));
+        BOOST_CHECK_EQUAL(pkt.time.time_since_epoch().count(), 1'700'000'000'123'456'789);
+        BOOST_CHECK_EQUAL(to_string(pkt.src), "udp4://192.168.1.3:1234");
+        BOOST_CHECK_EQUAL(to_string(pkt.dst), "udp4://239.1.2.3:5678");
+        BOOST_CHECK_EQUAL(payload(pkt), "foo");
+
+        BOOST_CHECK(r.next(pkt));
+        BOOST_CHECK_EQUAL(pkt.time.time_since_epoch().count(), 1'700'000'000'123'457'000);
+        BOOST_CHECK_EQUAL(payload(pkt), "");
+
+        BOOST_CHECK(r.next(pkt));
+        BOOST_CHECK_EQUAL(pkt.time.time_since_epoch().count(), 1'700'000'001'000'000'001);
+        BOOST_CHECK_EQUAL(to_string(pkt.src), "udp6://[fe80::1]:1234");
+        BOOST_CHECK_EQUAL(to_string(pkt.dst), "udp6://[ff02::1]:5678");
+        BOOST_CHECK_EQUAL(payload(pkt), "hello");
+
+        BOOST_CHECK(!r.next(pkt));
+        r.rewind();
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(ClassicCase, Fixture)
+{
+    // Microsecond pcap file with Ethernet link type.
+    string file;
+    append(file, uint32_t{0xa1b2c3d4});
+    append(file, uint16_t{2});
+    append(file, uint16_t{4});
+    append(file, int32_t{0});
+    append(file, uint32_t{0});
+    append(file, uint32_t{65535});
+    append(file, uint32_t{LinkTypeEthernet});
+
+    const auto add_packet = [&file](uint32_t usec, uint8_t proto, uint16_t frag) {
+        string pkt(12, '\0');
+        // VLAN tag followed by IPv4.
+        append(pkt, hton(uint16_t{0x8100}));
+        append(pkt, hton(uint16_t{42}));
+        append(pkt, hton(uint16_t{0x0800}));
+        const string data{"hello"};
+        pkt += char{0x45};
+        pkt += '\0';
+        append(pkt, hton(static_cast<uint16_t>(20 + 8 + data.size())));
+        append(pkt, uint16_t{0});
+        append(pkt, hton(frag));
+        pkt += char{64};
+        pkt += static_cast<char>(proto);
+        append(pkt, uint16_t{0});
+        pkt += "\x0a\x00\x00\x01"s;
+        pkt += "\xef\x00\x00\x01"s;
+        append(pkt, hton(uint16_t{1000}));
+        append(pkt, hton(uint16_t{2000}));
+        append(pkt, hton(static_cast<uint16_t>(8 + data.size())));
+        append(pkt, uint16_t{0});
+        pkt += data;
+        // Ethernet frames are padded to a minimum length.
+        pkt.resize(max<size_t>(pkt.size(), 60));
+
+        append(file, uint32_t{1'700'000'000});
+        append(file, usec);
+        append(file, static_cast<uint32_t>(pkt.size()));
+        append(file, static_cast<uint32_t>(pkt.size()));
+        file += pkt;
+    };
+    add_packet(1, IPPROTO_TCP, 0);
+    // A fragment.
+    add_packet(2, IPPROTO_UDP, 0x2000);
+    add_packet(3, IPPROTO_UDP, 0x4000);
+    write(file);
+
+    PcapReader r{path.c_str()};
+    PcapPacket pkt;
+    BOOST_CHECK(r.next(pkt));
+    BOOST_CHECK_EQUAL(pkt.time.time_since_epoch().count(), 1'700'000'000'000'003'000);
+    BOOST_CHECK_EQUAL(to_string(pkt.src), "udp4://10.0.0.1:1000");
+    BOOST_CHECK_EQUAL(to_string(pkt.dst), "udp4://239.0.0.1:2000");
+    BOOST_CHECK_EQUAL(payload(pkt), "hello");
+    BOOST_CHECK(!r.next(pkt));
+
+    write("junk"s);
+    BOOST_CHECK_THROW(PcapReader{path.c_str()}, runtime_error);
+}
+
+BOOST_FIXTURE_TEST_CASE(TruncatedIpv6Case, Fixture)
+{
+    // Microsecond pcap file with raw IP link type.
+    string file;
+    append(file, uint32_t{0xa1b2c3d4});
+    append(file, uint16_t{2});
+    append(file, uint16_t{4});
+    append(file, int32_t{0});
+    append(file, uint32_t{0});
+    append(file, uint32_t{65535});
+    append(file, uint32_t{LinkTypeRaw});
+
+    const auto add_packet = [&file](uint32_t usec, uint16_t payload_len) {
+        const string data{"hello"};
+        string pkt;
+        pkt += char{0x60};
+        pkt.append(3, '\0');
+        append(pkt, hton(payload_len));
+        pkt += static_cast<char>(IPPROTO_UDP);
+        pkt += char{64};
+        // Source and destination addresses.
+        pkt.append(15, '\0');
+        pkt += char{1};
+        pkt += "\xff\x02"s;
+        pkt.append(13, '\0');
+        pkt += char{1};
+        append(pkt, hton(uint16_t{1000}));
+        append(pkt, hton(uint16_t{2000}));
+        append(pkt, hton(static_cast<uint16_t>(8 + data.size())));
+        append(pkt, uint16_t{0});
+        pkt += data;
+
+        append(file, uint32_t{1'700'000'000});
+        append(file, usec);
+        append(file, static_cast<uint32_t>(pkt.size()));
+        append(file, static_cast<uint32_t>(pkt.size()));
+        file += pkt;
+    };
+    // A jumbogram, whose payload length is zero.
+    add_packet(1, 0);
+    // A payload length that is shorter than the UDP header.
+    add_packet(2, 4);
+    add_packet(3, 8 + 5);
+    write(file);
+
+    PcapReader r{path.c_str()};
+    PcapPacket pkt;
+    BOOST_CHECK(r.next(pkt));
+    BOOST_CHECK_EQUAL(pkt.time.time_since_epoch().count(), 1'700'000'000'000'003'000);
+    BOOST_CHECK_EQUAL(to_string(pkt.src), "udp6://[::1]:1000");
+    BOOST_CHECK_EQUAL(to_string(pkt.dst), "udp6://[ff02::1]:2000");
+    BOOST_CHECK_EQUAL(payload(pkt), "hello");
+    BOOST_CHECK(!r.next(pkt));
+}
+
+BOOST_FIXTURE_TEST_CASE(CaptureReplayCase, Fixture)
+{
+    Reactor r{1024};
+
+    DgramSock rx{DgramProtocol::udp4()};
+    rx.bind(parse_dgram_endpoint("127.0.0.1:0"));
+    DgramEndpoint rx_ep;
+    rx.get_sock_name(rx_ep);
+    // The name returned by the socket does not specify the protocol.
+    const DgramEndpoint udp_ep{rx_ep.data(), rx_ep.size(), IPPROTO_UDP};
+
+    const auto before = WallClock::now();
+    {
+        PcapWriter w{path.c_str()};
+        PcapCapture cap{r, rx, rx_ep, w};
+
+        DgramSock tx{DgramProtocol::udp4()};
+        for (const auto* msg : {"one", "two", "three"}) {
+            tx.sendto({msg, strlen(msg)}, 0, rx_ep);
+        }
+        for (int i{0}; i < 100 && w.packets() < 3; ++i) {
+            r.poll(CyclTime::now(), 10ms);
+        }
+        BOOST_CHECK_EQUAL(w.packets(), 3U);
+    }
+
+    PcapReader rd{path.c_str()};
+    PcapPacket pkt;
+    WallTime prev{before};
+    for (const auto* msg : {"one", "two", "three"}) {
+        BOOST_CHECK(rd.next(pkt));
+        BOOST_CHECK_EQUAL(payload(pkt), msg);
+        BOOST_CHECK_EQUAL(to_string(pkt.dst), to_string(udp_ep));
+        // Kernel receive timestamps.
+        BOOST_CHECK(pkt.time >= prev);
+        BOOST_CHECK(pkt.time <= WallClock::now());
+        prev = pkt.time;
+    }
+    BOOST_CHECK(!rd.next(pkt));
+
+    // Replay to a loopback multicast group.
+    const auto ifindex = os::if_nametoindex("lo");
+    const auto group = boost::asio::ip::make_address("239.255.0.3");
+    McastSock sub{UdpProtocol::v4()};
+    sub.set_reuse_addr(true);
+    sub.bind(UdpEndpoint{group, 0});
+    join_group(sub.get(), group, ifindex);
+    UdpEndpoint sub_ep;
+    sub.get_sock_name(sub_ep);
+
+    McastSock pub{UdpProtocol::v4()};
+    set_ip_mcast_if(pub.get(), AF_INET, ifindex);
+    set_ip_mcast_loop(pub.get(), AF_INET, true);
+
+    const UdpEndpoint group_ep{group, sub_ep.port()};
+    rd.rewind();
+    BOOST_CHECK_EQUAL(pcap_replay(rd, pub, 0, DgramEndpoint{group_ep.data(), group_ep.size(),
+                                                             IPPROTO_UDP}),
+                      3U);
+    for (const auto* msg : {"one", "two", "three"}) {
+        char buf[16];
+        UdpEndpoint ep;
+        const auto n = sub.recvfrom(buf, sizeof(buf), 0, ep);
+        BOOST_CHECK_EQUAL(string_view(buf, n), msg);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(PacingCase, Fixture)
+{
+    DgramSock rx{DgramProtocol::udp4()};
+    rx.bind(parse_dgram_endpoint("127.0.0.1:0"));
+    DgramEndpoint rx_ep;
+    rx.get_sock_name(rx_ep);
+    {
+        PcapWriter w{path.c_str()};
+        for (int i{0}; i < 5; ++i) {
+            w.write(wall_time(i * 2'000'000), rx_ep, rx_ep, {"x", 1});
+        }
+    }
+    PcapReader rd{path.c_str()};
+    DgramSock tx{DgramProtocol::udp4()};
+
+    // The packets span 8ms, so replay takes at least 4ms at twice the original rate.
+    auto start = MonoClock::now();
+    BOOST_CHECK_EQUAL(pcap_replay(rd, tx, 2.0), 5U);
+    BOOST_CHECK(MonoClock::now() - start >= 4ms);
+    BOOST_CHECK_EQUAL(rx.get_inq(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
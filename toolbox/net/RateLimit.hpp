@@ -21,6 +21,8 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include <algorithm>
+
 namespace toolbox {
 inline namespace net {
 
@@ -64,6 +66,75 @@ StreamT& operator<<(StreamT& os, RateLimit rl)
     return os;
 }
 
+/// Gcra implements the Generic Cell Rate Algorithm, which is equivalent to a token bucket that
+/// holds up to limit tokens, and that is refilled continuously at limit tokens per interval. The
+/// state of a bucket is a single nanosecond timestamp, the theoretical arrival time (TAT), which is
+/// owned by the caller, so that it may be held in a table or updated atomically.
+class TOOLBOX_API Gcra {
+  public:
+    Gcra(std::size_t limit, Duration interval) noexcept
+    : limit_{static_cast<std::int64_t>(limit)}
+    // Round the emission interval up, so that the sustained rate never exceeds the limit.
+    , emission_{(interval.count() + limit_ - 1) / limit_}
+    , tolerance_{emission_ * limit_}
+    {
+        assert(limit_ > 0 && emission_ > 0);
+    }
+    explicit Gcra(RateLimit rl) noexcept
+    : Gcra{rl.limit(), rl.interval()}
+    {
+    }
+    ~Gcra() = default;
+
+    // Copy.
+    Gcra(const Gcra&) noexcept = default;
+    Gcra& operator=(const Gcra&) noexcept = default;
+
+    // Move.
+    Gcra(Gcra&&) noexcept = default;
+    Gcra& operator=(Gcra&&) noexcept = default;
+
+    std::size_t limit() const noexcept { return limit_; }
+    /// Returns the time taken to refill a single token.
+    Duration emission_interval() const noexcept { return Duration{emission_}; }
+
+    /// Returns the number of tokens held at time t by the bucket with the specified TAT.
+    std::size_t available(std::int64_t t, std::int64_t tat) const noexcept
+    {
+        const auto used = std::max<std::int64_t>(tat - t, 0);
+        return std::max<std::int64_t>(tolerance_ - used, 0) / emission_;
+    }
+    /// Takes n tokens at time t from the bucket with the specified TAT, which is advanced, and
+    /// returns true, or returns false, leaving the TAT unchanged, if the bucket does not hold n
+    /// tokens.
+    bool try_acquire(std::int64_t t, std::int64_t& tat, std::size_t n) const noexcept
+    {
+        if (n > static_cast<std::size_t>(limit_)) {
+            return false;
+        }
+        const auto next = std::max(tat, t) + static_cast<std::int64_t>(n) * emission_;
+        if (next - t > tolerance_) {
+            return false;
+        }
+        tat = next;
+        return true;
+    }
+    /// Returns the time until the bucket with the specified TAT holds n tokens, which is zero if
+    /// it already does. The result is meaningless if n exceeds the limit.
+    Duration wait_time(std::int64_t t, std::int64_t tat, std::size_t n) const noexcept
+    {
+        const auto cost = static_cast<std::int64_t>(n) * emission_;
+        return Duration{std::max<std::int64_t>(tat + cost - tolerance_ - t, 0)};
+    }
+
+  private:
+    std::int64_t limit_;
+    /// Time to refill a single token in nanoseconds.
+    std::int64_t emission_;
+    /// Capacity of the bucket in nanoseconds of refill time.
+    std::int64_t tolerance_;
+};
+
 /// RateWindow maintains a sliding window of second time buckets for the specified interval.
 class TOOLBOX_API RateWindow {
   public:
@@ -32,6 +32,26 @@ BOOST_AUTO_TEST_CASE(RateLimitCase)
     BOOST_CHECK_EQUAL(rl.interval().count(), 50);
 }
 
+BOOST_AUTO_TEST_CASE(GcraCase)
+{
+    const Gcra gcra{3, 1s};
+    BOOST_CHECK_EQUAL(gcra.limit(), 3);
+    // Rounded up, so that the sustained rate never exceeds the limit.
+    BOOST_CHECK_EQUAL(gcra.emission_interval().count(), 333'333'334);
+
+    const std::int64_t t{1'000'000'000};
+    std::int64_t tat{0};
+    BOOST_CHECK_EQUAL(gcra.available(t, tat), 3);
+    BOOST_CHECK(!gcra.try_acquire(t, tat, 4));
+    BOOST_CHECK_EQUAL(tat, 0);
+    BOOST_CHECK(gcra.try_acquire(t, tat, 2));
+    BOOST_CHECK_EQUAL(tat, t + 666'666'668);
+    BOOST_CHECK_EQUAL(gcra.available(t, tat), 1);
+    BOOST_CHECK(!gcra.try_acquire(t, tat, 2));
+    BOOST_CHECK_EQUAL(gcra.wait_time(t, tat, 2).count(), 333'333'334);
+    BOOST_CHECK_EQUAL(gcra.wait_time(t, tat, 1).count(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(RateWindowCase)
 {
     const auto t = MonoClock::now();
@@ -0,0 +1,147 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_RATELIMITERTABLE_HPP
+#define TOOLBOX_NET_RATELIMITERTABLE_HPP
+
+#include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/RateLimit.hpp>
+#include <toolbox/util/RobinHood.hpp>
+
+namespace toolbox {
+inline namespace net {
+
+/// A table of token bucket rate limiters, one per key, for rate limiting large numbers of clients
+/// by address, API key or user ID.
+///
+/// Each bucket is represented by a single nanosecond timestamp, the theoretical arrival time (TAT)
+/// of the Generic Cell Rate Algorithm, which is equivalent to a token bucket that is refilled
+/// continuously at limit tokens per interval, and that holds at most limit tokens. The refill is
+/// computed lazily when a key is checked, so idle keys cost nothing but memory, and the state is
+/// held inline in a flat open addressing table, rather than in a separately allocated object per
+/// key.
+///
+/// A key whose bucket has refilled completely is indistinguishable from a key that has never been
+/// seen, so the expire() function, which removes such keys in bulk, does not change the outcome of
+/// subsequent checks. It is typically called from a low priority timer.
+template <typename KeyT, typename HashT = RobinHash<KeyT>,
+          typename KeyEqualT = std::equal_to<KeyT>>
+class BasicRateLimiterTable {
+    using Map = RobinFlatMap<KeyT, std::int64_t, HashT, KeyEqualT>;
+
+  public:
+    /// Allows up to limit tokens per interval, with bursts of up to limit tokens.
+    BasicRateLimiterTable(std::size_t limit, Duration interval)
+    : gcra_{limit, interval}
+    {
+    }
+    explicit BasicRateLimiterTable(RateLimit rl)
+    : gcra_{rl}
+    {
+    }
+    ~BasicRateLimiterTable() = default;
+
+    // Copy.
+    BasicRateLimiterTable(const BasicRateLimiterTable&) = delete;
+    BasicRateLimiterTable& operator=(const BasicRateLimiterTable&) = delete;
+
+    // Move.
+    BasicRateLimiterTable(BasicRateLimiterTable&&) noexcept = default;
+    BasicRateLimiterTable& operator=(BasicRateLimiterTable&&) noexcept = default;
+
+    bool empty() const noexcept { return map_.empty(); }
+    /// Returns the number of keys whose bucket is not known to be full.
+    std::size_t size() const noexcept { return map_.size(); }
+    std::size_t limit() const noexcept { return gcra_.limit(); }
+    /// Returns the time taken to refill a single token.
+    Duration emission_interval() const noexcept { return gcra_.emission_interval(); }
+
+    /// Reserves space for the specified number of keys.
+    void reserve(std::size_t n) { map_.reserve(n); }
+
+    /// Takes n tokens from the key's bucket and returns true, or returns false, without taking any
+    /// tokens, if the bucket does not hold n tokens.
+    bool try_acquire(MonoTime now, const KeyT& key, std::size_t n = 1)
+    {
+        if (n == 0) {
+            return true;
+        }
+        if (n > gcra_.limit()) {
+            return false;
+        }
+        const auto t = now.time_since_epoch().count();
+        // A new key's bucket is full, so the tokens are always granted.
+        const auto [it, inserted] = map_.try_emplace(key, t);
+        return gcra_.try_acquire(t, it->second, n);
+    }
+
+    /// Returns the number of tokens that are currently held by the key's bucket.
+    std::size_t available(MonoTime now, const KeyT& key) const noexcept
+    {
+        const auto it = map_.find(key);
+        if (it == map_.end()) {
+            return gcra_.limit();
+        }
+        return gcra_.available(now.time_since_epoch().count(), it->second);
+    }
+
+    /// Returns the time until the key's bucket holds n tokens, which is zero if it already does.
+    /// The result is meaningless if n exceeds the limit.
+    Duration wait_time(MonoTime now, const KeyT& key, std::size_t n = 1) const noexcept
+    {
+        const auto it = map_.find(key);
+        if (it == map_.end()) {
+            return Duration::zero();
+        }
+        return gcra_.wait_time(now.time_since_epoch().count(), it->second, n);
+    }
+
+    /// Forgets the key, so that its bucket is full.
+    void erase(const KeyT& key) { map_.erase(key); }
+    void clear() noexcept { map_.clear(); }
+
+    /// Removes all keys whose bucket has refilled completely, and returns the number removed.
+    std::size_t expire(MonoTime now)
+    {
+        const auto t = now.time_since_epoch().count();
+        const auto n = map_.size();
+        for (auto it = map_.begin(); it != map_.end();) {
+            if (it->second <= t) {
+                it = map_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return n - map_.size();
+    }
+
+  private:
+    Gcra gcra_;
+    Map map_;
+};
+
+/// A rate limiter table keyed by an integer identifier, such as a user ID, or an IPv4 address and
+/// port packed into 64 bits.
+using RateLimiterTable = BasicRateLimiterTable<std::uint64_t>;
+
+/// A rate limiter table keyed by the peer's address, as passed to on_sock_accept(). The port is
+/// ignored, so that all connections from the same host share a bucket.
+using EndpointRateLimiterTable
+    = BasicRateLimiterTable<StreamEndpoint, StreamEndpointAddrHash, StreamEndpointAddrEqual>;
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_RATELIMITERTABLE_HPP
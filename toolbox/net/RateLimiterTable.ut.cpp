@@ -0,0 +1,111 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RateLimiterTable.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(RateLimiterTableSuite)
+
+BOOST_AUTO_TEST_CASE(TryAcquireCase)
+{
+    const auto t = MonoClock::now();
+
+    RateLimiterTable rlt{RateLimit{3, 1s}};
+    BOOST_CHECK_EQUAL(rlt.limit(), 3);
+    BOOST_CHECK_EQUAL(rlt.emission_interval().count(), 333'333'334);
+    BOOST_CHECK_EQUAL(rlt.available(t, 1), 3);
+
+    // The burst is limited to the size of the bucket.
+    BOOST_CHECK(rlt.try_acquire(t, 1));
+    BOOST_CHECK(rlt.try_acquire(t, 1, 2));
+    BOOST_CHECK(!rlt.try_acquire(t, 1));
+    BOOST_CHECK_EQUAL(rlt.available(t, 1), 0);
+    BOOST_CHECK_EQUAL(rlt.wait_time(t, 1).count(), 333'333'334);
+
+    // Other keys are unaffected.
+    BOOST_CHECK(rlt.try_acquire(t, 2, 3));
+    BOOST_CHECK_EQUAL(rlt.size(), 2);
+
+    // A single token is refilled after the emission interval.
+    BOOST_CHECK(!rlt.try_acquire(t + 333ms, 1));
+    BOOST_CHECK(rlt.try_acquire(t + 334ms, 1));
+    BOOST_CHECK(!rlt.try_acquire(t + 334ms, 1));
+
+    // The bucket is full again after the interval.
+    BOOST_CHECK_EQUAL(rlt.available(t + 1334ms, 1), 3);
+    BOOST_CHECK_EQUAL(rlt.wait_time(t + 1334ms, 1, 3).count(), 0);
+
+    // Requests that can never be satisfied are rejected without creating a key.
+    BOOST_CHECK(!rlt.try_acquire(t, 3, 4));
+    BOOST_CHECK(rlt.try_acquire(t, 3, 0));
+    BOOST_CHECK_EQUAL(rlt.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(ExpireCase)
+{
+    const auto t = MonoClock::now();
+
+    RateLimiterTable rlt{10, 1s};
+    rlt.reserve(100);
+    for (uint64_t key{0}; key < 100; ++key) {
+        rlt.try_acquire(t, key, key % 10 + 1);
+    }
+    BOOST_CHECK_EQUAL(rlt.size(), 100);
+
+    // Keys with a single token outstanding have refilled.
+    BOOST_CHECK_EQUAL(rlt.expire(t + 100ms), 10);
+    BOOST_CHECK_EQUAL(rlt.size(), 90);
+    BOOST_CHECK_EQUAL(rlt.expire(t + 500ms), 40);
+    BOOST_CHECK_EQUAL(rlt.expire(t + 1s), 50);
+    BOOST_CHECK(rlt.empty());
+}
+
+BOOST_AUTO_TEST_CASE(StringKeyCase)
+{
+    const auto t = MonoClock::now();
+
+    BasicRateLimiterTable<string> rlt{1, 1s};
+    BOOST_CHECK(rlt.try_acquire(t, "foo"));
+    BOOST_CHECK(!rlt.try_acquire(t, "foo"));
+    BOOST_CHECK(rlt.try_acquire(t, "bar"));
+    rlt.erase("foo");
+    BOOST_CHECK(rlt.try_acquire(t, "foo"));
+}
+
+BOOST_AUTO_TEST_CASE(EndpointKeyCase)
+{
+    const auto t = MonoClock::now();
+
+    EndpointRateLimiterTable rlt{1, 1s};
+    const auto ep1 = parse_stream_endpoint("tcp4://192.168.1.1:8080");
+    const auto ep2 = parse_stream_endpoint("tcp6://[::1]:8080");
+    BOOST_CHECK(rlt.try_acquire(t, ep1));
+    BOOST_CHECK(!rlt.try_acquire(t, parse_stream_endpoint("tcp4://192.168.1.1:8080")));
+    BOOST_CHECK(rlt.try_acquire(t, ep2));
+    BOOST_CHECK(!rlt.try_acquire(t, ep2));
+    // Connections from the same host share a bucket, whatever their port.
+    BOOST_CHECK(!rlt.try_acquire(t, parse_stream_endpoint("tcp4://192.168.1.1:8081")));
+    BOOST_CHECK(!rlt.try_acquire(t, parse_stream_endpoint("tcp6://[::1]:8081")));
+    BOOST_CHECK(rlt.try_acquire(t, parse_stream_endpoint("tcp4://192.168.1.2:8080")));
+    BOOST_CHECK_EQUAL(rlt.size(), 3U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,98 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RxQueue.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+// Upper bound of the queue depth histogram, in bytes.
+constexpr int64_t MaxDepth{numeric_limits<int32_t>::max()};
+// Upper bound of the drop rate histogram, in datagrams per interval.
+constexpr int64_t MaxDropRate{numeric_limits<uint32_t>::max()};
+} // namespace
+
+optional<uint32_t> get_rxq_ovfl(const msghdr& msg) noexcept
+{
+    // CMSG_NXTHDR() does not modify the message header, but is not declared const.
+    auto& m = const_cast<msghdr&>(msg);
+    for (auto* cmsg = CMSG_FIRSTHDR(&m); cmsg; cmsg = CMSG_NXTHDR(&m, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL) {
+            uint32_t counter;
+            memcpy(&counter, CMSG_DATA(cmsg), sizeof(counter));
+            return counter;
+        }
+    }
+    return nullopt;
+}
+
+RxQueueStats::RxQueueStats(int fd, const RxDropCounter* drops)
+: fd{fd}
+, drops{drops}
+, last_drops{drops ? drops->total() : 0}
+, depth{1, MaxDepth, 2}
+, drop_rate{1, MaxDropRate, 2}
+{
+}
+
+RxQueueMonitor::RxQueueMonitor(Reactor& r, Duration interval, Slot slot)
+: slot_{slot}
+{
+    tmr_ = r.timer(MonoClock::now() + interval, interval, Priority::Low,
+                   bind<&RxQueueMonitor::on_timer>(this));
+}
+
+RxQueueMonitor::~RxQueueMonitor() = default;
+
+size_t RxQueueMonitor::add(int fd, const RxDropCounter* drops)
+{
+    stats_.emplace_back(fd, drops);
+    return stats_.size() - 1;
+}
+
+void RxQueueMonitor::sample(CyclTime now)
+{
+    for (auto& s : stats_) {
+        SkMemInfo meminfo{};
+        error_code ec;
+        get_so_meminfo(s.fd, meminfo, ec);
+        if (!ec) {
+            const auto depth = meminfo[SK_MEMINFO_RMEM_ALLOC];
+            s.rcv_buf = meminfo[SK_MEMINFO_RCVBUF];
+            s.max_depth = max(s.max_depth, depth);
+            s.depth.record_value(depth);
+        }
+        if (s.drops) {
+            const auto total = s.drops->total();
+            s.drop_rate.record_value(static_cast<int64_t>(total - s.last_drops));
+            s.last_drops = total;
+        }
+    }
+    if (slot_) {
+        slot_(now, *this);
+    }
+}
+
+void RxQueueMonitor::on_timer(CyclTime now, Timer& /*tmr*/)
+{
+    sample(now);
+}
+
+} // namespace net
+} // namespace toolbox
@@ -0,0 +1,141 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_RXQUEUE_HPP
+#define TOOLBOX_NET_RXQUEUE_HPP
+
+#include <toolbox/hdr/Histogram.hpp>
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/Socket.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace toolbox {
+inline namespace net {
+
+/// Size of the control buffer required to receive the SO_RXQ_OVFL control message.
+constexpr std::size_t RxqOvflSpace{CMSG_SPACE(sizeof(std::uint32_t))};
+
+/// Returns the drop counter from the SO_RXQ_OVFL control message, if present. The kernel only
+/// attaches the control message once the socket has dropped at least one datagram.
+TOOLBOX_API std::optional<std::uint32_t> get_rxq_ovfl(const msghdr& msg) noexcept;
+
+/// Tracks the number of datagrams dropped by a socket with SO_RXQ_OVFL enabled.
+///
+/// The kernel reports a cumulative 32-bit counter with each datagram, so the number of datagrams
+/// dropped between two reads is the difference between successive values.
+class TOOLBOX_API RxDropCounter {
+  public:
+    RxDropCounter() noexcept = default;
+    ~RxDropCounter() = default;
+
+    // Copy.
+    RxDropCounter(const RxDropCounter&) noexcept = default;
+    RxDropCounter& operator=(const RxDropCounter&) noexcept = default;
+
+    // Move.
+    RxDropCounter(RxDropCounter&&) noexcept = default;
+    RxDropCounter& operator=(RxDropCounter&&) noexcept = default;
+
+    /// Returns the total number of datagrams dropped.
+    std::uint64_t total() const noexcept { return total_; }
+
+    /// Updates the counter from the cumulative value reported by the kernel, and returns the number
+    /// of datagrams dropped since the previous update.
+    std::uint32_t update(std::uint32_t counter) noexcept
+    {
+        const auto delta = counter - last_;
+        last_ = counter;
+        total_ += delta;
+        return delta;
+    }
+    /// Updates the counter from the control messages returned by recvmsg(), and returns the number
+    /// of datagrams dropped since the previous update.
+    std::uint32_t update(const msghdr& msg) noexcept
+    {
+        const auto counter = get_rxq_ovfl(msg);
+        return counter ? update(*counter) : 0;
+    }
+
+  private:
+    std::uint32_t last_{0};
+    std::uint64_t total_{0};
+};
+
+/// Receive queue statistics for a single socket.
+struct TOOLBOX_API RxQueueStats {
+    explicit RxQueueStats(int fd, const RxDropCounter* drops);
+
+    int fd;
+    /// Optional drop counter that is maintained by the socket's reader.
+    const RxDropCounter* drops;
+    /// Receive buffer limit at the time of the last sample.
+    std::uint32_t rcv_buf{0};
+    /// Highest queue depth sampled.
+    std::uint32_t max_depth{0};
+    /// Drop count at the time of the last sample.
+    std::uint64_t last_drops{0};
+    /// Histogram of the receive queue depth in bytes, including per-packet overhead.
+    Histogram depth;
+    /// Histogram of the number of datagrams dropped in each sampling interval.
+    Histogram drop_rate;
+};
+
+/// Samples the receive queue of one or more sockets from a low priority Reactor timer.
+///
+/// The queue depth is taken from SO_MEMINFO, rather than SIOCINQ, because SIOCINQ only reports the
+/// size of the next datagram on datagram sockets. Comparing the depth histogram with the receive
+/// buffer limit shows how close the socket came to dropping, and a growing depth indicates that
+/// the handler is not keeping up with the feed.
+class TOOLBOX_API RxQueueMonitor {
+  public:
+    using Slot = BasicSlot<void(CyclTime, const RxQueueMonitor&)>;
+
+    /// The optional slot is called after each round of samples.
+    RxQueueMonitor(Reactor& r, Duration interval, Slot slot = Slot{});
+    ~RxQueueMonitor();
+
+    // Copy.
+    RxQueueMonitor(const RxQueueMonitor&) = delete;
+    RxQueueMonitor& operator=(const RxQueueMonitor&) = delete;
+
+    // Move.
+    RxQueueMonitor(RxQueueMonitor&&) = delete;
+    RxQueueMonitor& operator=(RxQueueMonitor&&) = delete;
+
+    /// Returns the number of sockets monitored.
+    std::size_t size() const noexcept { return stats_.size(); }
+    const RxQueueStats& operator[](std::size_t i) const noexcept { return stats_[i]; }
+
+    /// Adds a socket to the monitor and returns its index. The optional drop counter is read on
+    /// each sample, and must outlive the monitor.
+    std::size_t add(int fd, const RxDropCounter* drops = nullptr);
+
+    /// Samples all sockets immediately.
+    void sample(CyclTime now);
+
+  private:
+    void on_timer(CyclTime now, Timer& tmr);
+
+    std::vector<RxQueueStats> stats_;
+    Slot slot_;
+    Timer tmr_;
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_RXQUEUE_HPP
@@ -0,0 +1,101 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RxQueue.hpp"
+
+#include <toolbox/net/DgramSock.hpp>
+#include <toolbox/net/Endpoint.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(RxQueueSuite)
+
+BOOST_AUTO_TEST_CASE(RxDropCounterCase)
+{
+    RxDropCounter drops;
+    BOOST_CHECK_EQUAL(drops.update(5), 5U);
+    BOOST_CHECK_EQUAL(drops.update(7), 2U);
+    BOOST_CHECK_EQUAL(drops.update(7), 0U);
+    BOOST_CHECK_EQUAL(drops.total(), 7U);
+
+    // The kernel counter is 32 bits and wraps.
+    constexpr auto Max = numeric_limits<uint32_t>::max();
+    BOOST_CHECK_EQUAL(drops.update(Max), Max - 7);
+    BOOST_CHECK_EQUAL(drops.update(1), 2U);
+    BOOST_CHECK_EQUAL(drops.total(), uint64_t{Max} + 2);
+}
+
+BOOST_AUTO_TEST_CASE(RxQueueOverflowCase)
+{
+    Reactor r{1024};
+
+    DgramSock rx{DgramProtocol::udp4()};
+    rx.set_rcv_buf(4096);
+    rx.set_rxq_ovfl(true);
+    rx.bind(UdpEndpoint{boost::asio::ip::address_v4::loopback(), 0});
+    UdpEndpoint ep;
+    os::getsockname(rx.get(), ep);
+
+    RxDropCounter drops;
+    RxQueueMonitor mon{r, 1s};
+    BOOST_CHECK_EQUAL(mon.add(rx.get(), &drops), 0U);
+
+    mon.sample(CyclTime::now());
+    BOOST_CHECK_EQUAL(mon[0].depth.total_count(), 1);
+    BOOST_CHECK_EQUAL(mon[0].max_depth, 0U);
+    BOOST_CHECK_GE(mon[0].rcv_buf, 4096U);
+
+    // Overflow the receive buffer.
+    DgramSock tx{DgramProtocol::udp4()};
+    const string payload(1024, 'x');
+    for (int i{0}; i < 64; ++i) {
+        os::sendto(tx.get(), payload.data(), payload.size(), 0, ep);
+    }
+    BOOST_CHECK_EQUAL(rx.get_inq(), static_cast<int>(payload.size()));
+
+    mon.sample(CyclTime::now());
+    BOOST_CHECK_EQUAL(mon[0].depth.total_count(), 2);
+    BOOST_CHECK_GT(mon[0].max_depth, 0U);
+
+    // The drop counter is attached to each datagram as it is queued, so drain the datagrams that
+    // were queued before the drops, and then send another.
+    rx.set_non_block();
+    char buf[2048];
+    error_code ec;
+    while (rx.recv(buf, sizeof(buf), 0, ec) > 0) {
+    }
+    os::sendto(tx.get(), payload.data(), payload.size(), 0, ep);
+
+    alignas(cmsghdr) char cbuf[RxqOvflSpace];
+    iovec iov{buf, sizeof(buf)};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cbuf;
+    msg.msg_controllen = sizeof(cbuf);
+    BOOST_CHECK_EQUAL(rx.recvmsg(msg, 0), payload.size());
+    BOOST_CHECK(get_rxq_ovfl(msg));
+    BOOST_CHECK_GT(drops.update(msg), 0U);
+
+    mon.sample(CyclTime::now());
+    BOOST_CHECK_EQUAL(mon[0].depth.total_count(), 3);
+    BOOST_CHECK_EQUAL(mon[0].last_drops, drops.total());
+    BOOST_CHECK_EQUAL(mon[0].drop_rate.max(), static_cast<int64_t>(drops.total()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
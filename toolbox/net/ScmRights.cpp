@@ -0,0 +1,120 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ScmRights.hpp"
+
+#include <cstring>
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+
+// Control buffer large enough for the maximum number of descriptors, suitably aligned for cmsghdr.
+union ControlBuf {
+    char buf[CMSG_SPACE(sizeof(int) * MaxScmFds)];
+    cmsghdr align;
+};
+
+} // namespace
+
+ssize_t send_fds(int sockfd, ConstBuffer buf, span<const int> fds, error_code& ec) noexcept
+{
+    if (fds.size() > MaxScmFds) {
+        ec = make_error(EINVAL);
+        return -1;
+    }
+    iovec iov{const_cast<void*>(buf.data()), buffer_size(buf)};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    ControlBuf cbuf;
+    if (!fds.empty()) {
+        const auto len = sizeof(int) * fds.size();
+        msg.msg_control = cbuf.buf;
+        msg.msg_controllen = CMSG_SPACE(len);
+        auto* const cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(len);
+        memcpy(CMSG_DATA(cmsg), fds.data(), len);
+    }
+    return os::sendmsg(sockfd, msg, MSG_NOSIGNAL, ec);
+}
+
+ssize_t recv_fds(int sockfd, MutableBuffer buf, span<FileHandle> fds, error_code& ec) noexcept
+{
+    iovec iov{buf.data(), buffer_size(buf)};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    ControlBuf cbuf;
+    msg.msg_control = cbuf.buf;
+    msg.msg_controllen = sizeof(cbuf.buf);
+
+    const auto ret = os::recvmsg(sockfd, msg, MSG_CMSG_CLOEXEC, ec);
+    if (ret < 0) {
+        return ret;
+    }
+    size_t n{0};
+    for (auto* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) {
+            continue;
+        }
+        const auto count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        const auto* const data = CMSG_DATA(cmsg);
+        for (size_t i{0}; i < count; ++i) {
+            int fd;
+            memcpy(&fd, data + i * sizeof(int), sizeof(int));
+            if (n < fds.size()) {
+                fds[n++].reset(fd);
+            } else {
+                // Do not leak descriptors that the caller has no room for.
+                ::close(fd);
+                ec = make_error(EMSGSIZE);
+            }
+        }
+    }
+    if (msg.msg_flags & MSG_CTRUNC) {
+        // The kernel discarded descriptors that did not fit in the control buffer.
+        ec = make_error(EMSGSIZE);
+    }
+    return ret;
+}
+
+size_t send_fds(int sockfd, ConstBuffer buf, span<const int> fds)
+{
+    error_code ec;
+    const auto ret = send_fds(sockfd, buf, fds, ec);
+    if (ec) {
+        throw system_error{ec, "send_fds"};
+    }
+    return ret;
+}
+
+size_t recv_fds(int sockfd, MutableBuffer buf, span<FileHandle> fds)
+{
+    error_code ec;
+    const auto ret = recv_fds(sockfd, buf, fds, ec);
+    if (ec) {
+        throw system_error{ec, "recv_fds"};
+    }
+    return ret;
+}
+
+} // namespace net
+} // namespace toolbox
@@ -0,0 +1,54 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_SCMRIGHTS_HPP
+#define TOOLBOX_NET_SCMRIGHTS_HPP
+
+#include <toolbox/net/Socket.hpp>
+
+#include <span>
+
+namespace toolbox {
+inline namespace net {
+
+/// Maximum number of file descriptors that may be passed in a single message (SCM_MAX_FD).
+constexpr std::size_t MaxScmFds{253};
+
+/// Sends data together with a set of file descriptors over a Unix domain socket. At least one byte
+/// of data must be sent with the descriptors. The descriptors remain open in the sending process.
+TOOLBOX_API ssize_t send_fds(int sockfd, ConstBuffer buf, std::span<const int> fds,
+                             std::error_code& ec) noexcept;
+
+/// Sends data together with a set of file descriptors over a Unix domain socket. At least one byte
+/// of data must be sent with the descriptors. The descriptors remain open in the sending process.
+TOOLBOX_API std::size_t send_fds(int sockfd, ConstBuffer buf, std::span<const int> fds);
+
+/// Receives data and any file descriptors that were sent with it over a Unix domain socket.
+/// Received descriptors are assigned, in order, to the front of the fds array, and have the
+/// close-on-exec flag set. If more descriptors are received than the array can hold, then the
+/// excess descriptors are closed and the error is set to EMSGSIZE.
+TOOLBOX_API ssize_t recv_fds(int sockfd, MutableBuffer buf, std::span<FileHandle> fds,
+                             std::error_code& ec) noexcept;
+
+/// Receives data and any file descriptors that were sent with it over a Unix domain socket.
+/// Received descriptors are assigned, in order, to the front of the fds array, and have the
+/// close-on-exec flag set.
+/// \throw std::system_error with EMSGSIZE if more descriptors are received than the array can hold.
+TOOLBOX_API std::size_t recv_fds(int sockfd, MutableBuffer buf, std::span<FileHandle> fds);
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_SCMRIGHTS_HPP
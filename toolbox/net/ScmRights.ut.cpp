@@ -0,0 +1,115 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ScmRights.hpp"
+
+#include "IoSock.hpp"
+#include "Protocol.hpp"
+#include "StreamAcceptor.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct TestServ : StreamAcceptor<TestServ> {
+    TestServ(Reactor& r, StreamSockServ&& sock)
+    : StreamAcceptor{r, std::move(sock)}
+    {
+    }
+    void on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
+    void on_sock_accept(CyclTime /*now*/, IoSock&& /*sock*/, const Endpoint& /*ep*/) { ++accepts; }
+    int accepts{0};
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ScmRightsSuite)
+
+BOOST_AUTO_TEST_CASE(SendRecvFdsCase)
+{
+    auto socks = socketpair(UnixStreamProtocol{});
+    auto pipe = os::pipe2(O_CLOEXEC);
+
+    const int fds[]{pipe.second.get()};
+    BOOST_CHECK_EQUAL(send_fds(*socks.first, {"x", 1}, fds), 1U);
+
+    char buf[1];
+    FileHandle recvd[2];
+    BOOST_CHECK_EQUAL(recv_fds(*socks.second, {buf, sizeof(buf)}, recvd), 1U);
+    BOOST_CHECK_EQUAL(buf[0], 'x');
+    BOOST_CHECK(recvd[0]);
+    BOOST_CHECK(!recvd[1]);
+    BOOST_CHECK_NE(recvd[0].get(), pipe.second.get());
+
+    // The received descriptor refers to the same pipe.
+    os::write(recvd[0].get(), "foo", 3);
+    char data[3];
+    BOOST_CHECK_EQUAL(os::read(pipe.first.get(), data, sizeof(data)), 3U);
+    BOOST_CHECK_EQUAL(string_view(data, 3), "foo");
+}
+
+BOOST_AUTO_TEST_CASE(RecvFdsOverflowCase)
+{
+    auto socks = socketpair(UnixStreamProtocol{});
+    auto pipe = os::pipe2(O_CLOEXEC);
+
+    const int fds[]{pipe.first.get(), pipe.second.get()};
+    send_fds(*socks.first, {"x", 1}, fds);
+
+    char buf[1];
+    FileHandle recvd[1];
+    error_code ec;
+    BOOST_CHECK_EQUAL(recv_fds(*socks.second, {buf, sizeof(buf)}, recvd, ec), 1);
+    BOOST_CHECK(ec == errc::message_size);
+    BOOST_CHECK(recvd[0]);
+}
+
+BOOST_AUTO_TEST_CASE(ListenerHandoverCase)
+{
+    using namespace literals::chrono_literals;
+
+    // The listener that would be owned by the previous instance of the process.
+    StreamSockServ prev{StreamProtocol::tcp4()};
+    prev.bind(parse_stream_endpoint("tcp4://127.0.0.1:0"));
+    prev.listen(SOMAXCONN);
+    StreamEndpoint ep;
+    prev.get_sock_name(ep);
+
+    // A connection that is queued during the handover.
+    StreamSockClnt clnt{StreamProtocol::tcp4()};
+    clnt.connect(ep);
+
+    auto socks = socketpair(UnixStreamProtocol{});
+    const int fds[]{prev.get()};
+    send_fds(*socks.first, {"L", 1}, fds);
+    prev.close();
+
+    char buf[1];
+    FileHandle recvd[1];
+    recv_fds(*socks.second, {buf, sizeof(buf)}, recvd);
+    const auto family = get_so_domain(recvd[0].get());
+    BOOST_CHECK_EQUAL(family, AF_INET);
+
+    Reactor r{1024};
+    TestServ serv{r, StreamSockServ{std::move(recvd[0]), family}};
+    BOOST_CHECK(serv.local_endpoint() == ep);
+    BOOST_CHECK_EQUAL(r.poll(CyclTime::now(), 0ms), 1);
+    BOOST_CHECK_EQUAL(serv.accepts, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
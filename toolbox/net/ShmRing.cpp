@@ -0,0 +1,206 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ShmRing.hpp"
+
+#include <toolbox/io/File.hpp>
+
+#include <bit>
+#include <cstring>
+
+#include <unistd.h>
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+
+constexpr uint64_t Magic{0x474e4952'4d485354}; // "TSHMRING"
+
+size_t page_size() noexcept
+{
+    static const size_t size = sysconf(_SC_PAGESIZE);
+    return size;
+}
+
+} // namespace
+
+ShmRing::ShmRing(size_t capacity)
+: ShmRing{os::memfd_create("toolbox-shm-ring", MFD_CLOEXEC), capacity}
+{
+}
+
+ShmRing::ShmRing(FileHandle fh, size_t capacity)
+: fh_{std::move(fh)}
+{
+    // The capacity must be a multiple of the page size, so that the data region can be mirrored,
+    // and a power of two, so that positions can be masked.
+    capacity = bit_ceil(max(capacity, page_size()));
+    os::ftruncate(fh_.get(), page_size() + capacity);
+    map(capacity);
+
+    hdr_->capacity = capacity;
+    hdr_->wpos.store(0, memory_order_relaxed);
+    hdr_->rpos.store(0, memory_order_relaxed);
+    hdr_->waiting.store(0, memory_order_relaxed);
+    // Publish the initialised header.
+    hdr_->magic.store(Magic, memory_order_release);
+}
+
+ShmRing::ShmRing(FileHandle fh)
+: fh_{std::move(fh)}
+{
+    struct stat st;
+    os::fstat(fh_.get(), st);
+    const size_t size = st.st_size;
+    if (size <= page_size() || !has_single_bit(size - page_size())) {
+        throw invalid_argument{"invalid shared memory ring size"};
+    }
+    map(size - page_size());
+    if (hdr_->magic.load(memory_order_acquire) != Magic || hdr_->capacity != capacity_) {
+        throw invalid_argument{"invalid shared memory ring header"};
+    }
+}
+
+ShmRing::~ShmRing() = default;
+
+ShmRing::ShmRing(ShmRing&&) noexcept = default;
+
+ShmRing& ShmRing::operator=(ShmRing&&) noexcept = default;
+
+bool ShmRing::write(ConstBuffer msg)
+{
+    const size_t size{buffer_size(msg)};
+    if (size > max_message_size()) {
+        throw length_error{"message too large for ring"};
+    }
+    const auto total = size + sizeof(uint16_t);
+    const auto wpos = hdr_->wpos.load(memory_order_relaxed);
+    if (wpos + total - rpos_cache_ > capacity_) {
+        // Only refresh the consumer position when the cached value suggests that the ring is full.
+        rpos_cache_ = hdr_->rpos.load(memory_order_acquire);
+        if (wpos + total - rpos_cache_ > capacity_) {
+            return false;
+        }
+    }
+    char* const buf{data_ + (wpos & mask())};
+    put_length(buf, static_cast<uint16_t>(total), ByteOrder);
+    memcpy(buf + sizeof(uint16_t), msg.data(), size);
+    hdr_->wpos.store(wpos + total, memory_order_release);
+    return true;
+}
+
+bool ShmRing::write(ConstBuffer msg, EventFd& efd)
+{
+    if (!write(msg)) {
+        return false;
+    }
+    notify(efd);
+    return true;
+}
+
+void ShmRing::notify(EventFd& efd) noexcept
+{
+    // Pairs with the fence in arm(), so that either the consumer observes the new write position,
+    // or the producer observes the request for notification.
+    atomic_thread_fence(memory_order_seq_cst);
+    if (hdr_->waiting.load(memory_order_relaxed) != 0
+        && hdr_->waiting.exchange(0, memory_order_relaxed) != 0) {
+        // Best effort.
+        error_code ec;
+        efd.write(1, ec);
+    }
+}
+
+bool ShmRing::arm() noexcept
+{
+    hdr_->waiting.store(1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!empty()) {
+        hdr_->waiting.store(0, memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void ShmRing::map(size_t capacity)
+{
+    const auto hdr_size = page_size();
+    const auto fd = fh_.get();
+
+    // Reserve a contiguous region of address space for the header and both data mappings.
+    auto mem = os::mmap(nullptr, hdr_size + 2 * capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS,
+                        -1, 0);
+    auto* const base = static_cast<char*>(mem.get());
+
+    // The shared mappings replace the reserved pages and are unmapped along with the reservation,
+    // so ownership is released here.
+    const int prot{PROT_READ | PROT_WRITE}, flags{MAP_SHARED | MAP_FIXED};
+    os::mmap(base, hdr_size, prot, flags, fd, 0).release();
+    os::mmap(base + hdr_size, capacity, prot, flags, fd, hdr_size).release();
+    os::mmap(base + hdr_size + capacity, capacity, prot, flags, fd, hdr_size).release();
+
+    mem_ = std::move(mem);
+    hdr_ = reinterpret_cast<detail::ShmRingHeader*>(base);
+    data_ = base + hdr_size;
+    capacity_ = capacity;
+}
+
+ShmRingReader::ShmRingReader(Reactor& r, ShmRing& ring, Slot slot, EventFd* efd)
+: ring_{ring}
+, slot_{slot}
+, efd_{efd}
+{
+    if (efd) {
+        sub_ = r.subscribe(efd->fd(), EpollIn, bind<&ShmRingReader::on_notify>(this));
+        if (!ring.arm()) {
+            // Data is already available, so schedule an immediate dispatch.
+            efd->write(1);
+        }
+    } else {
+        hook_.slot = bind<&ShmRingReader::on_hook>(this);
+        r.add_hook(hook_);
+    }
+}
+
+ShmRingReader::~ShmRingReader() = default;
+
+void ShmRingReader::on_hook(CyclTime now)
+{
+    dispatch(now);
+}
+
+void ShmRingReader::on_notify(CyclTime now, int /*fd*/, unsigned /*events*/)
+{
+    // Reset the eventfd counter.
+    efd_->read();
+    // Limit the number of passes to avoid starvation.
+    for (int i{0}; i < 4; ++i) {
+        dispatch(now);
+        if (ring_.arm()) {
+            return;
+        }
+    }
+    // The producer is still active, so yield to other handlers and return on the next cycle.
+    efd_->write(1);
+}
+
+size_t ShmRingReader::dispatch(CyclTime now)
+{
+    return ring_.read([this, now](ConstBuffer msg) { slot_(now, msg); });
+}
+
+} // namespace net
+} // namespace toolbox
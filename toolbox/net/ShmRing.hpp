@@ -0,0 +1,201 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_SHMRING_HPP
+#define TOOLBOX_NET_SHMRING_HPP
+
+#include <toolbox/io/EventFd.hpp>
+#include <toolbox/io/Hook.hpp>
+#include <toolbox/io/Mmap.hpp>
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/Frame.hpp>
+#include <toolbox/sys/Limits.hpp>
+#include <toolbox/util/Finally.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+namespace toolbox {
+inline namespace net {
+namespace detail {
+
+/// Control block at the start of the shared memory object. The producer and consumer positions are
+/// free-running byte counts that are placed on separate cache lines to avoid false sharing.
+struct ShmRingHeader {
+    std::atomic<std::uint64_t> magic;
+    std::uint64_t capacity;
+    alignas(CacheLineSize) std::atomic<std::uint64_t> wpos;
+    alignas(CacheLineSize) std::atomic<std::uint64_t> rpos;
+    /// Non-zero while the consumer is waiting for an eventfd notification.
+    alignas(CacheLineSize) std::atomic<std::uint32_t> waiting;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+} // namespace detail
+
+/// A single-producer single-consumer message ring in shared memory.
+///
+/// Each message is stored as a frame with a 2 byte, big-endian length prefix, exactly as it would
+/// be written by BasicFrameConn, so readers receive the same ConstBuffer views that they would from
+/// a socket. The data region is mapped twice into adjacent virtual memory, so frames that wrap
+/// around the end of the ring remain contiguous.
+///
+/// The ring is backed by a file descriptor, which may either be an anonymous memfd that is shared
+/// with another process by fork() or SCM_RIGHTS, or a named object returned by os::shm_open().
+/// The producer and consumer each attach their own ShmRing instance to the descriptor.
+class TOOLBOX_API ShmRing {
+  public:
+    /// Byte order of the length prefix.
+    static constexpr auto ByteOrder = std::endian::big;
+
+    /// Creates a ring backed by an anonymous memfd.
+    explicit ShmRing(std::size_t capacity);
+    /// Initialises a new ring in the shared memory object, which is resized accordingly. The
+    /// capacity is rounded up to a power of two that is no smaller than the page size.
+    ShmRing(FileHandle fh, std::size_t capacity);
+    /// Attaches to a ring that has already been initialised.
+    explicit ShmRing(FileHandle fh);
+    ~ShmRing();
+
+    // Copy.
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    // Move.
+    ShmRing(ShmRing&&) noexcept;
+    ShmRing& operator=(ShmRing&&) noexcept;
+
+    /// Returns the file descriptor, which may be passed to another process.
+    int fd() const noexcept { return fh_.get(); }
+
+    /// Returns the size of the data region.
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /// Returns the largest message that can be written to the ring.
+    std::size_t max_message_size() const noexcept
+    {
+        return std::min<std::size_t>(capacity_, 0xffff) - sizeof(std::uint16_t);
+    }
+
+    /// Returns true if there is no data available to the consumer.
+    bool empty() const noexcept { return size() == 0; }
+
+    /// Returns the number of bytes available to the consumer.
+    std::size_t size() const noexcept
+    {
+        return hdr_->wpos.load(std::memory_order_acquire)
+            - hdr_->rpos.load(std::memory_order_acquire);
+    }
+
+    /// Producer: appends a message to the ring. Returns false if there is insufficient space.
+    /// \throw std::length_error if the message can never fit in the ring.
+    bool write(ConstBuffer msg);
+
+    /// Producer: appends a message to the ring, and signals the eventfd if the consumer is waiting.
+    bool write(ConstBuffer msg, EventFd& efd);
+
+    /// Producer: signals the eventfd if the consumer is waiting for a notification.
+    void notify(EventFd& efd) noexcept;
+
+    /// Consumer: calls the function object for each message that was available when the call was
+    /// made. Returns the number of bytes consumed.
+    /// \throw std::invalid_argument if the write position or a length prefix is corrupt, because
+    /// the shared memory is written by another process, whose frames cannot be trusted.
+    template <typename FnT>
+    std::size_t read(FnT fn)
+    {
+        const auto rpos = hdr_->rpos.load(std::memory_order_relaxed);
+        const auto avail = hdr_->wpos.load(std::memory_order_acquire) - rpos;
+        // The frames must lie within the mirrored data region.
+        if (avail > capacity_) {
+            throw std::invalid_argument{"invalid write position"};
+        }
+        const char* const buf{data_ + (rpos & mask())};
+        std::size_t n{0};
+        // Release the consumed space even if the function object throws.
+        const auto finally = make_finally([this, rpos, &n]() noexcept {
+            if (n > 0) {
+                hdr_->rpos.store(rpos + n, std::memory_order_release);
+            }
+        });
+        // The producer only publishes complete frames.
+        while (n < avail) {
+            const std::size_t total{get_length(buf + n, ByteOrder)};
+            if (total < sizeof(std::uint16_t) || total > avail - n) {
+                throw std::invalid_argument{"invalid frame length"};
+            }
+            // Each message is consumed before it is dispatched, so that it is not delivered a
+            // second time if the function object throws.
+            n += total;
+            fn(ConstBuffer{buf + n - total + sizeof(std::uint16_t), total - sizeof(std::uint16_t)});
+        }
+        return n;
+    }
+
+    /// Consumer: requests a notification from the producer before blocking on the eventfd.
+    /// Returns false, and withdraws the request, if data arrived in the meantime, in which case
+    /// the consumer must not block.
+    bool arm() noexcept;
+
+  private:
+    std::size_t mask() const noexcept { return capacity_ - 1; }
+    void map(std::size_t capacity);
+
+    FileHandle fh_;
+    MmapPtr mem_;
+    detail::ShmRingHeader* hdr_{nullptr};
+    char* data_{nullptr};
+    std::size_t capacity_{0};
+    /// Producer's cached copy of the consumer position.
+    std::uint64_t rpos_cache_{0};
+};
+
+/// Dispatches messages from a ShmRing on the consumer's Reactor.
+///
+/// If an EventFd is supplied, then the reader subscribes to it, and the Reactor is free to block
+/// while the ring is empty. Otherwise, the ring is polled from an end of cycle hook, which prevents
+/// the Reactor from blocking, and gives the lowest latency at the cost of a spinning thread.
+class TOOLBOX_API ShmRingReader {
+  public:
+    using Slot = BasicSlot<void(CyclTime, ConstBuffer)>;
+
+    ShmRingReader(Reactor& r, ShmRing& ring, Slot slot, EventFd* efd = nullptr);
+    ~ShmRingReader();
+
+    // Copy.
+    ShmRingReader(const ShmRingReader&) = delete;
+    ShmRingReader& operator=(const ShmRingReader&) = delete;
+
+    // Move.
+    ShmRingReader(ShmRingReader&&) = delete;
+    ShmRingReader& operator=(ShmRingReader&&) = delete;
+
+  private:
+    void on_hook(CyclTime now);
+    void on_notify(CyclTime now, int fd, unsigned events);
+    std::size_t dispatch(CyclTime now);
+
+    ShmRing& ring_;
+    Slot slot_;
+    EventFd* efd_;
+    Hook hook_;
+    Reactor::Handle sub_;
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_SHMRING_HPP
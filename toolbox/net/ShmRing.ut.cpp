@@ -0,0 +1,202 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ShmRing.hpp"
+
+#include <toolbox/net/Endian.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include <unistd.h>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+bool write(ShmRing& ring, string_view msg)
+{
+    return ring.write({msg.data(), msg.size()});
+}
+
+vector<string> read(ShmRing& ring)
+{
+    vector<string> msgs;
+    ring.read([&msgs](ConstBuffer msg) {
+        msgs.emplace_back(static_cast<const char*>(msg.data()), buffer_size(msg));
+    });
+    return msgs;
+}
+
+struct TestHandler {
+    void on_msg(CyclTime /*now*/, ConstBuffer msg)
+    {
+        msgs.emplace_back(static_cast<const char*>(msg.data()), buffer_size(msg));
+    }
+    vector<string> msgs;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(ShmRingSuite)
+
+BOOST_AUTO_TEST_CASE(ShmRingWriteReadCase)
+{
+    ShmRing ring{1};
+    const auto cap = ring.capacity();
+    BOOST_CHECK_EQUAL(cap, static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+    BOOST_CHECK(ring.empty());
+
+    BOOST_CHECK(write(ring, "foo"));
+    BOOST_CHECK(write(ring, "barbaz"));
+    BOOST_CHECK_EQUAL(ring.size(), 2 + 3 + 2 + 6U);
+
+    auto msgs = read(ring);
+    BOOST_CHECK_EQUAL(msgs.size(), 2U);
+    BOOST_CHECK_EQUAL(msgs[0], "foo");
+    BOOST_CHECK_EQUAL(msgs[1], "barbaz");
+    BOOST_CHECK(ring.empty());
+
+    // Fill the ring. The last message wraps around the end of the ring, but is read contiguously.
+    const string msg(cap / 4 - 2, 'x');
+    for (int i{0}; i < 4; ++i) {
+        BOOST_CHECK(write(ring, msg));
+    }
+    BOOST_CHECK(!write(ring, ""));
+    msgs = read(ring);
+    BOOST_CHECK_EQUAL(msgs.size(), 4U);
+    BOOST_CHECK(msgs[3] == msg);
+    BOOST_CHECK(write(ring, ""));
+
+    BOOST_CHECK_THROW(write(ring, string(cap, 'x')), length_error);
+}
+
+BOOST_AUTO_TEST_CASE(ShmRingCorruptCase)
+{
+    ShmRing ring{4096};
+    BOOST_CHECK(write(ring, "foo"));
+    // The data region follows the header page.
+    const auto corrupt = [&ring](uint16_t len) {
+        const auto be = hton(len);
+        BOOST_CHECK_EQUAL(::pwrite(ring.fd(), &be, sizeof(be), sysconf(_SC_PAGESIZE)),
+                          static_cast<ssize_t>(sizeof(be)));
+    };
+    // A length that does not include the prefix.
+    corrupt(0);
+    BOOST_CHECK_THROW(read(ring), invalid_argument);
+    // A length that extends past the data written by the producer.
+    corrupt(6);
+    BOOST_CHECK_THROW(read(ring), invalid_argument);
+    // Nothing was consumed.
+    BOOST_CHECK_EQUAL(ring.size(), 2 + 3U);
+    corrupt(5);
+    const auto msgs = read(ring);
+    BOOST_CHECK_EQUAL(msgs.size(), 1U);
+    BOOST_CHECK_EQUAL(msgs[0], "foo");
+}
+
+BOOST_AUTO_TEST_CASE(ShmRingCorruptPosCase)
+{
+    ShmRing ring{4096};
+    BOOST_CHECK(write(ring, "foo"));
+    const auto corrupt = [&ring](uint64_t wpos) {
+        const auto off = offsetof(net::detail::ShmRingHeader, wpos);
+        BOOST_CHECK_EQUAL(::pwrite(ring.fd(), &wpos, sizeof(wpos), off),
+                          static_cast<ssize_t>(sizeof(wpos)));
+    };
+    // A write position beyond the capacity of the ring.
+    corrupt(2 * ring.capacity());
+    BOOST_CHECK_THROW(read(ring), invalid_argument);
+    // Nothing was consumed.
+    corrupt(2 + 3);
+    BOOST_CHECK_EQUAL(read(ring).size(), 1U);
+    // A write position behind the read position.
+    corrupt(0);
+    BOOST_CHECK_THROW(read(ring), invalid_argument);
+    corrupt(2 + 3);
+    BOOST_CHECK(read(ring).empty());
+}
+
+BOOST_AUTO_TEST_CASE(ShmRingAttachCase)
+{
+    ShmRing producer{8192};
+    ShmRing consumer{FileHandle{dup(producer.fd())}};
+    BOOST_CHECK_EQUAL(consumer.capacity(), producer.capacity());
+
+    BOOST_CHECK(write(producer, "foo"));
+    const auto msgs = read(consumer);
+    BOOST_CHECK_EQUAL(msgs.size(), 1U);
+    BOOST_CHECK_EQUAL(msgs[0], "foo");
+    BOOST_CHECK(producer.empty());
+
+    // A descriptor that does not refer to an initialised ring is rejected.
+    BOOST_CHECK_THROW(ShmRing{os::memfd_create("test", MFD_CLOEXEC)}, invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(ShmRingNamedCase)
+{
+    const auto name = "/toolbox-shm-ring-test." + to_string(getpid());
+    ShmRing producer{os::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600), 4096};
+    ShmRing consumer{os::shm_open(name.c_str(), O_RDWR, 0)};
+    os::shm_unlink(name.c_str());
+
+    BOOST_CHECK(write(producer, "foo"));
+    BOOST_CHECK_EQUAL(read(consumer)[0], "foo");
+}
+
+BOOST_AUTO_TEST_CASE(ShmRingReaderCase)
+{
+    using namespace literals::chrono_literals;
+
+    Reactor r{1024};
+    ShmRing ring{4096};
+    EventFd efd{0, EFD_NONBLOCK};
+    TestHandler h;
+    ShmRingReader reader{r, ring, bind<&TestHandler::on_msg>(&h), &efd};
+
+    const auto now = CyclTime::now();
+    BOOST_CHECK_EQUAL(r.poll(now, 0ms), 0);
+
+    BOOST_CHECK(ring.write({"foo", 3}, efd));
+    BOOST_CHECK(ring.write({"bar", 3}, efd));
+    BOOST_CHECK_EQUAL(r.poll(now, 0ms), 1);
+    BOOST_CHECK_EQUAL(h.msgs.size(), 2U);
+    BOOST_CHECK_EQUAL(h.msgs[1], "bar");
+
+    // The consumer is waiting again, so the next write is also signalled.
+    BOOST_CHECK(ring.write({"baz", 3}, efd));
+    BOOST_CHECK_EQUAL(r.poll(now, 0ms), 1);
+    BOOST_CHECK_EQUAL(h.msgs.size(), 3U);
+    BOOST_CHECK_EQUAL(r.poll(now, 0ms), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ShmRingReaderSpinCase)
+{
+    using namespace literals::chrono_literals;
+
+    Reactor r{1024};
+    ShmRing ring{4096};
+    TestHandler h;
+    ShmRingReader reader{r, ring, bind<&TestHandler::on_msg>(&h)};
+
+    BOOST_CHECK(write(ring, "foo"));
+    r.poll(CyclTime::now(), 0ms);
+    BOOST_CHECK_EQUAL(h.msgs.size(), 1U);
+    BOOST_CHECK_EQUAL(h.msgs[0], "foo");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -32,26 +32,32 @@ void free_unix_addrinfo(addrinfo* ai)
     }
 }
 } // namespace
-AddrInfoPtr get_unix_addrinfo(string_view path, int type)
+socklen_t make_unix_addr(string_view path, sockaddr_un& sun)
 {
-    auto sun = make_unique<sockaddr_un>();
-    sun->sun_family = AF_UNIX;
-    const socklen_t path_len = pstrcpy<'\0'>(sun->sun_path, path);
+    sun.sun_family = AF_UNIX;
+    const socklen_t path_len = pstrcpy<'\0'>(sun.sun_path, path);
     // Check that path has not exceeded max length.
-    if (path_len == sizeof(sun->sun_path)) {
+    if (path_len == sizeof(sun.sun_path)) {
         throw invalid_argument{"invalid unix domain address"};
     }
     // '|' signifies an abstract unix socket
-    bool abstract = (*sun->sun_path == '|');
+    bool abstract = (*sun.sun_path == '|');
     if (abstract) {
-        sun->sun_path[0] = '\0';
+        sun.sun_path[0] = '\0';
     }
+    // Size includes null terminator, unless it's abstract. See unix(7).
+    return offsetof(sockaddr_un, sun_path) + path_len + (!abstract);
+}
+
+AddrInfoPtr get_unix_addrinfo(string_view path, int type)
+{
+    auto sun = make_unique<sockaddr_un>();
+    const auto len = make_unix_addr(path, *sun);
 
     AddrInfoPtr ai{new addrinfo{}, free_unix_addrinfo};
     ai->ai_family = AF_UNIX;
     ai->ai_socktype = type;
-    // Size includes null terminator, unless it's abstract. See unix(7).
-    ai->ai_addrlen = offsetof(sockaddr_un, sun_path) + path_len + (!abstract);
+    ai->ai_addrlen = len;
     ai->ai_addr = reinterpret_cast<sockaddr*>(sun.release());
     return ai;
 }
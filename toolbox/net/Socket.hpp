@@ -21,10 +21,15 @@
 
 #include <toolbox/io/File.hpp>
 
+#include <array>
+
 #include <net/if.h>
 #include <netdb.h>
 #include <netinet/tcp.h>
+#include <sys/un.h>
 #include <linux/net_tstamp.h>
+#include <linux/sock_diag.h>
+#include <linux/sockios.h>
 
 namespace toolbox {
 inline namespace net {
@@ -519,6 +524,26 @@ inline std::size_t send(int sockfd, ConstBuffer buf, int flags)
     return send(sockfd, static_cast<const void*>(buf.data()), buffer_size(buf), flags);
 }
 
+/// Send a message on a socket.
+inline ssize_t sendmsg(int sockfd, const msghdr& msg, int flags, std::error_code& ec) noexcept
+{
+    const auto ret = ::sendmsg(sockfd, &msg, flags);
+    if (ret < 0) {
+        ec = make_error(errno);
+    }
+    return ret;
+}
+
+/// Send a message on a socket.
+inline std::size_t sendmsg(int sockfd, const msghdr& msg, int flags)
+{
+    const auto ret = ::sendmsg(sockfd, &msg, flags);
+    if (ret < 0) {
+        throw std::system_error{make_error(errno), "sendmsg"};
+    }
+    return ret;
+}
+
 /// Send a message on a socket.
 inline ssize_t sendto(int sockfd, const void* buf, std::size_t len, int flags, const sockaddr& addr,
                       socklen_t addrlen, std::error_code& ec) noexcept
@@ -652,6 +677,9 @@ inline void setsockopt(int sockfd, int level, int optname, const void* optval, s
 } // namespace os
 inline namespace net {
 
+/// Populate a Unix domain address and return its length. A leading '|' denotes an abstract socket.
+TOOLBOX_API socklen_t make_unix_addr(std::string_view path, sockaddr_un& sun);
+
 /// Create an addrinfo structure for a Unix domain address.
 TOOLBOX_API AddrInfoPtr get_unix_addrinfo(std::string_view path, int type);
 
@@ -683,6 +711,43 @@ inline std::error_code get_so_error(int sockfd)
     return make_error(optval);
 }
 
+inline int get_so_domain(int sockfd, std::error_code& ec) noexcept
+{
+    int optval{};
+    socklen_t optlen{sizeof(optval)};
+    os::getsockopt(sockfd, SOL_SOCKET, SO_DOMAIN, &optval, optlen, ec);
+    return optval;
+}
+
+inline int get_so_domain(int sockfd)
+{
+    int optval{};
+    socklen_t optlen{sizeof(optval)};
+    os::getsockopt(sockfd, SOL_SOCKET, SO_DOMAIN, &optval, optlen);
+    return optval;
+}
+
+/// Socket memory usage, indexed by the SK_MEMINFO_* constants.
+using SkMemInfo = std::array<std::uint32_t, SK_MEMINFO_VARS>;
+
+/// Get socket memory usage. The SK_MEMINFO_RMEM_ALLOC entry is the number of bytes, including
+/// per-packet overhead, that are currently held in the receive queue, and the SK_MEMINFO_RCVBUF
+/// entry is the limit imposed by SO_RCVBUF.
+inline void get_so_meminfo(int sockfd, SkMemInfo& meminfo, std::error_code& ec) noexcept
+{
+    socklen_t optlen{sizeof(meminfo)};
+    os::getsockopt(sockfd, SOL_SOCKET, SO_MEMINFO, meminfo.data(), optlen, ec);
+}
+
+/// Get socket memory usage. The SK_MEMINFO_RMEM_ALLOC entry is the number of bytes, including
+/// per-packet overhead, that are currently held in the receive queue, and the SK_MEMINFO_RCVBUF
+/// entry is the limit imposed by SO_RCVBUF.
+inline void get_so_meminfo(int sockfd, SkMemInfo& meminfo)
+{
+    socklen_t optlen{sizeof(meminfo)};
+    os::getsockopt(sockfd, SOL_SOCKET, SO_MEMINFO, meminfo.data(), optlen);
+}
+
 inline int get_so_rcv_buf(int sockfd, std::error_code& ec) noexcept
 {
     int optval{};
@@ -731,6 +796,24 @@ inline bool is_tcp_no_delay(int sockfd)
     return optval != 0;
 }
 
+/// Get the number of unread bytes in the receive queue. For datagram sockets, this is the size of
+/// the next pending datagram, rather than the total size of the queue.
+inline int get_sock_inq(int sockfd, std::error_code& ec) noexcept
+{
+    int value{};
+    os::ioctl(sockfd, SIOCINQ, &value, ec);
+    return value;
+}
+
+/// Get the number of unread bytes in the receive queue. For datagram sockets, this is the size of
+/// the next pending datagram, rather than the total size of the queue.
+inline int get_sock_inq(int sockfd)
+{
+    int value{};
+    os::ioctl(sockfd, SIOCINQ, &value);
+    return value;
+}
+
 inline void set_so_rcv_buf(int sockfd, int size, std::error_code& ec) noexcept
 {
     os::setsockopt(sockfd, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size), ec);
@@ -753,6 +836,22 @@ inline void set_so_reuse_addr(int sockfd, bool enabled)
     os::setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(optval));
 }
 
+/// Enable or disable the SO_RXQ_OVFL control message, which carries the number of datagrams that
+/// were dropped by the socket since it was created.
+inline void set_so_rxq_ovfl(int sockfd, bool enabled, std::error_code& ec) noexcept
+{
+    int optval{enabled ? 1 : 0};
+    os::setsockopt(sockfd, SOL_SOCKET, SO_RXQ_OVFL, &optval, sizeof(optval), ec);
+}
+
+/// Enable or disable the SO_RXQ_OVFL control message, which carries the number of datagrams that
+/// were dropped by the socket since it was created.
+inline void set_so_rxq_ovfl(int sockfd, bool enabled)
+{
+    int optval{enabled ? 1 : 0};
+    os::setsockopt(sockfd, SOL_SOCKET, SO_RXQ_OVFL, &optval, sizeof(optval));
+}
+
 inline void set_so_snd_buf(int sockfd, int size, std::error_code& ec) noexcept
 {
     os::setsockopt(sockfd, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size), ec);
@@ -817,6 +916,54 @@ inline void set_tcp_syn_nt(int sockfd, int retrans)
     os::setsockopt(sockfd, IPPROTO_TCP, TCP_SYNCNT, &retrans, sizeof(retrans));
 }
 
+inline void set_tcp_fast_open(int sockfd, int qlen, std::error_code& ec) noexcept
+{
+    os::setsockopt(sockfd, IPPROTO_TCP, TCP_FASTOPEN, &qlen, sizeof(qlen), ec);
+}
+
+/// Enable TCP Fast Open on a listening socket.
+///
+/// \param sockfd The socket descriptor.
+/// \param qlen The maximum number of pending Fast Open requests.
+inline void set_tcp_fast_open(int sockfd, int qlen)
+{
+    os::setsockopt(sockfd, IPPROTO_TCP, TCP_FASTOPEN, &qlen, sizeof(qlen));
+}
+
+inline void set_tcp_fast_open_connect(int sockfd, bool enabled, std::error_code& ec) noexcept
+{
+    int optval{enabled ? 1 : 0};
+    os::setsockopt(sockfd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &optval, sizeof(optval), ec);
+}
+
+/// Enable or disable TCP Fast Open for an active connection.
+///
+/// When enabled, connect() completes immediately, and the SYN is deferred until the first write, so
+/// that the data can be carried in the SYN if a Fast Open cookie has been cached for the peer.
+///
+/// \param sockfd The socket descriptor.
+/// \param enabled Enable or disable Fast Open.
+inline void set_tcp_fast_open_connect(int sockfd, bool enabled)
+{
+    int optval{enabled ? 1 : 0};
+    os::setsockopt(sockfd, IPPROTO_TCP, TCP_FASTOPEN_CONNECT, &optval, sizeof(optval));
+}
+
+inline void set_tcp_defer_accept(int sockfd, int secs, std::error_code& ec) noexcept
+{
+    os::setsockopt(sockfd, IPPROTO_TCP, TCP_DEFER_ACCEPT, &secs, sizeof(secs), ec);
+}
+
+/// Only wake a listening socket when data arrives on a new connection, rather than when the
+/// handshake completes.
+///
+/// \param sockfd The socket descriptor.
+/// \param secs The number of seconds to wait for data before accepting the connection anyway.
+inline void set_tcp_defer_accept(int sockfd, int secs)
+{
+    os::setsockopt(sockfd, IPPROTO_TCP, TCP_DEFER_ACCEPT, &secs, sizeof(secs));
+}
+
 inline void set_so_timestamping(int sockfd, int flags, std::error_code& ec) noexcept
 {
     os::setsockopt(sockfd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags), ec);
@@ -843,6 +990,20 @@ inline int get_so_timestamping(int sockfd)
     return optval;
 }
 
+/// Deliver the software receive timestamp of each datagram as an SCM_TIMESTAMPNS control message.
+inline void set_so_timestampns(int sockfd, bool enabled, std::error_code& ec) noexcept
+{
+    int optval{enabled ? 1 : 0};
+    os::setsockopt(sockfd, SOL_SOCKET, SO_TIMESTAMPNS, &optval, sizeof(optval), ec);
+}
+
+/// Deliver the software receive timestamp of each datagram as an SCM_TIMESTAMPNS control message.
+inline void set_so_timestampns(int sockfd, bool enabled)
+{
+    int optval{enabled ? 1 : 0};
+    os::setsockopt(sockfd, SOL_SOCKET, SO_TIMESTAMPNS, &optval, sizeof(optval));
+}
+
 struct Sock : FileHandle {
     Sock(FileHandle&& sock, int family)
     : FileHandle{std::move(sock)}
@@ -0,0 +1,161 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SocketProfile.hpp"
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+
+int get_int_opt(int sockfd, int level, int optname, error_code& ec) noexcept
+{
+    int optval{};
+    socklen_t optlen{sizeof(optval)};
+    os::getsockopt(sockfd, level, optname, &optval, optlen, ec);
+    return optval;
+}
+
+/// Sets the option and verifies the value that is read back with the predicate.
+template <typename PredT>
+void apply_opt(int sockfd, int level, int optname, const char* name, int optval, PredT pred,
+               vector<SocketOptionError>& errors)
+{
+    error_code ec;
+    os::setsockopt(sockfd, level, optname, &optval, sizeof(optval), ec);
+    if (!ec) {
+        const auto actual = get_int_opt(sockfd, level, optname, ec);
+        if (!ec && !pred(actual)) {
+            ec = make_error_code(errc::result_out_of_range);
+        }
+    }
+    if (ec) {
+        errors.push_back({name, ec});
+    }
+}
+
+void apply_opt(int sockfd, int level, int optname, const char* name, int optval,
+               vector<SocketOptionError>& errors)
+{
+    apply_opt(
+        sockfd, level, optname, name, optval, [optval](int actual) { return actual == optval; },
+        errors);
+}
+
+/// Sets an option that is only a hint to the kernel, so the value is not read back.
+void apply_hint_opt(int sockfd, int level, int optname, const char* name, int optval,
+                    vector<SocketOptionError>& errors)
+{
+    error_code ec;
+    os::setsockopt(sockfd, level, optname, &optval, sizeof(optval), ec);
+    if (ec) {
+        errors.push_back({name, ec});
+    }
+}
+
+void apply_buf_opt(int sockfd, int optname, const char* name, int optval,
+                   vector<SocketOptionError>& errors)
+{
+    // The kernel doubles the requested size, after clamping it to the sysctl limit.
+    apply_opt(
+        sockfd, SOL_SOCKET, optname, name, optval,
+        [optval](int actual) { return actual / 2 >= optval; }, errors);
+}
+
+template <typename ValueT>
+void get_opt(const Config& config, const string& key, optional<ValueT>& val)
+{
+    if (config.get(key, nullptr)) {
+        val = config.get<ValueT>(key);
+    }
+}
+
+} // namespace
+
+bool SocketProfile::empty() const noexcept
+{
+    return !busy_poll && !prefer_busy_poll && !quick_ack && !notsent_lowat && !snd_buf && !rcv_buf
+        && !incoming_cpu && !priority;
+}
+
+size_t SocketProfile::apply(const Sock& sock, vector<SocketOptionError>& errors) const
+{
+    const auto fd = sock.get();
+    const auto n = errors.size();
+    if (busy_poll) {
+        apply_opt(fd, SOL_SOCKET, SO_BUSY_POLL, "SO_BUSY_POLL", *busy_poll, errors);
+    }
+    if (prefer_busy_poll) {
+        apply_opt(fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, "SO_PREFER_BUSY_POLL",
+                  *prefer_busy_poll ? 1 : 0, errors);
+    }
+    if (snd_buf) {
+        apply_buf_opt(fd, SO_SNDBUF, "SO_SNDBUF", *snd_buf, errors);
+    }
+    if (rcv_buf) {
+        apply_buf_opt(fd, SO_RCVBUF, "SO_RCVBUF", *rcv_buf, errors);
+    }
+    if (incoming_cpu) {
+        apply_hint_opt(fd, SOL_SOCKET, SO_INCOMING_CPU, "SO_INCOMING_CPU", *incoming_cpu,
+                       errors);
+    }
+    if (priority) {
+        apply_opt(fd, SOL_SOCKET, SO_PRIORITY, "SO_PRIORITY", *priority, errors);
+    }
+    if (sock.is_ip_family()) {
+        if (quick_ack) {
+            apply_hint_opt(fd, IPPROTO_TCP, TCP_QUICKACK, "TCP_QUICKACK", *quick_ack ? 1 : 0,
+                           errors);
+        }
+        if (notsent_lowat) {
+            apply_opt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, "TCP_NOTSENT_LOWAT", *notsent_lowat,
+                      errors);
+        }
+    }
+    return errors.size() - n;
+}
+
+void SocketProfile::apply(const Sock& sock) const
+{
+    vector<SocketOptionError> errors;
+    if (apply(sock, errors) > 0) {
+        string what{"socket profile:"};
+        for (const auto& err : errors) {
+            what += ' ';
+            what += err.name;
+            what += " (";
+            what += err.ec.message();
+            what += ')';
+        }
+        throw system_error{errors.front().ec, what};
+    }
+}
+
+SocketProfile make_socket_profile(const Config& config, const string& prefix)
+{
+    SocketProfile profile;
+    get_opt(config, prefix + "so_busy_poll", profile.busy_poll);
+    get_opt(config, prefix + "so_prefer_busy_poll", profile.prefer_busy_poll);
+    get_opt(config, prefix + "tcp_quickack", profile.quick_ack);
+    get_opt(config, prefix + "tcp_notsent_lowat", profile.notsent_lowat);
+    get_opt(config, prefix + "so_sndbuf", profile.snd_buf);
+    get_opt(config, prefix + "so_rcvbuf", profile.rcv_buf);
+    get_opt(config, prefix + "so_incoming_cpu", profile.incoming_cpu);
+    get_opt(config, prefix + "so_priority", profile.priority);
+    return profile;
+}
+
+} // namespace net
+} // namespace toolbox
@@ -0,0 +1,117 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_SOCKETPROFILE_HPP
+#define TOOLBOX_NET_SOCKETPROFILE_HPP
+
+#include <toolbox/net/Socket.hpp>
+#include <toolbox/sys/Time.hpp>
+#include <toolbox/util/Config.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace toolbox {
+inline namespace net {
+
+/// Failure to apply a single option of a SocketProfile.
+struct SocketOptionError {
+    /// The option name, for example "SO_BUSY_POLL".
+    const char* name;
+    /// The setsockopt() error, or std::errc::result_out_of_range if the option was accepted by the
+    /// kernel but did not read back as requested, typically because it was clamped by a sysctl.
+    std::error_code ec;
+};
+
+/// A declarative set of latency related socket options. Only the options that have a value are
+/// applied, so that the system defaults are otherwise left untouched.
+///
+/// Each option is read back after it has been set, because the kernel silently clamps some values,
+/// most notably the buffer sizes, which are limited by net.core.rmem_max and net.core.wmem_max.
+/// SO_INCOMING_CPU and TCP_QUICKACK are hints that the kernel may change at any time, so they are
+/// not read back. The TCP options are skipped for sockets that are not in the IP family.
+struct TOOLBOX_API SocketProfile {
+    /// SO_BUSY_POLL: microseconds to busy poll the device queue on blocking reads, or when polled
+    /// from epoll. Raising the value above net.core.busy_read requires CAP_NET_ADMIN.
+    std::optional<int> busy_poll;
+    /// SO_PREFER_BUSY_POLL: prefer busy polling over softirq processing (Linux 5.11).
+    std::optional<bool> prefer_busy_poll;
+    /// TCP_QUICKACK: send acknowledgements immediately rather than delaying them. The flag is not
+    /// sticky: the kernel clears it as soon as it re-enters delayed ACK mode, so setting it when a
+    /// socket is accepted or connected only affects the first acknowledgements. Latency sensitive
+    /// applications that need it throughout must set it again after each read.
+    std::optional<bool> quick_ack;
+    /// TCP_NOTSENT_LOWAT: limit on unsent bytes in the send queue before the socket stops being
+    /// writable, which keeps stale data out of the queue.
+    std::optional<int> notsent_lowat;
+    /// SO_SNDBUF: send buffer size in bytes. The kernel doubles the value for bookkeeping overhead.
+    std::optional<int> snd_buf;
+    /// SO_RCVBUF: receive buffer size in bytes. The kernel doubles the value for bookkeeping
+    /// overhead. Note that the window scale is negotiated during the handshake, so large buffers
+    /// are best set on the listening socket as well.
+    std::optional<int> rcv_buf;
+    /// SO_INCOMING_CPU: preferred CPU for the socket's receive processing. The kernel reports the
+    /// CPU that last processed the socket, which may differ.
+    std::optional<int> incoming_cpu;
+    /// SO_PRIORITY: protocol defined priority for outgoing packets. Values outside the range 0 to
+    /// 6 require CAP_NET_ADMIN.
+    std::optional<int> priority;
+
+    /// Returns true if no options are set.
+    bool empty() const noexcept;
+
+    /// Applies the options to the socket and appends an error for each option that could not be
+    /// set or verified. Returns the number of errors appended.
+    std::size_t apply(const Sock& sock, std::vector<SocketOptionError>& errors) const;
+
+    /// Applies the options to the socket.
+    ///
+    /// Throws std::system_error with the first error if one or more options could not be set or
+    /// verified. The exception's message names each option that failed.
+    void apply(const Sock& sock) const;
+};
+
+/// Reads a SocketProfile from the configuration. The keys are the lower case option names, for
+/// example so_busy_poll, tcp_quickack or so_rcvbuf, preceded by the optional prefix. Options that
+/// are not present in the configuration are left unset.
+TOOLBOX_API SocketProfile make_socket_profile(const Config& config, const std::string& prefix = {});
+
+/// Applies the profile to a socket that was accepted or connected by the derived class of a
+/// StreamAcceptor or StreamConnector. If the derived class defines on_sock_profile_error(), then it
+/// is called with the options that could not be applied. Otherwise, std::system_error is thrown if
+/// any of the options cannot be applied.
+template <typename DerivedT>
+void apply_socket_profile(DerivedT& derived, CyclTime now, const SocketProfile& profile,
+                          const Sock& sock)
+{
+    if (profile.empty()) {
+        return;
+    }
+    if constexpr (requires(const std::vector<SocketOptionError>& errors) {
+                      derived.on_sock_profile_error(now, errors);
+                  }) {
+        std::vector<SocketOptionError> errors;
+        if (profile.apply(sock, errors) > 0) {
+            derived.on_sock_profile_error(now, errors);
+        }
+    } else {
+        profile.apply(sock);
+    }
+}
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_SOCKETPROFILE_HPP
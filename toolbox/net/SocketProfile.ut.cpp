@@ -0,0 +1,216 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SocketProfile.hpp"
+
+#include "Endpoint.hpp"
+#include "StreamAcceptor.hpp"
+#include "StreamConnector.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+int get_int_opt(int sockfd, int level, int optname)
+{
+    int optval{};
+    socklen_t optlen{sizeof(optval)};
+    os::getsockopt(sockfd, level, optname, &optval, optlen);
+    return optval;
+}
+
+struct TestServ : StreamAcceptor<TestServ> {
+    using StreamAcceptor::StreamAcceptor;
+    void on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
+    void on_sock_accept(CyclTime /*now*/, IoSock&& sock, const Endpoint& /*ep*/)
+    {
+        notsent_lowat = get_int_opt(sock.get(), IPPROTO_TCP, TCP_NOTSENT_LOWAT);
+    }
+    int notsent_lowat{0};
+};
+
+struct TestClnt : StreamConnector<TestClnt> {
+    void on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
+    void on_sock_connect(CyclTime /*now*/, IoSock&& sock, const Endpoint& /*ep*/)
+    {
+        priority = get_int_opt(sock.get(), SOL_SOCKET, SO_PRIORITY);
+    }
+    void on_sock_connect_error(CyclTime /*now*/, const std::exception& /*e*/) {}
+    int priority{-1};
+};
+
+/// Reports profile errors rather than rejecting the connection.
+struct ErrorServ : StreamAcceptor<ErrorServ> {
+    using StreamAcceptor::StreamAcceptor;
+    void on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
+    void on_sock_profile_error(CyclTime /*now*/, const vector<SocketOptionError>& errors)
+    {
+        this->errors = errors;
+    }
+    void on_sock_accept(CyclTime /*now*/, IoSock&& sock, const Endpoint& /*ep*/)
+    {
+        notsent_lowat = get_int_opt(sock.get(), IPPROTO_TCP, TCP_NOTSENT_LOWAT);
+    }
+    vector<SocketOptionError> errors;
+    int notsent_lowat{0};
+};
+
+struct ErrorClnt : StreamConnector<ErrorClnt> {
+    void on_sock_prepare(CyclTime /*now*/, IoSock& /*sock*/) {}
+    void on_sock_profile_error(CyclTime /*now*/, const vector<SocketOptionError>& errors)
+    {
+        this->errors = errors;
+    }
+    void on_sock_connect(CyclTime /*now*/, IoSock&& sock, const Endpoint& /*ep*/)
+    {
+        priority = get_int_opt(sock.get(), SOL_SOCKET, SO_PRIORITY);
+    }
+    void on_sock_connect_error(CyclTime /*now*/, const std::exception& /*e*/) {}
+    vector<SocketOptionError> errors;
+    int priority{-1};
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SocketProfileSuite)
+
+BOOST_AUTO_TEST_CASE(MakeSocketProfileCase)
+{
+    Config config;
+    config.set("so_busy_poll", "50"s);
+    config.set("tcp_quickack", "yes"s);
+    config.set("so_rcvbuf", "65536"s);
+    config.set("md_so_priority", "4"s);
+
+    auto profile = make_socket_profile(config);
+    BOOST_CHECK(!profile.empty());
+    BOOST_CHECK(profile.busy_poll == 50);
+    BOOST_CHECK(!profile.prefer_busy_poll);
+    BOOST_CHECK(profile.quick_ack == true);
+    BOOST_CHECK(!profile.notsent_lowat);
+    BOOST_CHECK(!profile.snd_buf);
+    BOOST_CHECK(profile.rcv_buf == 65536);
+    BOOST_CHECK(!profile.incoming_cpu);
+    BOOST_CHECK(!profile.priority);
+
+    profile = make_socket_profile(config, "md_");
+    BOOST_CHECK(!profile.busy_poll);
+    BOOST_CHECK(profile.priority == 4);
+
+    BOOST_CHECK(make_socket_profile(Config{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(ApplyCase)
+{
+    SocketProfile profile;
+    profile.quick_ack = true;
+    profile.notsent_lowat = 16384;
+    profile.snd_buf = 32768;
+    profile.incoming_cpu = 0;
+    profile.priority = 3;
+
+    StreamSockClnt sock{StreamProtocol::tcp4()};
+    vector<SocketOptionError> errors;
+    BOOST_CHECK_EQUAL(profile.apply(sock, errors), 0U);
+    BOOST_CHECK_EQUAL(get_int_opt(sock.get(), IPPROTO_TCP, TCP_NOTSENT_LOWAT), 16384);
+    BOOST_CHECK_EQUAL(sock.get_snd_buf(), 65536);
+    BOOST_CHECK_EQUAL(get_int_opt(sock.get(), SOL_SOCKET, SO_PRIORITY), 3);
+
+    // The TCP options are not applied to Unix domain sockets.
+    StreamSockClnt unix_sock{StreamProtocol::unix()};
+    BOOST_CHECK_NO_THROW(profile.apply(unix_sock));
+}
+
+BOOST_AUTO_TEST_CASE(ApplyErrorCase)
+{
+    SocketProfile profile;
+    // Clamped by net.core.rmem_max, unless the limit has been raised considerably.
+    profile.rcv_buf = 1 << 30;
+    profile.notsent_lowat = 16384;
+    profile.busy_poll = -1;
+
+    StreamSockClnt sock{StreamProtocol::tcp4()};
+    vector<SocketOptionError> errors;
+    BOOST_CHECK_EQUAL(profile.apply(sock, errors), 2U);
+    BOOST_CHECK_EQUAL(errors[0].name, "SO_BUSY_POLL"sv);
+    BOOST_CHECK(errors[0].ec == errc::invalid_argument);
+    BOOST_CHECK_EQUAL(errors[1].name, "SO_RCVBUF"sv);
+    BOOST_CHECK(errors[1].ec == errc::result_out_of_range);
+    // The remaining options are still applied.
+    BOOST_CHECK_EQUAL(get_int_opt(sock.get(), IPPROTO_TCP, TCP_NOTSENT_LOWAT), 16384);
+
+    BOOST_CHECK_EXCEPTION(profile.apply(sock), system_error, [](const auto& e) {
+        const string_view what{e.what()};
+        return what.find("SO_BUSY_POLL") != what.npos && what.find("SO_RCVBUF") != what.npos;
+    });
+}
+
+BOOST_AUTO_TEST_CASE(AcceptConnectCase)
+{
+    using namespace literals::chrono_literals;
+
+    Reactor r{1024};
+    TestServ serv{r, parse_stream_endpoint("tcp4://127.0.0.1:0")};
+    SocketProfile serv_profile;
+    serv_profile.notsent_lowat = 8192;
+    serv.set_socket_profile(serv_profile);
+    BOOST_CHECK(serv.socket_profile().notsent_lowat == 8192);
+
+    TestClnt clnt;
+    SocketProfile clnt_profile;
+    clnt_profile.priority = 5;
+    clnt.set_socket_profile(clnt_profile);
+    if (!clnt.connect(CyclTime::now(), r, serv.local_endpoint())) {
+        r.poll(CyclTime::now(), 0ms);
+    }
+    r.poll(CyclTime::now(), 0ms);
+    BOOST_CHECK_EQUAL(serv.notsent_lowat, 8192);
+    BOOST_CHECK_EQUAL(clnt.priority, 5);
+}
+
+BOOST_AUTO_TEST_CASE(AcceptConnectErrorCase)
+{
+    using namespace literals::chrono_literals;
+
+    SocketProfile profile;
+    // Clamped by net.core.rmem_max, unless the limit has been raised considerably.
+    profile.rcv_buf = 1 << 30;
+    profile.notsent_lowat = 8192;
+
+    Reactor r{1024};
+    ErrorServ serv{r, parse_stream_endpoint("tcp4://127.0.0.1:0")};
+    serv.set_socket_profile(profile);
+
+    ErrorClnt clnt;
+    profile.priority = 5;
+    clnt.set_socket_profile(profile);
+    if (!clnt.connect(CyclTime::now(), r, serv.local_endpoint())) {
+        r.poll(CyclTime::now(), 0ms);
+    }
+    r.poll(CyclTime::now(), 0ms);
+
+    // The errors are reported, but the connections are established with the remaining options.
+    BOOST_TEST_REQUIRE(serv.errors.size() == 1U);
+    BOOST_CHECK_EQUAL(serv.errors[0].name, "SO_RCVBUF"sv);
+    BOOST_CHECK_EQUAL(serv.notsent_lowat, 8192);
+    BOOST_TEST_REQUIRE(clnt.errors.size() == 1U);
+    BOOST_CHECK_EQUAL(clnt.errors[0].name, "SO_RCVBUF"sv);
+    BOOST_CHECK_EQUAL(clnt.priority, 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,165 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SpliceProxy.hpp"
+
+#include <toolbox/sys/Limits.hpp>
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+constexpr unsigned SpliceFlags{SPLICE_F_MOVE | SPLICE_F_NONBLOCK};
+// Default pipe capacity.
+constexpr size_t MinPipeSize{16 * PageSize};
+} // namespace
+
+SpliceProxy::SpliceProxy(Reactor& r, IoSock&& a, IoSock&& b, Slot slot, size_t pipe_size)
+: socks_{std::move(a), std::move(b)}
+, slot_{slot}
+{
+    for (auto& d : dirs_) {
+        auto fds = os::pipe2(O_CLOEXEC | O_NONBLOCK);
+        d.rfd = std::move(fds.first);
+        d.wfd = std::move(fds.second);
+        if (pipe_size > MinPipeSize) {
+            os::fcntl(d.wfd.get(), F_SETPIPE_SZ, static_cast<int>(pipe_size));
+        }
+    }
+    pipe_size_ = os::fcntl(dirs_[0].wfd.get(), F_GETPIPE_SZ);
+    for (size_t i{0}; i < 2; ++i) {
+        socks_[i].set_non_block();
+        subs_[i] = r.subscribe(*socks_[i], EpollIn, bind<&SpliceProxy::on_io_event>(this));
+    }
+}
+
+SpliceProxy::~SpliceProxy() = default;
+
+void SpliceProxy::on_io_event(CyclTime now, int fd, unsigned events)
+{
+    const size_t k{fd == socks_[0].get() ? 0U : 1U};
+    try {
+        // The socket is the destination of the opposite direction.
+        if (events & EpollOut) {
+            drain(1 - k);
+        }
+        if (events & (EpollIn | EpollHup | EpollErr)) {
+            fill(k);
+        }
+        if ((events & EpollHup) && dirs_[k].eof) {
+            // The peer has shut down both directions, so nothing more can be written to it, and
+            // the hang-up would otherwise be reported continuously.
+            dirs_[1 - k].done = true;
+            subs_[k].reset();
+        }
+        if (dirs_[0].done && dirs_[1].done) {
+            close(now);
+            return;
+        }
+        update_events();
+    } catch (const system_error& e) {
+        ec_ = e.code();
+        close(now);
+    }
+}
+
+void SpliceProxy::fill(size_t i)
+{
+    auto& d = dirs_[i];
+    // Limit the number of reads to avoid starvation.
+    for (int n{0}; n < 4 && !d.eof && d.pending < pipe_size_; ++n) {
+        error_code ec;
+        const auto size
+            = os::splice(socks_[i].get(), d.wfd.get(), pipe_size_ - d.pending, SpliceFlags, ec);
+        if (ec) {
+            // No data available in socket buffer.
+            if (ec == errc::operation_would_block) {
+                break;
+            }
+            throw system_error{ec, "splice"};
+        }
+        if (size == 0) {
+            d.eof = true;
+            break;
+        }
+        d.pending += size;
+    }
+    drain(i);
+}
+
+void SpliceProxy::drain(size_t i)
+{
+    auto& d = dirs_[i];
+    if (d.done) {
+        return;
+    }
+    while (d.pending > 0) {
+        error_code ec;
+        const auto size = os::splice(d.rfd.get(), socks_[1 - i].get(), d.pending, SpliceFlags, ec);
+        if (ec) {
+            // Wait for the destination to become writable.
+            if (ec == errc::operation_would_block) {
+                d.blocked = true;
+                return;
+            }
+            throw system_error{ec, "splice"};
+        }
+        d.pending -= size;
+        d.bytes += size;
+    }
+    d.blocked = false;
+    if (d.eof) {
+        // Forward the half-close once the remaining data has been flushed.
+        socks_[1 - i].shutdown(SHUT_WR);
+        d.done = true;
+    }
+}
+
+void SpliceProxy::update_events()
+{
+    for (size_t k{0}; k < 2; ++k) {
+        if (!subs_[k]) {
+            continue;
+        }
+        // Stop reading from the source while its pipe is full.
+        unsigned events{0};
+        if (!dirs_[k].eof && dirs_[k].pending < pipe_size_) {
+            events |= EpollIn;
+        }
+        if (dirs_[1 - k].blocked) {
+            events |= EpollOut;
+        }
+        if (events != events_[k]) {
+            subs_[k].set_events(events);
+            events_[k] = events;
+        }
+    }
+}
+
+void SpliceProxy::close(CyclTime now)
+{
+    for (size_t i{0}; i < 2; ++i) {
+        subs_[i].reset();
+        socks_[i].close();
+    }
+    closed_ = true;
+    if (slot_) {
+        // The slot may destroy the proxy.
+        slot_(now, *this);
+    }
+}
+
+} // namespace net
+} // namespace toolbox
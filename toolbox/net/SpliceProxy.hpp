@@ -0,0 +1,101 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_SPLICEPROXY_HPP
+#define TOOLBOX_NET_SPLICEPROXY_HPP
+
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/IoSock.hpp>
+
+namespace toolbox {
+inline namespace net {
+
+/// Relays a byte stream in both directions between two sockets, without copying the data through
+/// user space.
+///
+/// Each direction has its own pipe, and the data is moved from the source socket into the pipe, and
+/// from the pipe into the destination socket, with splice(). Back-pressure is handled in the same
+/// way as BasicConn::flush_output(): when the destination socket cannot accept the whole of the
+/// pipe, the proxy waits for EpollOut on the destination, and stops reading from the source until
+/// the pipe has drained.
+///
+/// When one side shuts down its write side, the proxy forwards the remaining data and then shuts
+/// down the write side of the other socket, so half-closed connections are preserved. The slot is
+/// called once both directions have finished, or when either socket fails, after which both
+/// sockets have been closed and the proxy may be destroyed.
+class TOOLBOX_API SpliceProxy {
+  public:
+    using Slot = BasicSlot<void(CyclTime, SpliceProxy&)>;
+
+    /// The pipe size, if larger than the default of 64KiB, is set with F_SETPIPE_SZ, and is rounded
+    /// up by the kernel to a power of two number of pages. Smaller pipes are not supported, because
+    /// a single segment spliced from a socket may need several pipe buffers, and a pipe that is too
+    /// small to hold it would never become readable.
+    SpliceProxy(Reactor& r, IoSock&& a, IoSock&& b, Slot slot = Slot{},
+                std::size_t pipe_size = 0);
+    ~SpliceProxy();
+
+    // Copy.
+    SpliceProxy(const SpliceProxy&) = delete;
+    SpliceProxy& operator=(const SpliceProxy&) = delete;
+
+    // Move.
+    SpliceProxy(SpliceProxy&&) = delete;
+    SpliceProxy& operator=(SpliceProxy&&) = delete;
+
+    /// Returns true once the proxy has finished and both sockets have been closed.
+    bool closed() const noexcept { return closed_; }
+    /// Returns the error that caused the proxy to close, if any.
+    std::error_code error() const noexcept { return ec_; }
+    /// Returns the number of bytes relayed from the first socket to the second.
+    std::uint64_t bytes_a_to_b() const noexcept { return dirs_[0].bytes; }
+    /// Returns the number of bytes relayed from the second socket to the first.
+    std::uint64_t bytes_b_to_a() const noexcept { return dirs_[1].bytes; }
+
+  private:
+    /// State for the data flowing from socks_[i] to socks_[1 - i].
+    struct Direction {
+        FileHandle rfd, wfd;
+        /// Number of bytes in the pipe.
+        std::size_t pending{0};
+        std::uint64_t bytes{0};
+        /// True if the destination socket could not accept all of the pending bytes.
+        bool blocked{false};
+        /// True if the source socket has reached end-of-file.
+        bool eof{false};
+        /// True once the write side of the destination has been shut down.
+        bool done{false};
+    };
+
+    void on_io_event(CyclTime now, int fd, unsigned events);
+    void fill(std::size_t i);
+    void drain(std::size_t i);
+    void update_events();
+    void close(CyclTime now);
+
+    IoSock socks_[2];
+    Direction dirs_[2];
+    Reactor::Handle subs_[2];
+    unsigned events_[2]{EpollIn, EpollIn};
+    std::size_t pipe_size_;
+    Slot slot_;
+    std::error_code ec_;
+    bool closed_{false};
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_SPLICEPROXY_HPP
@@ -0,0 +1,162 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SpliceProxy.hpp"
+
+#include "Protocol.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+string recv_all(const IoSock& sock)
+{
+    string s;
+    char buf[256];
+    for (;;) {
+        error_code ec;
+        const auto size = os::recv(sock.get(), buf, sizeof(buf), MSG_DONTWAIT, ec);
+        if (ec || size == 0) {
+            break;
+        }
+        s.append(buf, size);
+    }
+    return s;
+}
+
+struct Fixture {
+    Fixture()
+    {
+        auto a = socketpair(UnixStreamProtocol{});
+        auto b = socketpair(UnixStreamProtocol{});
+        clnt = std::move(a.first);
+        serv = std::move(b.second);
+        proxy = make_unique<SpliceProxy>(r, std::move(a.second), std::move(b.first),
+                                         bind<&Fixture::on_close>(this));
+    }
+    void on_close(CyclTime /*now*/, SpliceProxy& /*proxy*/) { ++closes; }
+    void poll()
+    {
+        using namespace literals::chrono_literals;
+        while (r.poll(CyclTime::now(), 0ms) > 0) {
+        }
+    }
+
+    Reactor r{1024};
+    IoSock clnt, serv;
+    unique_ptr<SpliceProxy> proxy;
+    int closes{0};
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SpliceProxySuite)
+
+BOOST_FIXTURE_TEST_CASE(RelayCase, Fixture)
+{
+    os::send(clnt.get(), "hello", 5, 0);
+    poll();
+    BOOST_CHECK_EQUAL(recv_all(serv), "hello");
+
+    os::send(serv.get(), "world", 5, 0);
+    poll();
+    BOOST_CHECK_EQUAL(recv_all(clnt), "world");
+
+    BOOST_CHECK_EQUAL(proxy->bytes_a_to_b(), 5);
+    BOOST_CHECK_EQUAL(proxy->bytes_b_to_a(), 5);
+    BOOST_CHECK(!proxy->closed());
+}
+
+BOOST_FIXTURE_TEST_CASE(BackPressureCase, Fixture)
+{
+    vector<char> data(1 << 20);
+    for (size_t i{0}; i < data.size(); ++i) {
+        data[i] = static_cast<char>(i % 251);
+    }
+
+    // Write until every buffer between the client and the server is full.
+    size_t sent{0};
+    while (sent < data.size()) {
+        error_code ec;
+        const auto size
+            = os::send(clnt.get(), data.data() + sent, data.size() - sent, MSG_DONTWAIT, ec);
+        if (ec) {
+            break;
+        }
+        sent += size;
+        poll();
+    }
+    poll();
+    BOOST_CHECK_LT(sent, data.size());
+    BOOST_CHECK_LT(proxy->bytes_a_to_b(), sent);
+
+    // The proxy resumes as the server reads.
+    string recvd;
+    while (recvd.size() < data.size()) {
+        recvd += recv_all(serv);
+        if (sent < data.size()) {
+            error_code ec;
+            const auto size = os::send(clnt.get(), data.data() + sent, data.size() - sent,
+                                       MSG_DONTWAIT, ec);
+            if (!ec) {
+                sent += size;
+            }
+        }
+        poll();
+    }
+    BOOST_CHECK(equal(recvd.begin(), recvd.end(), data.begin(), data.end()));
+    BOOST_CHECK_EQUAL(proxy->bytes_a_to_b(), data.size());
+    BOOST_CHECK(!proxy->closed());
+}
+
+BOOST_FIXTURE_TEST_CASE(HalfCloseCase, Fixture)
+{
+    os::send(clnt.get(), "foo", 3, 0);
+    clnt.shutdown(SHUT_WR);
+    poll();
+
+    // The server sees the data followed by end-of-file.
+    char buf[8];
+    BOOST_CHECK_EQUAL(os::recv(serv.get(), buf, sizeof(buf), MSG_DONTWAIT), 3);
+    BOOST_CHECK_EQUAL(os::recv(serv.get(), buf, sizeof(buf), MSG_DONTWAIT), 0);
+
+    // The other direction remains open.
+    os::send(serv.get(), "bar", 3, 0);
+    poll();
+    BOOST_CHECK_EQUAL(recv_all(clnt), "bar");
+    BOOST_CHECK(!proxy->closed());
+
+    serv.shutdown(SHUT_WR);
+    poll();
+    BOOST_CHECK(proxy->closed());
+    BOOST_CHECK(!proxy->error());
+    BOOST_CHECK_EQUAL(closes, 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(ResetCase, Fixture)
+{
+    serv.close();
+    os::send(clnt.get(), "foo", 3, 0);
+    poll();
+    BOOST_CHECK(proxy->closed());
+    BOOST_CHECK_EQUAL(closes, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
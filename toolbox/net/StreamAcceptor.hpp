@@ -18,6 +18,7 @@
 #define TOOLBOX_NET_STREAMACCEPTOR_HPP
 
 #include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/SocketProfile.hpp>
 #include <toolbox/net/StreamSock.hpp>
 
 namespace toolbox {
@@ -37,6 +38,15 @@ class StreamAcceptor {
         serv_.listen(SOMAXCONN);
         sub_ = r.subscribe(*serv_, EpollIn, bind<&StreamAcceptor::on_io_event>(this));
     }
+    /// Adopts a socket that is already bound and listening, for example one that was inherited
+    /// from, or passed over SCM_RIGHTS by, a previous instance of the process. Connections that are
+    /// queued on the socket are not lost during the handover, but the previous owner should stop
+    /// accepting on the socket once it has been passed on.
+    StreamAcceptor(Reactor& r, StreamSockServ&& serv)
+    : serv_{std::move(serv)}
+    {
+        sub_ = r.subscribe(*serv_, EpollIn, bind<&StreamAcceptor::on_io_event>(this));
+    }
 
     // Copy.
     StreamAcceptor(const StreamAcceptor&) = delete;
@@ -46,6 +56,25 @@ class StreamAcceptor {
     StreamAcceptor(StreamAcceptor&&) = delete;
     StreamAcceptor& operator=(StreamAcceptor&&) = delete;
 
+    /// Returns the listening socket, so that its descriptor can be passed to another process.
+    const StreamSockServ& sock() const noexcept { return serv_; }
+
+    /// Returns the address that the listening socket is bound to, which is useful when binding to
+    /// an ephemeral port.
+    Endpoint local_endpoint() const
+    {
+        Endpoint ep;
+        get_sock_name(*serv_, ep);
+        return ep;
+    }
+
+    const SocketProfile& socket_profile() const noexcept { return profile_; }
+    /// Sets the socket options that are applied to each accepted socket after on_sock_prepare().
+    /// If the derived class defines on_sock_profile_error(), then it is called with the options
+    /// that could not be applied, and the connection is only rejected if it throws. Otherwise, the
+    /// connection is rejected if any of the options cannot be applied.
+    void set_socket_profile(const SocketProfile& profile) { profile_ = profile; }
+
   protected:
     ~StreamAcceptor() = default;
 
@@ -55,6 +84,7 @@ class StreamAcceptor {
         Endpoint ep;
         IoSock sock{os::accept(fd, ep), serv_.family()};
         static_cast<DerivedT*>(this)->on_sock_prepare(now, sock);
+        apply_socket_profile(*static_cast<DerivedT*>(this), now, profile_, sock);
         sock.set_non_block();
         if (sock.is_ip_family()) {
             set_tcp_no_delay(sock.get(), true);
@@ -66,6 +96,7 @@ class StreamAcceptor {
     }
 
     StreamSockServ serv_;
+    SocketProfile profile_;
     Reactor::Handle sub_;
 };
 
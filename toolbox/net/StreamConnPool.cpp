@@ -0,0 +1,148 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StreamConnPool.hpp"
+
+#include <toolbox/util/Random.hpp>
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+// Upper bound of the connection latency histogram, in nanoseconds.
+constexpr int64_t MaxLatency{60'000'000'000};
+} // namespace
+
+void StreamConnPool::Member::connect(CyclTime now)
+{
+    start_ = now.mono_time();
+    try {
+        StreamConnector<Member>::connect(now, pool_.reactor_, pool_.ep_);
+    } catch (const exception& e) {
+        on_sock_connect_error(now, e);
+    }
+}
+
+IoSock StreamConnPool::Member::take(CyclTime now)
+{
+    pool_.ready_.erase(pool_.ready_.iterator_to(*this));
+    sub_.reset();
+    IoSock sock{std::move(sock_)};
+    connect(now);
+    return sock;
+}
+
+void StreamConnPool::Member::on_sock_prepare(CyclTime /*now*/, IoSock& sock)
+{
+    if (pool_.opts_.fast_open && sock.is_ip_family()) {
+        set_tcp_fast_open_connect(sock.get(), true);
+    }
+}
+
+void StreamConnPool::Member::on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& /*ep*/)
+{
+    auto& pool = pool_;
+    ++pool.stats_.connects;
+    pool.connect_latency_.record_value(
+        clamp<int64_t>((now.mono_time() - start_).count(), 0, MaxLatency));
+    failures_ = 0;
+    sock_ = std::move(sock);
+    // The peer is not expected to send anything on an idle connection, so readability indicates
+    // either a hang-up or a protocol error.
+    sub_ = pool.reactor_.subscribe(*sock_, EpollIn | EpollRdHup,
+                                   bind<&Member::on_io_event>(this));
+    pool.ready_.push_back(*this);
+}
+
+void StreamConnPool::Member::on_sock_connect_error(CyclTime now, const exception& /*e*/)
+{
+    ++pool_.stats_.connect_errors;
+    schedule_retry(now);
+}
+
+void StreamConnPool::Member::on_io_event(CyclTime now, int /*fd*/, unsigned /*events*/)
+{
+    ++pool_.stats_.drops;
+    pool_.ready_.erase(pool_.ready_.iterator_to(*this));
+    sub_.reset();
+    sock_.close();
+    schedule_retry(now);
+}
+
+void StreamConnPool::Member::on_timer(CyclTime now, Timer& /*tmr*/)
+{
+    connect(now);
+}
+
+void StreamConnPool::Member::schedule_retry(CyclTime now)
+{
+    const auto& opts = pool_.opts_;
+    // Double the delay after each consecutive failure, and then choose a random delay between half
+    // and all of it, so that members that failed together do not retry together.
+    const auto max_delay = opts.max_backoff.count();
+    auto delay = min(opts.min_backoff.count(), max_delay);
+    // Stop doubling at the maximum, so that the delay cannot overflow.
+    for (int i{0}; i < failures_ && delay < max_delay; ++i) {
+        delay = delay > max_delay / 2 ? max_delay : delay * 2;
+    }
+    delay = randint<int64_t>(delay / 2, delay);
+    ++failures_;
+    tmr_ = pool_.reactor_.timer(now.mono_time() + Duration{delay}, Priority::Low,
+                                bind<&Member::on_timer>(this));
+}
+
+StreamConnPool::StreamConnPool(CyclTime now, Reactor& r, const Endpoint& ep,
+                               const StreamConnPoolOptions& opts)
+: reactor_{r}
+, ep_{ep}
+, opts_{opts}
+, connect_latency_{1, MaxLatency, 3}
+{
+    members_.reserve(opts_.size);
+    for (size_t i{0}; i < opts_.size; ++i) {
+        members_.push_back(make_unique<Member>(*this));
+    }
+    for (auto& member : members_) {
+        member->connect(now);
+    }
+}
+
+StreamConnPool::~StreamConnPool()
+{
+    ready_.clear();
+}
+
+IoSock StreamConnPool::acquire(CyclTime now)
+{
+    // Members that reconnect synchronously are appended to the ready list, so limit the number of
+    // attempts to the size of the pool.
+    for (size_t i{0}; i < opts_.size && !ready_.empty(); ++i) {
+        auto sock = ready_.front().take(now);
+        // Discard the connection if the peer has closed it since the last poll.
+        char c;
+        error_code ec;
+        os::recv(sock.get(), &c, 1, MSG_PEEK | MSG_DONTWAIT, ec);
+        if (ec == errc::operation_would_block) {
+            ++stats_.acquires;
+            return sock;
+        }
+        ++stats_.drops;
+    }
+    ++stats_.misses;
+    return {};
+}
+
+} // namespace net
+} // namespace toolbox
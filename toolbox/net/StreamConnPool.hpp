@@ -0,0 +1,143 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_STREAMCONNPOOL_HPP
+#define TOOLBOX_NET_STREAMCONNPOOL_HPP
+
+#include <toolbox/hdr/Histogram.hpp>
+#include <toolbox/net/StreamConnector.hpp>
+
+#include <boost/intrusive/list.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace toolbox {
+inline namespace net {
+
+struct StreamConnPoolOptions {
+    /// Number of warm connections to maintain.
+    std::size_t size{4};
+    /// Delay before the first reconnection attempt after a failure.
+    Duration min_backoff{std::chrono::milliseconds{100}};
+    /// Upper bound of the reconnection delay, which doubles after each consecutive failure.
+    Duration max_backoff{std::chrono::seconds{30}};
+    /// Use TCP_FASTOPEN_CONNECT, so that the SYN is deferred until the first write, and carries the
+    /// data if the peer has previously issued a Fast Open cookie. Connections are reported as warm
+    /// as soon as the socket has been created.
+    bool fast_open{false};
+};
+
+struct StreamConnPoolStats {
+    /// Number of connections established.
+    std::uint64_t connects{0};
+    /// Number of failed connection attempts.
+    std::uint64_t connect_errors{0};
+    /// Number of idle connections dropped because the peer closed them or sent unsolicited data.
+    std::uint64_t drops{0};
+    /// Number of connections handed out.
+    std::uint64_t acquires{0};
+    /// Number of acquire() calls that found no warm connection.
+    std::uint64_t misses{0};
+};
+
+/// Maintains a set of warm, pre-connected stream sockets to a single endpoint, so that opening a
+/// connection does not cost a handshake on the critical path.
+///
+/// Each member of the pool is a StreamConnector that reconnects with jittered exponential backoff
+/// after a failure. Idle connections are watched for hang-ups, and are validated again when they
+/// are handed out. A connection that is handed out belongs to the caller, and the pool immediately
+/// begins to replace it.
+class TOOLBOX_API StreamConnPool {
+    class Member : public StreamConnector<Member> {
+        friend StreamConnector<Member>;
+
+      public:
+        explicit Member(StreamConnPool& pool) noexcept
+        : pool_{pool}
+        {
+        }
+
+        /// Starts a connection attempt.
+        void connect(CyclTime now);
+        /// Returns the idle connection and begins a new connection attempt.
+        IoSock take(CyclTime now);
+
+        boost::intrusive::list_member_hook<> list_hook;
+
+      private:
+        void on_sock_prepare(CyclTime now, IoSock& sock);
+        void on_sock_connect(CyclTime now, IoSock&& sock, const Endpoint& ep);
+        void on_sock_connect_error(CyclTime now, const std::exception& e);
+        void on_io_event(CyclTime now, int fd, unsigned events);
+        void on_timer(CyclTime now, Timer& tmr);
+        void schedule_retry(CyclTime now);
+
+        StreamConnPool& pool_;
+        IoSock sock_;
+        Reactor::Handle sub_;
+        Timer tmr_;
+        MonoTime start_{};
+        /// Number of consecutive failures.
+        int failures_{0};
+    };
+
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<true>;
+    using MemberHookOption
+        = boost::intrusive::member_hook<Member, decltype(Member::list_hook), &Member::list_hook>;
+    using MemberList = boost::intrusive::list<Member, ConstantTimeSizeOption, MemberHookOption>;
+
+  public:
+    using Endpoint = StreamEndpoint;
+
+    StreamConnPool(CyclTime now, Reactor& r, const Endpoint& ep,
+                   const StreamConnPoolOptions& opts = {});
+    ~StreamConnPool();
+
+    // Copy.
+    StreamConnPool(const StreamConnPool&) = delete;
+    StreamConnPool& operator=(const StreamConnPool&) = delete;
+
+    // Move.
+    StreamConnPool(StreamConnPool&&) = delete;
+    StreamConnPool& operator=(StreamConnPool&&) = delete;
+
+    const Endpoint& endpoint() const noexcept { return ep_; }
+    const StreamConnPoolOptions& options() const noexcept { return opts_; }
+    const StreamConnPoolStats& stats() const noexcept { return stats_; }
+    /// Histogram of the time taken to establish each connection, in nanoseconds.
+    const Histogram& connect_latency() const noexcept { return connect_latency_; }
+    /// Returns the number of warm connections that are ready to be handed out.
+    std::size_t ready() const noexcept { return ready_.size(); }
+
+    /// Returns a warm connection in constant time, or an empty socket if none is available. The
+    /// socket is non-blocking, and has TCP_NODELAY set.
+    IoSock acquire(CyclTime now);
+
+  private:
+    Reactor& reactor_;
+    const Endpoint ep_;
+    const StreamConnPoolOptions opts_;
+    StreamConnPoolStats stats_;
+    Histogram connect_latency_;
+    std::vector<std::unique_ptr<Member>> members_;
+    /// Members that hold a warm connection.
+    MemberList ready_;
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_STREAMCONNPOOL_HPP
@@ -0,0 +1,102 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "StreamConnPool.hpp"
+
+#include "StreamSock.hpp"
+
+#include <toolbox/io/Reactor.ut.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+StreamSockServ make_listener(StreamEndpoint& ep)
+{
+    StreamSockServ serv{StreamProtocol::tcp4()};
+    serv.bind(parse_stream_endpoint("tcp4://127.0.0.1:0"));
+    serv.listen(SOMAXCONN);
+    serv.get_sock_name(ep);
+    return serv;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(StreamConnPoolSuite)
+
+BOOST_AUTO_TEST_CASE(AcquireCase)
+{
+    StreamEndpoint ep;
+    auto serv = make_listener(ep);
+
+    Reactor r{1024};
+    StreamConnPool pool{CyclTime::now(), r, ep, {.size = 3}};
+    BOOST_CHECK(poll_until(r, [&pool]() { return pool.ready() == 3; }));
+    BOOST_CHECK_EQUAL(pool.stats().connects, 3);
+    BOOST_CHECK_EQUAL(pool.connect_latency().total_count(), 3);
+
+    auto sock = pool.acquire(CyclTime::now());
+    BOOST_CHECK(sock);
+    BOOST_CHECK(sock.is_tcp_no_delay());
+    BOOST_CHECK_EQUAL(pool.stats().acquires, 1);
+
+    // The pool replaces the connection that was handed out.
+    BOOST_CHECK(poll_until(r, [&pool]() { return pool.ready() == 3; }));
+    BOOST_CHECK_EQUAL(pool.stats().connects, 4);
+
+    // The connection is usable.
+    IoSock peer{os::accept(serv.get()), AF_INET};
+    os::send(sock.get(), "x", 1, 0);
+    char c{};
+    BOOST_CHECK_EQUAL(os::recv(peer.get(), &c, 1, 0), 1);
+}
+
+BOOST_AUTO_TEST_CASE(DropCase)
+{
+    StreamEndpoint ep;
+    auto serv = make_listener(ep);
+
+    Reactor r{1024};
+    StreamConnPool pool{CyclTime::now(), r, ep, {.size = 2, .min_backoff = 1ms}};
+    BOOST_CHECK(poll_until(r, [&pool]() { return pool.ready() == 2; }));
+
+    // The server closes both idle connections.
+    for (int i{0}; i < 2; ++i) {
+        IoSock{os::accept(serv.get()), AF_INET}.close();
+    }
+    BOOST_CHECK(poll_until(r, [&pool]() { return pool.stats().drops == 2; }));
+    BOOST_CHECK(poll_until(r, [&pool]() { return pool.ready() == 2; }));
+    BOOST_CHECK_EQUAL(pool.stats().connects, 4);
+}
+
+BOOST_AUTO_TEST_CASE(ConnectErrorCase)
+{
+    StreamEndpoint ep;
+    // Nothing is listening once the socket has been closed.
+    make_listener(ep).close();
+
+    Reactor r{1024};
+    StreamConnPool pool{CyclTime::now(), r, ep, {.size = 2, .min_backoff = 1ms}};
+    BOOST_CHECK(poll_until(r, [&pool]() { return pool.stats().connect_errors >= 4; }));
+    BOOST_CHECK_EQUAL(pool.ready(), 0);
+
+    BOOST_CHECK(!pool.acquire(CyclTime::now()));
+    BOOST_CHECK_EQUAL(pool.stats().misses, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
 #define TOOLBOX_NET_STREAMCONNECTOR_HPP
 
 #include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/SocketProfile.hpp>
 #include <toolbox/net/StreamSock.hpp>
 
 namespace toolbox {
@@ -39,6 +40,13 @@ class StreamConnector {
     StreamConnector(StreamConnector&&) = delete;
     StreamConnector& operator=(StreamConnector&&) = delete;
 
+    const SocketProfile& socket_profile() const noexcept { return profile_; }
+    /// Sets the socket options that are applied to each connecting socket after on_sock_prepare().
+    /// If the derived class defines on_sock_profile_error(), then it is called with the options
+    /// that could not be applied, and the connection only fails if it throws. Otherwise, connect()
+    /// throws std::system_error if any of the options cannot be applied.
+    void set_socket_profile(const SocketProfile& profile) { profile_ = profile; }
+
     /*
      * Returns true if connection was established synchronously or false if connection is pending
      * asynchronous completion.
@@ -47,6 +55,7 @@ class StreamConnector {
     {
         StreamSockClnt sock{ep.protocol()};
         static_cast<DerivedT*>(this)->on_sock_prepare(now, sock);
+        apply_socket_profile(*static_cast<DerivedT*>(this), now, profile_, sock);
         sock.set_non_block();
         if (sock.is_ip_family()) {
             set_tcp_no_delay(sock.get(), true);
@@ -92,6 +101,7 @@ class StreamConnector {
         }
     }
 
+    SocketProfile profile_;
     Endpoint ep_;
     StreamSockClnt sock_;
     Reactor::Handle sub_;
@@ -52,6 +52,17 @@ struct StreamSockServ : Sock {
     void listen(int backlog, std::error_code& ec) noexcept { os::listen(get(), backlog, ec); }
     void listen(int backlog) { os::listen(get(), backlog); }
 
+    void set_defer_accept(int secs, std::error_code& ec) noexcept
+    {
+        set_tcp_defer_accept(get(), secs, ec);
+    }
+    void set_defer_accept(int secs) { set_tcp_defer_accept(get(), secs); }
+    void set_fast_open(int qlen, std::error_code& ec) noexcept
+    {
+        set_tcp_fast_open(get(), qlen, ec);
+    }
+    void set_fast_open(int qlen) { set_tcp_fast_open(get(), qlen); }
+
     IoSock accept(Endpoint& ep, std::error_code& ec) noexcept
     {
         return IoSock{os::accept(get(), ep, ec), family()};
@@ -0,0 +1,93 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "TcpInfo.hpp"
+
+namespace toolbox {
+inline namespace net {
+using namespace std;
+namespace {
+// Upper bound of the time histograms, in microseconds.
+constexpr int64_t MaxMicros{60'000'000};
+// Upper bound of the segment and byte count histograms.
+constexpr int64_t MaxCount{numeric_limits<uint32_t>::max()};
+} // namespace
+
+TcpInfoSampler::TcpInfoSampler(Reactor& r, Duration interval)
+: rtt_{1, MaxMicros, 2}
+, rttvar_{1, MaxMicros, 2}
+, retransmits_{1, MaxCount, 2}
+, snd_cwnd_{1, MaxCount, 2}
+, unacked_{1, MaxCount, 2}
+, notsent_bytes_{1, MaxCount, 2}
+{
+    tmr_ = r.timer(MonoClock::now() + interval, interval, Priority::Low,
+                   bind<&TcpInfoSampler::on_timer>(this));
+}
+
+TcpInfoSampler::~TcpInfoSampler() = default;
+
+void TcpInfoSampler::add(TcpInfoProbe& probe) noexcept
+{
+    if (!probe.is_linked()) {
+        probes_.push_back(probe);
+    }
+}
+
+void TcpInfoSampler::sample(CyclTime now) noexcept
+{
+    for (auto& probe : probes_) {
+        TcpInfo info;
+        error_code ec;
+        get_tcp_info(probe.fd_, info, ec);
+        if (ec) {
+            continue;
+        }
+        auto& snap = probe.snapshot_;
+        const auto retransmits = info.base.tcpi_total_retrans - snap.retransmits;
+        snap.time = now.mono_time();
+        snap.rtt = info.base.tcpi_rtt;
+        snap.rttvar = info.base.tcpi_rttvar;
+        snap.retransmits = info.base.tcpi_total_retrans;
+        snap.snd_cwnd = info.base.tcpi_snd_cwnd;
+        snap.unacked = info.base.tcpi_unacked;
+        snap.notsent_bytes = info.notsent_bytes;
+
+        rtt_.record_value(snap.rtt);
+        rttvar_.record_value(snap.rttvar);
+        retransmits_.record_value(retransmits);
+        snd_cwnd_.record_value(snap.snd_cwnd);
+        unacked_.record_value(snap.unacked);
+        notsent_bytes_.record_value(snap.notsent_bytes);
+    }
+}
+
+void TcpInfoSampler::reset() noexcept
+{
+    rtt_.reset();
+    rttvar_.reset();
+    retransmits_.reset();
+    snd_cwnd_.reset();
+    unacked_.reset();
+    notsent_bytes_.reset();
+}
+
+void TcpInfoSampler::on_timer(CyclTime now, Timer& /*tmr*/)
+{
+    sample(now);
+}
+
+} // namespace net
+} // namespace toolbox
@@ -0,0 +1,170 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_NET_TCPINFO_HPP
+#define TOOLBOX_NET_TCPINFO_HPP
+
+#include <toolbox/hdr/Histogram.hpp>
+#include <toolbox/io/Reactor.hpp>
+#include <toolbox/net/Socket.hpp>
+
+#include <boost/intrusive/list.hpp>
+
+#include <cstddef>
+
+namespace toolbox {
+inline namespace net {
+
+/// The leading fields of the kernel's tcp_info structure. The glibc definition ends at
+/// tcpi_total_retrans, and the kernel header cannot be included alongside <netinet/tcp.h>. The
+/// kernel only ever appends fields, and copies no more than the size requested, so older kernels
+/// leave the trailing fields zeroed.
+struct TcpInfo {
+    tcp_info base;
+    std::uint64_t pacing_rate;
+    std::uint64_t max_pacing_rate;
+    std::uint64_t bytes_acked;
+    std::uint64_t bytes_received;
+    std::uint32_t segs_out;
+    std::uint32_t segs_in;
+    std::uint32_t notsent_bytes;
+    std::uint32_t min_rtt;
+};
+
+static_assert(offsetof(TcpInfo, notsent_bytes) == 144);
+
+inline void get_tcp_info(int sockfd, TcpInfo& info, std::error_code& ec) noexcept
+{
+    info = {};
+    socklen_t optlen{sizeof(info)};
+    os::getsockopt(sockfd, IPPROTO_TCP, TCP_INFO, &info, optlen, ec);
+}
+
+inline void get_tcp_info(int sockfd, TcpInfo& info)
+{
+    info = {};
+    socklen_t optlen{sizeof(info)};
+    os::getsockopt(sockfd, IPPROTO_TCP, TCP_INFO, &info, optlen);
+}
+
+/// Transport metrics for a single connection at the time of the last sample.
+struct TcpInfoSnapshot {
+    MonoTime time{};
+    /// Smoothed round trip time in microseconds.
+    std::uint32_t rtt{0};
+    /// Round trip time variance in microseconds.
+    std::uint32_t rttvar{0};
+    /// Total number of segments retransmitted over the life of the connection.
+    std::uint32_t retransmits{0};
+    /// Congestion window in segments.
+    std::uint32_t snd_cwnd{0};
+    /// Number of segments sent but not yet acknowledged.
+    std::uint32_t unacked{0};
+    /// Number of bytes in the send queue that have not yet been sent.
+    std::uint32_t notsent_bytes{0};
+};
+
+/// Per-connection TCP_INFO state, which is embedded in each connection and linked into a
+/// TcpInfoSampler. The probe unlinks itself when the connection is destroyed.
+class TOOLBOX_API TcpInfoProbe {
+    friend class TcpInfoSampler;
+    // Automatically unlink when object is destroyed.
+    using AutoUnlinkOption = boost::intrusive::link_mode<boost::intrusive::auto_unlink>;
+
+  public:
+    TcpInfoProbe() noexcept = default;
+    ~TcpInfoProbe() = default;
+
+    // Copy.
+    TcpInfoProbe(const TcpInfoProbe&) = delete;
+    TcpInfoProbe& operator=(const TcpInfoProbe&) = delete;
+
+    // Move.
+    TcpInfoProbe(TcpInfoProbe&&) = delete;
+    TcpInfoProbe& operator=(TcpInfoProbe&&) = delete;
+
+    int fd() const noexcept { return fd_; }
+    void set_fd(int fd) noexcept { fd_ = fd; }
+    bool is_linked() const noexcept { return list_hook.is_linked(); }
+    const TcpInfoSnapshot& snapshot() const noexcept { return snapshot_; }
+
+    boost::intrusive::list_member_hook<AutoUnlinkOption> list_hook;
+
+  private:
+    int fd_{-1};
+    TcpInfoSnapshot snapshot_;
+};
+
+/// Samples TCP_INFO for a set of connections from a low priority Reactor timer, and aggregates the
+/// samples into histograms. A typical sampler is owned by a server and covers all of its
+/// connections, so that congestion-limited or slow peers show up in the tail of the histograms,
+/// while the per-connection snapshots identify the peers concerned.
+class TOOLBOX_API TcpInfoSampler {
+    using ConstantTimeSizeOption = boost::intrusive::constant_time_size<false>;
+    using MemberHookOption
+        = boost::intrusive::member_hook<TcpInfoProbe, decltype(TcpInfoProbe::list_hook),
+                                        &TcpInfoProbe::list_hook>;
+    using ProbeList
+        = boost::intrusive::list<TcpInfoProbe, ConstantTimeSizeOption, MemberHookOption>;
+
+  public:
+    TcpInfoSampler(Reactor& r, Duration interval);
+    ~TcpInfoSampler();
+
+    // Copy.
+    TcpInfoSampler(const TcpInfoSampler&) = delete;
+    TcpInfoSampler& operator=(const TcpInfoSampler&) = delete;
+
+    // Move.
+    TcpInfoSampler(TcpInfoSampler&&) = delete;
+    TcpInfoSampler& operator=(TcpInfoSampler&&) = delete;
+
+    /// Histogram of smoothed round trip times in microseconds.
+    const Histogram& rtt() const noexcept { return rtt_; }
+    /// Histogram of round trip time variance in microseconds.
+    const Histogram& rttvar() const noexcept { return rttvar_; }
+    /// Histogram of the number of segments retransmitted by each connection between samples.
+    const Histogram& retransmits() const noexcept { return retransmits_; }
+    /// Histogram of congestion windows in segments.
+    const Histogram& snd_cwnd() const noexcept { return snd_cwnd_; }
+    /// Histogram of unacknowledged segments.
+    const Histogram& unacked() const noexcept { return unacked_; }
+    /// Histogram of bytes queued but not yet sent.
+    const Histogram& notsent_bytes() const noexcept { return notsent_bytes_; }
+
+    /// Returns the number of probes that are currently linked.
+    std::size_t size() const noexcept { return probes_.size(); }
+
+    /// Links the probe into the sampler. The probe's descriptor must refer to a TCP socket.
+    void add(TcpInfoProbe& probe) noexcept;
+
+    /// Samples all linked probes immediately.
+    void sample(CyclTime now) noexcept;
+
+    /// Clears the histograms, typically after they have been published.
+    void reset() noexcept;
+
+  private:
+    void on_timer(CyclTime now, Timer& tmr);
+
+    ProbeList probes_;
+    Histogram rtt_, rttvar_, retransmits_, snd_cwnd_, unacked_, notsent_bytes_;
+    Timer tmr_;
+};
+
+} // namespace net
+} // namespace toolbox
+
+#endif // TOOLBOX_NET_TCPINFO_HPP
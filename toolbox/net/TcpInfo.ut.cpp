@@ -0,0 +1,83 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "TcpInfo.hpp"
+
+#include <toolbox/net/Endpoint.hpp>
+#include <toolbox/net/StreamSock.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+using namespace std;
+using namespace toolbox;
+
+BOOST_AUTO_TEST_SUITE(TcpInfoSuite)
+
+BOOST_AUTO_TEST_CASE(TcpInfoSamplerCase)
+{
+    StreamSockServ serv{StreamProtocol::tcp4()};
+    serv.bind(parse_stream_endpoint("tcp4://127.0.0.1:0"));
+    serv.listen(SOMAXCONN);
+    StreamEndpoint ep;
+    serv.get_sock_name(ep);
+
+    StreamSockClnt clnt{StreamProtocol::tcp4()};
+    clnt.connect(ep);
+    auto conn = serv.accept(ep);
+
+    // Round trip to establish an rtt estimate.
+    char buf[4];
+    os::write(clnt.get(), "ping", 4);
+    BOOST_CHECK_EQUAL(os::read(conn.get(), buf, sizeof(buf)), 4U);
+    os::write(conn.get(), "pong", 4);
+    BOOST_CHECK_EQUAL(os::read(clnt.get(), buf, sizeof(buf)), 4U);
+
+    TcpInfo info;
+    get_tcp_info(clnt.get(), info);
+    BOOST_CHECK_EQUAL(info.base.tcpi_state, TCP_ESTABLISHED);
+    BOOST_CHECK_GT(info.base.tcpi_snd_cwnd, 0U);
+
+    Reactor r{1024};
+    TcpInfoSampler sampler{r, 1s};
+    TcpInfoProbe clnt_probe;
+    clnt_probe.set_fd(clnt.get());
+    auto conn_probe = make_unique<TcpInfoProbe>();
+    conn_probe->set_fd(conn.get());
+    sampler.add(clnt_probe);
+    sampler.add(*conn_probe);
+    // Adding a probe twice has no effect.
+    sampler.add(clnt_probe);
+    BOOST_CHECK_EQUAL(sampler.size(), 2U);
+
+    const auto now = CyclTime::now();
+    sampler.sample(now);
+    BOOST_CHECK(clnt_probe.snapshot().time == now.mono_time());
+    BOOST_CHECK_GT(clnt_probe.snapshot().rtt, 0U);
+    BOOST_CHECK_GT(clnt_probe.snapshot().snd_cwnd, 0U);
+    BOOST_CHECK_EQUAL(clnt_probe.snapshot().unacked, 0U);
+    BOOST_CHECK_EQUAL(sampler.rtt().total_count(), 2);
+    BOOST_CHECK_EQUAL(sampler.snd_cwnd().total_count(), 2);
+
+    // Probes unlink themselves when the connection is destroyed.
+    conn_probe.reset();
+    BOOST_CHECK_EQUAL(sampler.size(), 1U);
+    sampler.reset();
+    sampler.sample(now);
+    BOOST_CHECK_EQUAL(sampler.rtt().total_count(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -32,6 +32,7 @@
 #include "util/RefCount.hpp"
 #include "util/RingBuffer.hpp"
 #include "util/RobinHood.hpp"
+#include "util/SlabPool.hpp"
 #include "util/Slot.hpp"
 #include "util/Storage.hpp"
 #include "util/Stream.hpp"
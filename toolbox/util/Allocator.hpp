@@ -17,7 +17,7 @@
 #ifndef TOOLBOX_UTIL_ALLOCATOR_HPP
 #define TOOLBOX_UTIL_ALLOCATOR_HPP
 
-#include <toolbox/Config.h>
+#include <toolbox/util/SlabPool.hpp>
 
 #include <cstddef>
 
@@ -30,10 +30,15 @@ inline namespace util {
 
 struct Allocator {
     static void* operator new(std::size_t size) { return allocate(size); }
+    /// Allocates the object from the pool. The object must be returned to the pool by destroying it
+    /// explicitly and then calling SlabPool::deallocate(), rather than with delete.
+    static void* operator new(std::size_t size, SlabPool& pool) { return pool.allocate(size); }
     static void operator delete(void* ptr, std::size_t size) noexcept
     {
         return deallocate(ptr, size);
     }
+    /// Called if the constructor of an object that was allocated from the pool throws.
+    static void operator delete(void* ptr, SlabPool& pool) noexcept { pool.deallocate(ptr); }
 
   protected:
     ~Allocator() = default;
@@ -0,0 +1,85 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SlabPool.hpp"
+
+#include "Allocator.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace toolbox {
+inline namespace util {
+using namespace std;
+namespace {
+
+constexpr size_t round_up(size_t size) noexcept
+{
+    constexpr size_t Align{alignof(max_align_t)};
+    return (max(size, sizeof(void*)) + Align - 1) & ~(Align - 1);
+}
+
+} // namespace
+
+SlabPool::SlabPool(size_t block_size, size_t slab_size)
+: block_size_{round_up(block_size)}
+, blocks_per_slab_{max<size_t>(slab_size / block_size_, 1)}
+{
+}
+
+SlabPool::~SlabPool()
+{
+    for (auto* const slab : slabs_) {
+        toolbox::deallocate(slab, block_size_ * blocks_per_slab_);
+    }
+}
+
+void* SlabPool::allocate(size_t size)
+{
+    if (size > block_size_) {
+        throw bad_alloc{};
+    }
+    if (!free_) {
+        grow();
+    }
+    auto* const node = free_;
+    free_ = node->next;
+    ++size_;
+    return node;
+}
+
+void SlabPool::deallocate(void* ptr) noexcept
+{
+    auto* const node = static_cast<Node*>(ptr);
+    node->next = free_;
+    free_ = node;
+    --size_;
+}
+
+void SlabPool::grow()
+{
+    slabs_.reserve(slabs_.size() + 1);
+    auto* const slab = static_cast<char*>(toolbox::allocate(block_size_ * blocks_per_slab_));
+    slabs_.push_back(slab);
+    // Thread the new blocks onto the free list in address order.
+    for (auto i = blocks_per_slab_; i-- > 0;) {
+        auto* const node = reinterpret_cast<Node*>(slab + i * block_size_);
+        node->next = free_;
+        free_ = node;
+    }
+}
+
+} // namespace util
+} // namespace toolbox
@@ -0,0 +1,73 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOOLBOX_UTIL_SLABPOOL_HPP
+#define TOOLBOX_UTIL_SLABPOOL_HPP
+
+#include <toolbox/Config.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace toolbox {
+inline namespace util {
+
+/// Pool of fixed size blocks, which are carved from larger slabs. Freed blocks are kept on a free
+/// list for reuse, and the slabs are only returned to the allocate() hook when the pool is
+/// destroyed, so allocation and deallocation are O(1) and never touch the general purpose heap once
+/// the pool has grown to its working size.
+///
+/// The pool is not thread-safe, so each pool should be owned by the thread that runs its Reactor.
+/// Objects of classes that derive from Allocator are allocated from a pool with new (pool) T{...}.
+class TOOLBOX_API SlabPool {
+  public:
+    /// The block size is rounded up to the alignment of std::max_align_t.
+    explicit SlabPool(std::size_t block_size, std::size_t slab_size = 64 << 10);
+    ~SlabPool();
+
+    // Copy.
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    // Move.
+    SlabPool(SlabPool&&) = delete;
+    SlabPool& operator=(SlabPool&&) = delete;
+
+    std::size_t block_size() const noexcept { return block_size_; }
+    /// Returns the number of blocks in use.
+    std::size_t size() const noexcept { return size_; }
+    /// Returns the number of blocks that have been carved from slabs, whether in use or free.
+    std::size_t capacity() const noexcept { return slabs_.size() * blocks_per_slab_; }
+
+    /// Throws std::bad_alloc if the size is larger than the block size.
+    void* allocate(std::size_t size);
+    void deallocate(void* ptr) noexcept;
+
+  private:
+    struct Node {
+        Node* next;
+    };
+    void grow();
+
+    const std::size_t block_size_, blocks_per_slab_;
+    Node* free_{nullptr};
+    std::vector<void*> slabs_;
+    std::size_t size_{0};
+};
+
+} // namespace util
+} // namespace toolbox
+
+#endif // TOOLBOX_UTIL_SLABPOOL_HPP
@@ -0,0 +1,90 @@
+// The Reactive C++ Toolbox.
+// Copyright (C) 2026 Reactive Markets Limited
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "SlabPool.hpp"
+
+#include "Allocator.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+
+using namespace std;
+using namespace toolbox;
+
+namespace {
+
+struct Foo : Allocator {
+    explicit Foo(int val, bool fail = false)
+    : val{val}
+    {
+        if (fail) {
+            throw runtime_error{"fail"};
+        }
+    }
+    int val;
+    char pad[100];
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(SlabPoolSuite)
+
+BOOST_AUTO_TEST_CASE(SlabPoolAllocateCase)
+{
+    SlabPool pool{24, 1024};
+    BOOST_CHECK_EQUAL(pool.block_size() % alignof(max_align_t), 0U);
+    BOOST_CHECK_GE(pool.block_size(), 24U);
+    BOOST_CHECK_EQUAL(pool.size(), 0U);
+    BOOST_CHECK_THROW(pool.allocate(pool.block_size() + 1), bad_alloc);
+
+    set<void*> ptrs;
+    for (int i{0}; i < 100; ++i) {
+        auto* const ptr = pool.allocate(24);
+        BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(ptr) % alignof(max_align_t), 0U);
+        BOOST_CHECK(ptrs.insert(ptr).second);
+    }
+    BOOST_CHECK_EQUAL(pool.size(), 100U);
+    BOOST_CHECK_GE(pool.capacity(), 100U);
+
+    const auto capacity = pool.capacity();
+    for (auto* const ptr : ptrs) {
+        pool.deallocate(ptr);
+    }
+    BOOST_CHECK_EQUAL(pool.size(), 0U);
+
+    // Freed blocks are reused before the pool grows.
+    for (int i{0}; i < 100; ++i) {
+        BOOST_CHECK(ptrs.contains(pool.allocate(24)));
+    }
+    BOOST_CHECK_EQUAL(pool.capacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(SlabPoolAllocatorCase)
+{
+    SlabPool pool{sizeof(Foo)};
+    auto* const foo = new (pool) Foo{101};
+    BOOST_CHECK_EQUAL(foo->val, 101);
+    BOOST_CHECK_EQUAL(pool.size(), 1U);
+    foo->~Foo();
+    pool.deallocate(foo);
+    BOOST_CHECK_EQUAL(pool.size(), 0U);
+
+    // The block is returned to the pool if the constructor throws.
+    BOOST_CHECK_THROW(new (pool) Foo(101, true), runtime_error);
+    BOOST_CHECK_EQUAL(pool.size(), 0U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()